@@ -0,0 +1,128 @@
+#include "bvh.hpp"
+#include "sat_cache.hpp"
+#include <algorithm>
+
+
+using namespace std;
+
+
+uint32_t _bvh_build(BVH& bvh, uint32_t first, uint32_t count) {
+  const uint32_t idx = bvh.nodes.size();
+  bvh.nodes.push_back(BVHNode());
+
+  AABB b = bvh.pieces[bvh.order[first]].bounds;
+  AABB c = { center(b), center(b) };  // bounds of the piece centres, used to pick the split
+  for (uint32_t i = first + 1; i < first + count; i++) {
+    const AABB& pb = bvh.pieces[bvh.order[i]].bounds;
+    b = merge(b, pb);
+    c = merge(c, { center(pb), center(pb) });
+  }
+
+  if (count <= BVH_LEAF_SIZE) {
+    bvh.nodes[idx] = { b, -1, -1, first, count };
+    return idx;
+  }
+
+  // median split along the widest axis of the centres
+  const Vec3 e = widths(c);
+  const int axis = (e.x >= e.y && e.x >= e.z) ? 0 : (e.y >= e.z ? 1 : 2);
+  const auto begin = bvh.order.begin() + first;
+  const auto& pieces = bvh.pieces;
+  nth_element(begin, begin + count / 2, begin + count, [&pieces, axis](uint32_t l, uint32_t r) {
+    return center(pieces[l].bounds)[axis] < center(pieces[r].bounds)[axis];
+  });
+
+  const int32_t
+    left  = _bvh_build(bvh, first, count / 2),
+    right = _bvh_build(bvh, first + count / 2, count - count / 2);
+  bvh.nodes[idx] = { b, left, right, first, count };
+  return idx;
+}
+
+
+BVH build_bvh(const vector<ConvexPiece>& pieces) {
+  BVH bvh;
+  for (size_t i = 0; i < pieces.size(); i++) {
+    if (pieces[i].faces.empty()) continue;  // nothing to collide with
+    bvh.pieces.push_back(pieces[i]);
+    bvh.order.push_back(bvh.order.size());
+  }
+  if (!bvh.pieces.empty()) {
+    bvh.nodes.reserve(2 * bvh.pieces.size());
+    _bvh_build(bvh, 0, bvh.pieces.size());
+  }
+  return bvh;
+}
+
+
+// visits every piece whose bounds overlap `query`, stopping at the first one `test` says collides
+template<typename F>
+bool _bvh_any(const BVH& bvh, const AABB& query, F test) {
+  if (bvh.nodes.empty()) return false;
+
+  int32_t stack[64];
+  size_t  top = 0;
+  stack[top++] = 0;
+
+  while (top > 0) {
+    const BVHNode& node = bvh.nodes[stack[--top]];
+    if (!overlap(node.bounds, query)) continue;
+
+    if (node.left < 0) {
+      for (uint32_t i = node.first; i < node.first + node.count; i++) {
+        if (test(bvh.pieces[bvh.order[i]])) return true;
+      }
+    } else {
+      stack[top++] = node.left;
+      stack[top++] = node.right;
+    }
+  }
+  return false;
+}
+
+
+bool intersect(const Vec3& x, const BVH& y) {
+  return _bvh_any(y, { x, x }, [&x](const ConvexPiece& p) { return intersect(x, p); });
+}
+
+
+bool intersect(const Sphere& x, const BVH& y) {
+  const Vec3 r = { x.r, x.r, x.r };
+  return _bvh_any(y, { x.center - r, x.center + r }, [&x](const ConvexPiece& p) { return intersect(x, p); });
+}
+
+
+bool intersect(const Prism& x, const BVH& y) {
+  const auto v = x.vertexes();
+  return _bvh_any(y, bounds(vector<Vec3>(v.begin(), v.end())), [&x](const ConvexPiece& p) { return intersect(x, p); });
+}
+
+
+bool intersect(const Prism& x, const BVH& y, const Vec3& disp) {
+  const auto v = x.vertexes();
+  vector<Vec3> pts(v.begin(), v.end());
+  for (size_t i = 0; i < v.size(); i++) {
+    pts.push_back(v[i] + disp);
+  }
+  return _bvh_any(y, bounds(pts), [&x, &disp](const ConvexPiece& p) { return intersect(x, p, disp); });
+}
+
+
+bool intersect(const Prism& x, const BVH& y, SATCache& cache, uint32_t part) {
+  const auto v = x.vertexes();
+  return _bvh_any(y, bounds(vector<Vec3>(v.begin(), v.end())), [&](const ConvexPiece& p) {
+    return _with_cached_axis(cache, sat_key(&p - y.pieces.data(), part), [&](Vec3* axis) { return intersect(x, p, axis); });
+  });
+}
+
+
+bool intersect(const Prism& x, const BVH& y, const Vec3& disp, SATCache& cache, uint32_t part) {
+  const auto v = x.vertexes();
+  vector<Vec3> pts(v.begin(), v.end());
+  for (size_t i = 0; i < v.size(); i++) {
+    pts.push_back(v[i] + disp);
+  }
+  return _bvh_any(y, bounds(pts), [&](const ConvexPiece& p) {
+    return _with_cached_axis(cache, sat_key(&p - y.pieces.data(), part), [&](Vec3* axis) { return intersect(x, p, disp, axis); });
+  });
+}
@@ -0,0 +1,45 @@
+#ifndef __BVH
+#define __BVH
+
+#include <vector>
+#include <cstdint>
+#include "geom.hpp"
+#include "hull.hpp"
+
+
+// bounding volume hierarchy (AABB tree) over convex pieces
+// this is what imported meshes are checked against, so a query only runs SAT on the few pieces near the gantry
+
+
+// leaves hold at most this many pieces
+#define BVH_LEAF_SIZE 2
+
+
+typedef struct BVHNode {
+  AABB     bounds;
+  int32_t  left;   // child node indexes, -1 for leaves
+  int32_t  right;
+  uint32_t first;  // for leaves, range of BVH::order
+  uint32_t count;
+} BVHNode;
+
+
+typedef struct BVH {
+  std::vector<ConvexPiece> pieces;
+  std::vector<BVHNode>     nodes;  // nodes[0] is the root, empty if there are no pieces
+  std::vector<uint32_t>    order;  // indexes into pieces, grouped by leaf
+} BVH;
+
+
+BVH build_bvh(const std::vector<ConvexPiece>& pieces);
+
+
+// these will return true if _any_ piece collides
+bool intersect(const Vec3& x,   const BVH& y);
+bool intersect(const Sphere& x, const BVH& y);
+bool intersect(const Prism& x,  const BVH& y);
+// `disp` is the motion of the prism
+bool intersect(const Prism& x,  const BVH& y, const Vec3& disp);
+
+
+#endif
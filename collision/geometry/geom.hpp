@@ -48,6 +48,15 @@ typedef struct {
 
 typedef boost::variant<Vec3, LineSegment, Prism, Sphere, Cylinder> Intersectable;
 
+
+// most points `_cylinder_side_intersect` can clip: pts + 2 * segments
+#define CYL_MAX_CLIP_POINTS 96
+
+// Exact test of a convex polytope against the side of a cylinder, used by the Prism <=> Cylinder checks.
+// `pts` are in the frame of the cylinder (centered at the origin, axis along z), `r` and `e` are the cylinder's.
+// `segments` (index pairs into pts) must include every edge of the polytope, other segments between its points are fine.
+bool _cylinder_side_intersect(const Vec3* pts, size_t n_pts, const uint8_t (*segments)[2], size_t n_segments, double r, double e);
+
 bool intersect(Vec3 x, Prism y);
 bool intersect(LineSegment x, Sphere y);
 bool intersect(Sphere x, Sphere y);
@@ -59,8 +68,10 @@ bool intersect(Prism x, Vec3 y);
 bool intersect(Prism x, LineSegment y);
 bool intersect(Prism x, Prism y);
 bool intersect(Prism x, Sphere y);
-bool intersect(Prism x, Cylinder y);
+bool intersect(Prism x, Cylinder y);  // side of the cylinder only, not the ends
 bool intersect(Prism x, Intersectable y); // dispatched
+// `axis` is tried first, and set to the separating axis if one is found (see sat_cache.hpp)
+bool intersect(Prism x, Prism y, Vec3* axis);
 
 // moving intersections
 // `disp` is vector delta for Prism origin
@@ -68,7 +79,8 @@ bool intersect(Prism x, Vec3 y,        Vec3 disp);
 bool intersect(Prism x, LineSegment y, Vec3 disp);
 bool intersect(Prism x, Prism y,       Vec3 disp);
 bool intersect(Prism x, Sphere y,      Vec3 disp);
-bool intersect(Prism x, Cylinder y,    Vec3 disp);  // needs optimizing
+bool intersect(Prism x, Cylinder y,    Vec3 disp);
+bool intersect(Prism x, Prism y,       Vec3 disp, Vec3* axis);
 
 // rotation
 // Prism orientation goes from original to rotation * original, and positions are rotated by rotation about `about`
@@ -77,6 +89,8 @@ bool intersect(Prism x, LineSegment y, Quaternion rotation, Vec3 about);  // ned
 bool intersect(Prism x, Prism y,       Quaternion rotation, Vec3 about);
 bool intersect(Prism x, Sphere y,      Quaternion rotation, Vec3 about);
 bool intersect(Prism x, Cylinder y,    Quaternion rotation, Vec3 about);
+// the axis is carried from step to step, so most steps only need one projection
+bool intersect(Prism x, Prism y,       Quaternion rotation, Vec3 about, Vec3* axis);
 
 // dispatch
 bool intersect(Prism x, Intersectable y);
@@ -0,0 +1,418 @@
+#include "hull.hpp"
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include <unordered_set>
+#include <unordered_map>
+
+
+using namespace std;
+
+
+AABB bounds(const vector<Vec3>& points) {
+  if (points.empty()) {
+    return { Vec3::zero(), Vec3::zero() };
+  }
+  AABB b = { points[0], points[0] };
+  for (size_t i = 1; i < points.size(); i++) {
+    b.lo = { min(b.lo.x, points[i].x), min(b.lo.y, points[i].y), min(b.lo.z, points[i].z) };
+    b.hi = { max(b.hi.x, points[i].x), max(b.hi.y, points[i].y), max(b.hi.z, points[i].z) };
+  }
+  return b;
+}
+
+
+AABB merge(const AABB& a, const AABB& b) {
+  return {
+    { min(a.lo.x, b.lo.x), min(a.lo.y, b.lo.y), min(a.lo.z, b.lo.z) },
+    { max(a.hi.x, b.hi.x), max(a.hi.y, b.hi.y), max(a.hi.z, b.hi.z) }
+  };
+}
+
+
+bool overlap(const AABB& a, const AABB& b) {
+  return
+    a.lo.x <= b.hi.x && b.lo.x <= a.hi.x &&
+    a.lo.y <= b.hi.y && b.lo.y <= a.hi.y &&
+    a.lo.z <= b.hi.z && b.lo.z <= a.hi.z;
+}
+
+
+Vec3 center(const AABB& a) {
+  return 0.5 * (a.lo + a.hi);
+}
+
+
+Vec3 widths(const AABB& a) {
+  return a.hi - a.lo;
+}
+
+
+/* Hull construction */
+
+
+typedef struct _HullFace {
+  uint32_t a, b, c;
+  Vec3     n;
+  double   d;  // plane offset, n * x = d on the face
+  bool     alive;
+} _HullFace;
+
+
+inline uint64_t _edge_key(uint32_t a, uint32_t b) {
+  return ((uint64_t)a << 32) | (uint64_t)b;
+}
+
+
+_HullFace _hull_face(const vector<Vec3>& pts, uint32_t a, uint32_t b, uint32_t c) {
+  const Vec3 n = normalized(cross(pts[b] - pts[a], pts[c] - pts[a]));
+  return { a, b, c, n, dot(n, pts[a]), true };
+}
+
+
+// index of the point furthest from the line through a and b
+size_t _furthest_from_line(const vector<Vec3>& pts, const Vec3& a, const Vec3& b, double* dist) {
+  const Vec3 u = normalized(b - a);
+  size_t best = 0;
+  *dist = -1;
+  for (size_t i = 0; i < pts.size(); i++) {
+    const Vec3   w = pts[i] - a;
+    const double d = norm(w - dot(w, u) * u);
+    if (d > *dist) {
+      *dist = d;
+      best  = i;
+    }
+  }
+  return best;
+}
+
+
+// a perpendicular to u, picked from whichever basis vector is least aligned with it
+Vec3 _any_perpendicular(const Vec3& u) {
+  const double
+    ax = fabs(u.x),
+    ay = fabs(u.y),
+    az = fabs(u.z);
+  const Vec3 b = (ax <= ay && ax <= az) ? Vec3::basis_x() : (ay <= az ? Vec3::basis_y() : Vec3::basis_z());
+  return normalized(cross(u, b));
+}
+
+
+ConvexPiece _build_piece(const vector<Vec3>& pts, const vector<_HullFace>& faces) {
+  ConvexPiece piece;
+  vector<uint32_t> remap(pts.size(), numeric_limits<uint32_t>::max());
+  vector<Vec3> face_normals;
+
+  for (size_t i = 0; i < faces.size(); i++) {
+    if (!faces[i].alive) continue;
+    const uint32_t idx[3] = { faces[i].a, faces[i].b, faces[i].c };
+    TriIdx tri;
+    for (size_t k = 0; k < 3; k++) {
+      if (remap[idx[k]] == numeric_limits<uint32_t>::max()) {
+        remap[idx[k]] = piece.hull.vertexes.size();
+        piece.hull.vertexes.push_back(pts[idx[k]]);
+      }
+      tri[k] = remap[idx[k]];
+    }
+    piece.faces.push_back(tri);
+    face_normals.push_back(faces[i].n);
+  }
+
+  // an edge shared by two coplanar triangles is just a diagonal of a flat face and is not a separating axis
+  unordered_map<uint64_t, vector<size_t>> edge_faces;
+  for (size_t i = 0; i < piece.faces.size(); i++) {
+    for (size_t k = 0; k < 3; k++) {
+      const uint32_t
+        a = piece.faces[i][k],
+        b = piece.faces[i][(k + 1) % 3];
+      edge_faces[_edge_key(min(a, b), max(a, b))].push_back(i);
+    }
+  }
+  for (const auto& ef : edge_faces) {
+    if (ef.second.size() == 2 && approxeq(face_normals[ef.second[0]], face_normals[ef.second[1]])) continue;
+    piece.hull.edges.push_back(make_pair((uint32_t)(ef.first >> 32), (uint32_t)(ef.first & 0xffffffff)));
+  }
+
+  for (size_t i = 0; i < face_normals.size(); i++) {
+    bool dup = false;
+    for (size_t j = 0; j < piece.hull.normals.size() && !dup; j++) {
+      dup = approxeq(face_normals[i], piece.hull.normals[j]);
+    }
+    if (!dup) piece.hull.normals.push_back(face_normals[i]);
+  }
+
+  piece.bounds = bounds(piece.hull.vertexes);
+  return piece;
+}
+
+
+ConvexPiece _convex_hull(const vector<Vec3>& pts, bool thicken) {
+  DEBUG_ENTER(__PRETTY_FUNCTION__);
+
+  if (pts.empty()) {
+    DEBUG_LEAVE;
+    return ConvexPiece();
+  }
+
+  const double
+    scale = norm(widths(bounds(pts))),
+    eps   = HULL_REL_EPSILON * max(scale, 1.0),
+    thick = max((double)HULL_FLAT_THICKNESS, 1000 * eps);
+
+  // initial simplex: two far apart points, the point furthest from their line, then from their plane
+  size_t i0 = 0, i1 = 0, i2 = 0, i3 = 0;
+  double d = -1;
+  for (size_t i = 0; i < pts.size(); i++) {
+    if (pts[i].x < pts[i0].x) i0 = i;
+  }
+  for (size_t i = 0; i < pts.size(); i++) {
+    const double di = norm(pts[i] - pts[i0]);
+    if (di > d) {
+      d  = di;
+      i1 = i;
+    }
+  }
+
+  if (d > eps) {
+    i2 = _furthest_from_line(pts, pts[i0], pts[i1], &d);
+  }
+  Vec3 n = Vec3::zero();
+  if (d > eps) {
+    n = normalized(cross(pts[i1] - pts[i0], pts[i2] - pts[i0]));
+    d = -1;
+    for (size_t i = 0; i < pts.size(); i++) {
+      const double di = fabs(dot(n, pts[i] - pts[i0]));
+      if (di > d) {
+        d  = di;
+        i3 = i;
+      }
+    }
+  }
+
+  if (d <= eps) {
+    if (!thicken) {
+      DEBUG_COUT("Degenerate input after thickening, giving up.");
+      DEBUG_LEAVE;
+      return ConvexPiece();
+    }
+    // flat, collinear, or a single point; give it some thickness in the missing direction(s)
+    vector<Vec3> thickened;
+    thickened.reserve(8 * pts.size());
+    const double h = 0.5 * thick;
+    if (!(norm(n) > 0)) {
+      const Vec3
+        u = (norm(pts[i1] - pts[i0]) > eps) ? normalized(pts[i1] - pts[i0]) : Vec3::basis_x(),
+        v = _any_perpendicular(u),
+        w = cross(u, v);
+      for (size_t i = 0; i < pts.size(); i++) {
+        for (int s = 0; s < 4; s++) {
+          thickened.push_back(pts[i] + ((s & 1) ? h : -h) * v + ((s & 2) ? h : -h) * w);
+        }
+        if (norm(pts[i1] - pts[i0]) <= eps) {
+          thickened.push_back(pts[i] + h * u);
+          thickened.push_back(pts[i] - h * u);
+        }
+      }
+    } else {
+      for (size_t i = 0; i < pts.size(); i++) {
+        thickened.push_back(pts[i] + h * n);
+        thickened.push_back(pts[i] - h * n);
+      }
+    }
+    DEBUG_COUT("Degenerate input, thickened by " << thick << "m.");
+    DEBUG_LEAVE;
+    return _convex_hull(thickened, false);
+  }
+
+  vector<_HullFace> faces;
+  faces.reserve(4 * pts.size());
+  faces.push_back(_hull_face(pts, i0, i1, i2));
+  faces.push_back(_hull_face(pts, i0, i2, i3));
+  faces.push_back(_hull_face(pts, i0, i3, i1));
+  faces.push_back(_hull_face(pts, i1, i3, i2));
+
+  // orient outwards
+  const Vec3 inside = 0.25 * (pts[i0] + pts[i1] + pts[i2] + pts[i3]);
+  for (size_t f = 0; f < faces.size(); f++) {
+    if (dot(faces[f].n, inside) - faces[f].d > 0) {
+      faces[f] = _hull_face(pts, faces[f].a, faces[f].c, faces[f].b);
+    }
+  }
+
+  vector<size_t> visible;
+  vector<pair<uint32_t, uint32_t>> horizon;
+  unordered_set<uint64_t> visible_edges;
+  size_t num_alive = 4;
+
+  for (size_t i = 0; i < pts.size(); i++) {
+    if (i == i0 || i == i1 || i == i2 || i == i3) continue;
+
+    visible.clear();
+    for (size_t f = 0; f < faces.size(); f++) {
+      if (faces[f].alive && dot(faces[f].n, pts[i]) - faces[f].d > eps) {
+        visible.push_back(f);
+      }
+    }
+    if (visible.empty()) continue;  // inside current hull
+
+    // the horizon is every edge of the visible region whose twin belongs to a face that stays
+    visible_edges.clear();
+    for (size_t v = 0; v < visible.size(); v++) {
+      const _HullFace& f = faces[visible[v]];
+      visible_edges.insert(_edge_key(f.a, f.b));
+      visible_edges.insert(_edge_key(f.b, f.c));
+      visible_edges.insert(_edge_key(f.c, f.a));
+    }
+    horizon.clear();
+    for (size_t v = 0; v < visible.size(); v++) {
+      _HullFace& f = faces[visible[v]];
+      const uint32_t idx[3] = { f.a, f.b, f.c };
+      for (size_t k = 0; k < 3; k++) {
+        const uint32_t
+          a = idx[k],
+          b = idx[(k + 1) % 3];
+        if (!visible_edges.count(_edge_key(b, a))) horizon.push_back(make_pair(a, b));
+      }
+      f.alive = false;
+    }
+    num_alive -= visible.size();
+
+    for (size_t h = 0; h < horizon.size(); h++) {
+      faces.push_back(_hull_face(pts, horizon[h].first, horizon[h].second, i));
+    }
+    num_alive += horizon.size();
+
+    if (faces.size() > 4 * num_alive) {
+      faces.erase(
+        remove_if(faces.begin(), faces.end(), [](const _HullFace& f) { return !f.alive; }),
+        faces.end()
+      );
+    }
+  }
+
+  auto piece = _build_piece(pts, faces);
+  DEBUG_COUT("Hull of " << pts.size() << " points has " << piece.hull.vertexes.size() << " vertexes and " << piece.faces.size() << " faces.");
+  DEBUG_LEAVE;
+  return piece;
+}
+
+
+ConvexPiece convex_hull(const vector<Vec3>& points) {
+  return _convex_hull(points, true);
+}
+
+
+double depth(const ConvexPiece& piece, const Vec3& p) {
+  double d = numeric_limits<double>::infinity();
+  if (piece.faces.empty()) return -d;
+
+  const auto& v = piece.hull.vertexes;
+  for (size_t i = 0; i < piece.faces.size(); i++) {
+    const TriIdx& f = piece.faces[i];
+    const Vec3 n = normalized(cross(v[f[1]] - v[f[0]], v[f[2]] - v[f[0]]));
+    d = min(d, dot(n, v[f[0]] - p));
+  }
+  return d;
+}
+
+
+// see Ericson, Real-Time Collision Detection, 5.1.5
+Vec3 closest_point(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c) {
+  const Vec3
+    ab = b - a,
+    ac = c - a,
+    ap = p - a;
+  const double
+    d1 = dot(ab, ap),
+    d2 = dot(ac, ap);
+  if (d1 <= 0 && d2 <= 0) return a;
+
+  const Vec3 bp = p - b;
+  const double
+    d3 = dot(ab, bp),
+    d4 = dot(ac, bp);
+  if (d3 >= 0 && d4 <= d3) return b;
+
+  const double vc = d1*d4 - d3*d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) return a + (d1 / (d1 - d3)) * ab;
+
+  const Vec3 cp = p - c;
+  const double
+    d5 = dot(ab, cp),
+    d6 = dot(ac, cp);
+  if (d6 >= 0 && d5 <= d6) return c;
+
+  const double vb = d5*d2 - d1*d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) return a + (d2 / (d2 - d6)) * ac;
+
+  const double va = d3*d6 - d5*d4;
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0) return b + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b);
+
+  const double denom = 1.0 / (va + vb + vc);
+  return a + (vb * denom) * ab + (vc * denom) * ac;
+}
+
+
+/* Intersections */
+
+
+bool intersect(const Vec3& x, const ConvexPiece& y) {
+  return !y.faces.empty() && depth(y, x) >= -APPROX;
+}
+
+
+bool intersect(const Sphere& x, const ConvexPiece& y) {
+  if (y.faces.empty()) return false;
+
+  const Vec3 r = { x.r, x.r, x.r };
+  if (!overlap({ x.center - r, x.center + r }, y.bounds)) return false;
+
+  if (depth(y, x.center) >= 0) return true;
+
+  const auto& v = y.hull.vertexes;
+  for (size_t i = 0; i < y.faces.size(); i++) {
+    const TriIdx& f = y.faces[i];
+    if (norm2(closest_point(x.center, v[f[0]], v[f[1]], v[f[2]]) - x.center) <= x.r * x.r) return true;
+  }
+  return false;
+}
+
+
+bool intersect(const Prism& x, const ConvexPiece& y) {
+  Vec3 axis = Vec3::zero();
+  return intersect(x, y, &axis);
+}
+
+
+bool intersect(const Prism& x, const ConvexPiece& y, Vec3* axis) {
+  if (y.faces.empty()) return false;
+
+  const auto v = x.vertexes();
+  if (!overlap(bounds(vector<Vec3>(v.begin(), v.end())), y.bounds)) return false;
+
+  return intersect(polyhedron(x), y.hull, axis);
+}
+
+
+bool intersect(const Prism& x, const ConvexPiece& y, const Vec3& disp) {
+  Vec3 axis = Vec3::zero();
+  return intersect(x, y, disp, &axis);
+}
+
+
+bool intersect(const Prism& x, const ConvexPiece& y, const Vec3& disp, Vec3* axis) {
+  if (norm2(disp) == 0) return intersect(x, y, axis);
+  if (y.faces.empty()) return false;
+
+  // the volume swept by a convex object under translation is the hull of its start and end
+  const auto v = x.vertexes();
+  vector<Vec3> pts;
+  pts.reserve(2 * v.size());
+  for (size_t i = 0; i < v.size(); i++) {
+    pts.push_back(v[i]);
+    pts.push_back(v[i] + disp);
+  }
+  if (!overlap(bounds(pts), y.bounds)) return false;
+
+  return intersect(convex_hull(pts).hull, y.hull, axis);
+}
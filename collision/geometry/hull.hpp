@@ -0,0 +1,72 @@
+#ifndef __HULL
+#define __HULL
+
+#include <array>
+#include <vector>
+#include <cstdint>
+#include "vec3.hpp"
+#include "geom.hpp"
+#include "sat.hpp"
+
+
+// this file contains 3D convex hulls, which are the building blocks for meshes imported from CAD models
+
+
+// points closer than this (relative to the size of the point cloud) to a hull face are considered to be on it
+#define HULL_REL_EPSILON 1e-9
+// flat, collinear or single point input is thickened by this much [m] so that it still has a proper hull
+// (a face of a CAD mesh split off on its own is very often perfectly flat)
+#define HULL_FLAT_THICKNESS 1e-6
+
+
+// axis-aligned bounding box
+typedef struct AABB {
+  Vec3 lo;
+  Vec3 hi;
+} AABB;
+
+
+// indexes into ConvexPiece::hull.vertexes, wound counterclockwise when viewed from outside
+typedef std::array<uint32_t, 3> TriIdx;
+
+
+// a convex polyhedron that also remembers its triangulated surface and bounds
+// the polyhedron is what gets passed to the SAT tests, the faces are used for exact distance queries
+typedef struct ConvexPiece {
+  ConvexPolyhedron    hull;
+  std::vector<TriIdx> faces;
+  AABB                bounds;
+} ConvexPiece;
+
+
+AABB bounds(const std::vector<Vec3>& points);
+AABB merge(const AABB& a, const AABB& b);
+bool overlap(const AABB& a, const AABB& b);
+Vec3 center(const AABB& a);
+Vec3 widths(const AABB& a);  // full widths, not half widths
+
+
+// incremental hull, O(n * faces), which is fine for the offline decomposition and for small point sets
+// an empty piece (no vertexes) is returned if there are no points
+ConvexPiece convex_hull(const std::vector<Vec3>& points);
+
+
+// distance below the hull surface (positive inside, negative outside)
+double depth(const ConvexPiece& piece, const Vec3& p);
+
+
+// closest point on the triangle abc to p
+Vec3 closest_point(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c);
+
+
+bool intersect(const Vec3& x,    const ConvexPiece& y);
+bool intersect(const Sphere& x,  const ConvexPiece& y);
+bool intersect(const Prism& x,   const ConvexPiece& y);
+// `disp` is the motion of the prism
+bool intersect(const Prism& x,   const ConvexPiece& y, const Vec3& disp);
+// `axis` is tried first, and set to the separating axis if one is found (see sat_cache.hpp)
+bool intersect(const Prism& x,   const ConvexPiece& y, Vec3* axis);
+bool intersect(const Prism& x,   const ConvexPiece& y, const Vec3& disp, Vec3* axis);
+
+
+#endif
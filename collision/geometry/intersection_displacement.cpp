@@ -1,5 +1,7 @@
 #include "geom.hpp"
 #include "sat.hpp"
+#include <algorithm>
+#include <limits>
 
 /*
 [x] Prism Vec3
@@ -77,431 +79,111 @@ bool intersect(Prism x, Prism y, Vec3 disp) {
   return intersect(_sweep(x, disp), polyhedron(y));
 }
 
-bool intersect(Prism x, Cylinder y, Vec3 disp) {
-  auto p = polyhedron(x);
-  // if (!intersect(bounding_cylinder(p, disp), bounding_sphere(y))) return false;
-  auto c = polyhedron(y);
-  return intersect(p, c);
+bool intersect(Prism x, Prism y, Vec3 disp, Vec3* axis) {
+  return intersect(_sweep(x, disp), polyhedron(y), axis);
 }
 
-
-/* Intersection with sphere */
-
-
-static const unordered_set<int> INTERSECTION_REGIONS = {0,1,2,3,5,6,8,10};
-
-
-inline boost::optional<Vec3> _point_of_collision(LineSegment x, Sphere y) {
-  Vec3
-    v = x.b - x.a,
-    w = y.center - x.a;
-
-  double
-    d0 = w * v,
-    d1 = v * v;
-
-  if (d0 <= 0 || d1 <= d0) {  // before ls.a
-    return boost::none;
-  }
-  else {
-    return x.a + (d0 / d1) * v;
+// Same as the static test, on the volume swept by the prism: the hull of its start and end vertexes.
+// Every edge of that hull is either an edge of the prism at the start or end, or the path of a vertex.
+bool intersect(Prism x, Cylinder y, Vec3 disp) {
+  const Quaternion inv = inverse(y.orientation);
+  const auto v = x.vertexes();
+  array<Vec3, 16> pts;
+  for (size_t i = 0; i < 8; i++) {
+    pts[i]     = rotate_point(v[i],        y.center, inv) - y.center;
+    pts[i + 8] = rotate_point(v[i] + disp, y.center, inv) - y.center;
   }
-}
-
 
-inline boost::optional<Vec3> _point_of_collision(LineSegment x, Cylinder y) {
-  LineSegment l = {
-    rotate_point(x.a, y.center, inverse(y.orientation)),
-    rotate_point(x.b, y.center, inverse(y.orientation))
+  static const uint8_t segments[32][2] = {
+    // start
+    {0, 4}, {0, 1}, {4, 5}, {1, 5}, {1, 2}, {5, 6}, {2, 6}, {2, 3}, {6, 7}, {3, 7}, {3, 0}, {7, 4},
+    // end
+    {8, 12}, {8, 9}, {12, 13}, {9, 13}, {9, 10}, {13, 14}, {10, 14}, {10, 11}, {14, 15}, {11, 15}, {11, 8}, {15, 12},
+    // vertex paths
+    {0, 8}, {1, 9}, {2, 10}, {3, 11}, {4, 12}, {5, 13}, {6, 14}, {7, 15}
   };
-  Vec3 d = l.b - l.a;
 
-  double denom = (d.x*d.x) + (d.y*d.y);
-
-  if (abs(denom) < APPROX)
-    return boost::none;
-
-  double det = ((y.r*y.r) * (d.x*d.x))
-             + ((y.r*y.r) * (d.y*d.y))
-             - ((d.x*d.x) * (l.a.y*l.a.y))
-             - ((d.y*d.y) * (l.a.x*l.a.x))
-             + (2*d.x*d.y*l.a.x*l.a.y);
+  return _cylinder_side_intersect(pts.data(), 16, segments, 32, y.r, y.e);
+}
 
-  if (det - APPROX <= 0)
-    return boost::none;
 
-  det = sqrt(det);
+/* Intersection with sphere */
 
-  double
-    num = -(d.x*l.a.x) - (d.y*l.a.y),
-    t1  = (num + det) / denom,
-    t2  = (num - det) / denom;
 
-  if (t1 >= 0 && t1 <= 1) {
-    double z = l.a.z + (t1 * d.z);
-    if (abs(z) < y.e)
-      return t1 * Vec3(d.x, d.y, z) + x.a;
+// Squared distance from the segment c + t*d, t in [0, 1], to the box |p[i]| <= e[i].
+// Along the segment the squared distance is sum_i max(|p[i]| - e[i], 0)^2, which is convex and quadratic between the
+//   (at most 6) values of t where the segment crosses a face plane. Each piece is minimized exactly.
+double _segment_box_dist2(Vec3 c, Vec3 d, Vec3 e) {
+  double ts[8] = {0.0};
+  size_t n = 1;
+  for (uint8_t i = 0; i < 3; i++) {
+    if (d[i] == 0) continue;
+    const double
+      t0 = (-e[i] - c[i]) / d[i],
+      t1 = ( e[i] - c[i]) / d[i];
+    if (0 < t0 && t0 < 1) ts[n++] = t0;
+    if (0 < t1 && t1 < 1) ts[n++] = t1;
   }
-
-  if (t2 >= 0 && t2 <= 1) {
-    double z = l.a.z + (t2 * d.z);
-    if (abs(z) < y.e)
-      return t2 * Vec3(d.x, d.y, z) + x.a;
+  // insertion sort, there are at most 6 crossings
+  for (size_t k = 2; k < n; k++) {
+    for (size_t j = k; j > 1 && ts[j-1] > ts[j]; j--) swap(ts[j-1], ts[j]);
   }
+  ts[n++] = 1.0;
+
+  double best = numeric_limits<double>::infinity();
+  for (size_t k = 0; k + 1 < n; k++) {
+    const double
+      lo  = ts[k],
+      hi  = ts[k+1],
+      mid = 0.5 * (lo + hi);
+
+    // on this piece every axis is either past the +e face, past the -e face, or between them (no contribution)
+    double a = 0, b = 0, q = 0;
+    for (uint8_t i = 0; i < 3; i++) {
+      const double
+        p  = c[i] + mid * d[i],
+        s  = (double)(p > e[i]) - (double)(p < -e[i]),
+        c0 = c[i] - s * e[i];
+      a += s * s * d[i] * d[i];
+      b += s * s * 2 * c0 * d[i];
+      q += s * s * c0 * c0;
+    }
 
-  return boost::none;
-}
-
-
-// sphere, source, displacement, normal 1, normal 2
-bool _sphere_intersect(Sphere s, Vec3 c, Vec3 disp, Vec3 n1, Vec3 n2, Vec3 n3) {
-  // c.x + t*disp.x
-  LineSegment ls = {c, c+disp};
-  auto _p = _point_of_collision(ls, s);
-
-  if (!_p) return false; // no collision
-
-  // there is a collision, now check if in correct octant
-  // should pass vectors along borders of octant
-  auto
-    p   = *_p,
-    del = p - s.center;
-
-  return (del * n1) >= 0 && (del * n2) >= 0 && (del * n3) >= 0;
-}
-
-
-// cylinder, source, displacement, normal 1, normal 2
-bool _cyl_intersect(Cylinder cyl, Vec3 c, Vec3 disp, Vec3 n1, Vec3 n2) {
-  // c.x + t*disp.x
-  return true;
-  LineSegment ls = {c, c+disp};
-  auto _p = _point_of_collision(ls, cyl);
-
-  if (!_p) return false;
-
-  auto 
-    p   = *_p,
-    del = p - cyl.center;
-
-  return (del * n1) >= 0 && (del * n2) >= 0;
-}
-
-
-enum IntersectOpinion {
-  Intersects,
-  NoIntersect,
-  MaybeIntersect
-};
-
-
-// does the ray intersect with the box faces?
-IntersectOpinion _superbox_intersect(Vec3 c, Vec3 disp, Vec3 extents, double r, uint8_t xn, uint8_t x1, uint8_t x2) {
-  // collision with plane in normal direction
-  double t = ((extents[xn] + r) - c[xn]) / disp[xn];
-
-  // no intersection if outside disp range
-  if (0 > t || t > 1) return NoIntersect;
-
-  double
-    i1 = c[x1] + (t * disp[x1]),
-    i2 = c[x2] + (t * disp[x2]);
-
-  // no intersection if i1 or i2 is out of the bounds of the super box
-  if (fabs(i1) > extents[x1] + r || fabs(i2) > extents[x2] + r) return NoIntersect;
-
-  // intersection on rounded box rectangular face
-  if (fabs(i1) < extents[x1] && fabs(i2) < extents[x2]) return Intersects;
-
-  return MaybeIntersect;
-}
-
-
-// does the ray intersect with the end spheres?
-// note: we don't technically need to check every single sphere, however it's just easier to do this an will still be plenty fast.
-//       
-bool _sphereend_intersect(Vec3 c, Vec3 disp, Vec3 extents, double r) {
-  const auto
-    X = Vec3::basis_x(),
-    Y = Vec3::basis_y(),
-    Z = Vec3::basis_z();
-
-  // spheres in first quadrant
-  Sphere s = {Vec3(extents.x, extents.y, extents.z), r};
-  if (_sphere_intersect(s, c, disp, Vec3::basis_x(), Vec3::basis_x(), Z)) return true;
-  s.center.z *= -1;
-  if (_sphere_intersect(s, c, disp, X, Y, -Z)) return true;
-
-  // spheres in second quadrant
-  s = {Vec3(extents.x, -extents.y, extents.z), r};
-  if (_sphere_intersect(s, c, disp, X, -Y, Z)) return true;
-  s.center.z *= -1;
-  if (_sphere_intersect(s, c, disp, X, -Y, -Z)) return true;
-
-  // spheres in third quadrant
-  s = {Vec3(-extents.x, extents.y, extents.z), r};
-  if (_sphere_intersect(s, c, disp, -X, Y, Z)) return true;
-  s.center.z *= -1;
-  if (_sphere_intersect(s, c, disp, -X, Y, -Z)) return true;
-
-  // sphere in fourth quadrant
-  s = {Vec3(-extents.x, -extents.y, extents.z), r};
-  if (_sphere_intersect(s, c, disp, -X, -Y, Z)) return true;
-  s.center.z *= -1;
-  if (_sphere_intersect(s, c, disp, -X, -Y, -Z)) return true;
-
-  return false;
-}
-
-
-// checks if we've collided with side cylinders
-bool _cylinder_intersect(Vec3 c, Vec3 disp, Vec3 extents, double r) {
-  const auto
-    X = Vec3::basis_x(),
-    Y = Vec3::basis_y(),
-    Z = Vec3::basis_z();
-
-  Cylinder cyl;
-
-  // first -> second quadrant
-  cyl = {Vec3(extents.x, 0, extents.z), r, extents.y, Quaternion::from_axis_angle(X, PI/2)};
-  if (_cyl_intersect(cyl, c, disp, X,  Z)) return true;
-  cyl.center.z *= -1;
-  if (_cyl_intersect(cyl, c, disp, X, -Z)) return true;
-
-  // second -> third quadrant
-  cyl = {Vec3(0, extents.y, extents.z), r, extents.x, Quaternion::from_axis_angle(Y, PI/2)};
-  if (_cyl_intersect(cyl, c, disp, Y,  Z)) return true;
-  cyl.center.z *= -1;
-  if (_cyl_intersect(cyl, c, disp, Y, -Z)) return true;
-
-  // third -> fourth quadrant
-  cyl = {Vec3(-extents.x, 0, extents.z), r, extents.y, Quaternion::from_axis_angle(X, PI/2)};
-  if (_cyl_intersect(cyl, c, disp, -X,  Z)) return true;
-  cyl.center.z *= -1;
-  if (_cyl_intersect(cyl, c, disp, -X, -Z)) return true;
-
-  // fourth -> first quadrant
-  cyl = {Vec3(0, -extents.y, extents.z), r, extents.x, Quaternion::from_axis_angle(Y, PI/2)};
-  if (_cyl_intersect(cyl, c, disp, -Y,  Z)) return true;
-  cyl.center.z *= -1;
-  if (_cyl_intersect(cyl, c, disp, -Y, -Z)) return true;
-
-  return false;
+    const double t = a > 0 ? min(max(-b / (2 * a), lo), hi) : lo;
+    best = min(best, (a * t + b) * t + q);
+  }
+  return best;
 }
 
 
+// Exact: the prism hits the sphere iff the sphere's centre, moving relative to the prism, comes within r of the box.
 bool intersect(Prism x, Sphere y, Vec3 disp) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
 
-  // Taken from geometrictools.com
-  // This is a bit of a monster function. It follows the algorithm at https://www.geometrictools.com/Documentation/IntersectionMovingSphereBox.pdf.
-  //   There are a couple of changes:
-  //       we're using a displacement instead of a velocity
-  //       we only report if there is or isn't an intersection, we don't care about when
-
-  // First, transform sphere to frame where prism is centred at origin and oriented along global dimensions
-  y.center = rotate_point(y.center - x.center, Vec3::zero(), inverse(x.orientation));
-  // disp is prism displacement, so to find sphere displacement 
-  disp = -disp;
-
-  // Now, transform so y.center is in first octant
-  if (y.center.x < 0) {
-    y.center.x *= -1;
-    disp.x     *= -1;
-  }
-  if (y.center.y < 0) {
-    y.center.y *= -1;
-    disp.y     *= -1;
-  }
-  if (y.center.z < 0) {
-    y.center.z *= -1;
-    disp.z     *= -1;
-  }
+  // transform to the frame where the prism is centred at the origin and aligned with the axes
+  const Quaternion inv = inverse(x.orientation);
+  const Vec3
+    c = rotate_point(y.center - x.center, Vec3::zero(), inv),
+    d = rotate_point(-disp, Vec3::zero(), inv);  // the sphere moves opposite to the prism
 
-  // Now we have to find which region the sphere's center falls into
-  Vec3 vert = {x.ex, x.ey, x.ez};
-  Vec3 delt = y.center - vert;
-
-  // Could be split up into a tree but this is honestly more readable
-  uint8_t region = 255;
-
-  const bool
-    dx_le_0 = delt.x <= 0,
-    dy_le_0 = delt.y <= 0,
-    dz_le_0 = delt.z <= 0,
-    dx_le_r = delt.x <= y.r,
-    dy_le_r = delt.y <= y.r,
-    dz_le_r = delt.z <= y.r,
-    dx_gt_0_le_r = !dx_le_0 && dx_le_r,
-    dy_gt_0_le_r = !dy_le_0 && dy_le_r,
-    dz_gt_0_le_r = !dz_le_0 && dz_le_r,
-    dx2_dy2_le_r2 = (delt.x * delt.x) + (delt.y * delt.y) <= (y.r * y.r),
-    dy2_dz2_le_r2 = (delt.y * delt.y) + (delt.z * delt.z) <= (y.r * y.r),
-    dx2_dz2_le_r2 = (delt.x * delt.x) + (delt.z * delt.z) <= (y.r * y.r),
-    dx2_dy2_dz2_le_r2 = (delt.x * delt.x) + (delt.y * delt.y) + (delt.z * delt.z) <= (y.r * y.r);
-
-  if (dx_le_0  &&  dy_le_0  &&  dz_le_0)
-    region = 0;
-  else if (dx_gt_0_le_r  &&  dy_le_0  &&  dz_le_0)
-    region = 1;
-  else if (dx_le_0  &&  dy_gt_0_le_r  &&  dz_le_0)
-    region = 2;
-  else if (dx_gt_0_le_r  &&  dy_gt_0_le_r  &&  dx2_dy2_le_r2)
-    region = 3;
-  else if (dx_gt_0_le_r  &&  dy_gt_0_le_r  &&  !dx2_dy2_le_r2)
-    region = 4;
-  else if (dx_le_0  &&  dy_le_0  &&  dz_gt_0_le_r)
-    region = 5;
-  else if (dx_gt_0_le_r  &&  dy_le_0  &&  dz_gt_0_le_r  &&   dx2_dz2_le_r2)
-    region = 6;
-  else if (dx_gt_0_le_r  &&  dy_le_0  &&  dz_gt_0_le_r  &&  !dx2_dz2_le_r2)
-    region = 7;
-  else if (dx_le_0  &&  dy_gt_0_le_r  &&  dz_gt_0_le_r  &&   dy2_dz2_le_r2)
-    region = 8;
-  else if (dx_le_0  &&  dy_gt_0_le_r  &&  dz_gt_0_le_r  &&  !dy2_dz2_le_r2)
-    region = 9;
-  else if (dx_gt_0_le_r  &&  dy_gt_0_le_r  &&  dz_gt_0_le_r  &&   dx2_dy2_dz2_le_r2)
-    region = 10;
-  else if (dx_gt_0_le_r  &&  dy_gt_0_le_r  &&  dz_gt_0_le_r  &&  !dx2_dy2_dz2_le_r2)
-    region = 11;
-  else if (!dx_le_r  &&  dy_le_r  &&  dz_le_r)
-    region = 12;
-  else if ( dx_le_r  && !dy_le_r  &&  dz_le_r)
-    region = 13;
-  else if (!dx_le_r  && !dy_le_r  &&  dz_le_r)
-    region = 14;
-  else if ( dx_le_r  &&  dy_le_r  && !dz_le_r)
-    region = 15;
-  else if (!dx_le_r  &&  dy_le_r  && !dz_le_r)
-    region = 16;
-  else if ( dx_le_r  && !dy_le_r  && !dz_le_r)
-    region = 17;
-  else if (!dx_le_r  && !dy_le_r  && !dz_le_r)
-    region = 18;
-  else {
-    DEBUG_COUT(C_BR_RED << "Error: incorrect region. Reporting collision." << C_RESET);
-    cerr << C_BR_RED << "Error: incorrect region. Reporting collision." << C_RESET;
-    DEBUG_LEAVE;
-    return true;
-  }
+  const Vec3 e = {x.ex, x.ey, x.ez};
 
-  DEBUG_COUT("Found region " << ((int)region));
-
-  if (INTERSECTION_REGIONS.count(region)) {
-    // in a region with immediate collision
-    DEBUG_COUT("Immediate collision.");
-    DEBUG_LEAVE;
-    return true;
-  } else if (disp == Vec3::zero()) {
-    // no immediate intersection, and no velocity, so there can be no collision
-    DEBUG_COUT("No immediate collision and displacement is zero.");
-    DEBUG_LEAVE;
-    return false;
+  // quick rejection: the bounding box of the sphere's path is too far from the prism
+  double gap2 = 0;
+  for (uint8_t i = 0; i < 3; i++) {
+    const double g = max(fabs(c[i] + 0.5 * d[i]) - 0.5 * fabs(d[i]) - e[i], 0.0);
+    gap2 += g * g;
   }
-  // no immediate intersection, but we must check if one is possible in the future
-
-  if (region == 11) {
-    DEBUG_COUT("This is a vertex-separated region.");
-    // vertex-separated
-
-    double
-      a0 = y.r * y.r,
-      a1 = 2 * (disp * delt),
-      a2 = norm2(disp);
-
-    if (fabs(a2) < 1e-9) {
-      DEBUG_COUT(C_BR_RED << "Error: displacement is zero. Probably no collision, I guess, but this shoudln't happen." << C_RESET);
-      DEBUG_LEAVE;
-      return false;
-    }
-
-    double t = (-a1 - sqrt(a1*a1 - a2*a0)) / a2;
-    DEBUG_COUT("Found t=" << t);
+  if (gap2 > y.r * y.r) {
+    DEBUG_COUT("Path bounds are too far from the prism.");
     DEBUG_LEAVE;
-    return (t >= 0 && t <= 1); 
-  }
-
-  else if (region == 4 || region == 7 || region == 9) {
-    DEBUG_COUT("Edge-separated region.");
-    // edge separated
-    // R4 => xy
-    // R7 => xz
-    // R9 => yz
-    uint8_t
-      i0 = region == 4 ? 0 : region == 7 ? 2 : 1,
-      i1 = region == 4 ? 1 : region == 7 ? 0 : 2;
-      //i2 = region == 4 ? 2 : region == 7 ? 1 : 0;
-    
-    double
-      b0 = (disp[i0]*disp[i0]) + (disp[i1]*disp[i1]),
-      b1 = 2 * ((disp[i0]*delt[i0]) + (disp[i1]*delt[i1])),
-      b2 = (delt[i0]*delt[i0]) + (delt[i1]*delt[i1]) - (y.r*y.r);
-    
-    if (fabs(b2) < 1e-9) {
-      DEBUG_LEAVE;
-      return true;
-    }
-
-    double t = (-b1 - sqrt(b1*b1 - b2*b0)) / b2;
-    DEBUG_COUT("Found t=" << t);
-    DEBUG_LEAVE;
-    return (t >= 0 && t <= 1); 
-  }
-
-  else {
-    DEBUG_COUT("Unbound region.");
-    // unbounded
-    // test for intersection on three relevant faces of "super box"
-    // c = y.center
-    const static array< tuple<uint8_t, uint8_t, uint8_t>, 3> permutations = {{
-      make_tuple((uint8_t)0, (uint8_t)1, (uint8_t)2),
-      make_tuple((uint8_t)2, (uint8_t)0, (uint8_t)1),
-      make_tuple((uint8_t)1, (uint8_t)2, (uint8_t)0)
-    }};
-
-    bool all_nointersect = true;
-
-    for (size_t i = 0; i < 3; i++) {
-      const auto perm = permutations[i];
-
-      switch(_superbox_intersect(y.center, disp, vert, y.r, get<0>(perm), get<1>(perm), get<2>(perm))) {
-        case Intersects:
-          DEBUG_COUT("Superbox intersected.");
-          DEBUG_LEAVE;
-          return true;
-        case NoIntersect:
-          continue;
-        default:  // might intersect
-          all_nointersect = false;
-          continue;
-      }
-    }
-
-    if (all_nointersect) {
-      DEBUG_COUT("All permutations reported no collision.");
-      DEBUG_LEAVE;
-      return false;
-    }
-    // one of the sides of the superbox reported "maybe", so we have to check end spheres and cylinders.
-    else {
-      if (_sphereend_intersect(y.center, disp, vert, y.r)) {
-        DEBUG_COUT("Found intersection with a sphere octant.");
-        DEBUG_LEAVE;
-        return true;
-      }
-      else if (_cylinder_intersect(y.center, disp, vert, y.r)) {
-        DEBUG_COUT("Found intersection with a quarter cylinder.");
-        DEBUG_LEAVE;
-        return true;
-      }
-    }
-
+    return false;
   }
 
-  DEBUG_COUT("No intersections found.");
+  const double dist2 = _segment_box_dist2(c, d, e);
+  DEBUG_COUT("Closest approach squared " << dist2);
   DEBUG_LEAVE;
-  return false;
+  return dist2 <= y.r * y.r;
 }
 
 
@@ -104,6 +104,12 @@ bool intersect(Prism x, LineSegment y, Quaternion rotation, Vec3 about) {
 
 
 bool intersect(Prism x, Prism y, Quaternion rotation, Vec3 about) {
+  Vec3 axis = Vec3::zero();
+  return intersect(x, y, rotation, about, &axis);
+}
+
+
+bool intersect(Prism x, Prism y, Quaternion rotation, Vec3 about, Vec3* axis) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
   size_t n_steps;
   double err;
@@ -120,7 +126,8 @@ bool intersect(Prism x, Prism y, Quaternion rotation, Vec3 about) {
     rot = slerp(Quaternion::identity(), rotation, step*fac);
 
     p   = {rotate_point(x.center, about, rot), x.ex * err, x.ey * err, x.ez * err, rot * x.orientation};
-    if (intersect(p, y)) {
+    // successive steps barely move, so the axis from the last step usually separates this one too
+    if (intersect(p, y, axis)) {
       DEBUG_COUT("Found intersection on step " << step << "/" << n_steps);
       DEBUG_LEAVE;
       return true;
@@ -1,4 +1,5 @@
 #include "geom.hpp"
+#include <algorithm>
 
 
 /*
@@ -228,9 +229,15 @@ bool intersect(Prism x, LineSegment y) {
 }
 
 
+bool intersect(Prism x, Prism y) {
+  Vec3 axis = Vec3::zero();
+  return intersect(x, y, &axis);
+}
+
+
 // this is a specialized version of the SAT algorithm used other places
 // it uses the shape of the prisms to do fewer checks
-bool intersect(Prism x, Prism y) {
+bool intersect(Prism x, Prism y, Vec3* axis) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
   // first, check if bounding spheres intersect
 
@@ -260,6 +267,23 @@ bool intersect(Prism x, Prism y) {
   auto xpts = x.vertexes();
   auto ypts = y.vertexes();
 
+  array<double, 8> projected_x, projected_y;
+
+  // try the axis that separated these last time first, it usually still does
+  if (norm2(*axis) > 0) {
+    for (int j = 0; j < 8; j++) {
+      projected_x[j] = *axis * (xpts[j]);
+      projected_y[j] = *axis * (ypts[j]);
+    }
+    auto x_extr = extrema(projected_x);
+    auto y_extr = extrema(projected_y);
+    if ((x_extr.second < y_extr.first) || (y_extr.second < x_extr.first)) {
+      DEBUG_COUT("Previous separating axis still separates.");
+      DEBUG_LEAVE;
+      return false;
+    }
+  }
+
 
   // Now that we've done cheap tests, we have to use SAT
   // From geometrictools.com
@@ -298,8 +322,6 @@ bool intersect(Prism x, Prism y) {
     }
   }
 
-  array<double, 8> projected_x, projected_y;
-
   for (int i = 0; i < (12+9); i++) {
     for (int j = 0; j < 8; j++) {
       projected_x[j] = axes[i] * (xpts[j]);
@@ -313,6 +335,7 @@ bool intersect(Prism x, Prism y) {
     // cout << "  Extrema y: " << yExtr.first << ", " << yExtr.second << endl;
     if ((x_extr.second < y_extr.first) || (y_extr.second < x_extr.first)) {
       DEBUG_COUT("Separating axis found.");
+      *axis = axes[i];
       DEBUG_LEAVE;
       return false;
     }
@@ -346,72 +369,115 @@ bool intersect(Prism x, Sphere y) {
 }
 
 
-// Checks for intersections between a prism and the **side** of a cylinder. Does not check ends of the cylinder.
-// For each line segment in the prism, check if there is a solution to that and the circle
-bool intersect(Prism x, Cylinder y) {
+// cross product z component of (b - a) x (c - a), for points in the xy-plane
+inline double _cross2(const Vec3& a, const Vec3& b, const Vec3& c) {
+  return (b.x - a.x)*(c.y - a.y) - (b.y - a.y)*(c.x - a.x);
+}
+
+
+// squared distance from the origin to the segment ab in the xy-plane (clamped closest point)
+double _origin_dist2(const Vec3& a, const Vec3& b) {
+  const double
+    dx = b.x - a.x,
+    dy = b.y - a.y,
+    l2 = dx*dx + dy*dy,
+    t  = (l2 > 0) ? max(0.0, min(1.0, -(a.x*dx + a.y*dy) / l2)) : 0.0,
+    px = a.x + t*dx,
+    py = a.y + t*dy;
+  return px*px + py*py;
+}
+
+
+bool _cylinder_side_intersect(const Vec3* pts, size_t n_pts, const uint8_t (*segments)[2], size_t n_segments, double r, double e) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
-  // first, find points of prism in frame of cylinder
-  auto ls = x.edges();
+  array<Vec3, CYL_MAX_CLIP_POINTS> clipped;
+  size_t n = 0;
 
-  {
-    array<Vec3, 24> pts;
-    for (int i = 0; i < 12; i++) {
-      pts[2*i]   = ls[i].a;
-      pts[2*i+1] = ls[i].b;
-    }
-    rotate_points_inplace(pts, y.center, y.orientation);
-    for (int i = 0; i < 12; i++) {
-      ls[i].a = pts[2*i];
-      ls[i].b = pts[2*i+1];
-    }
+  // clip to the slab between the end planes
+  for (size_t i = 0; i < n_pts; i++) {
+    if (fabs(pts[i].z) <= e) clipped[n++] = Vec3(pts[i].x, pts[i].y, 0);
   }
-
-  for (int i = 0; i < 12; i++) {
-    LineSegment l = ls[i];
-
-    Vec3 d = l.b - l.a;
-
-    double denom = (d.x*d.x) + (d.y*d.y);
-    if (abs(denom) < APPROX)
-      continue;
-    double det = ((y.r*y.r) * (d.x*d.x))
-               + ((y.r*y.r) * (d.y*d.y))
-               - ((d.x*d.x) * (l.a.y*l.a.y))
-               - ((d.y*d.y) * (l.a.x*l.a.x))
-               + (2*d.x*d.y*l.a.x*l.a.y);
-    if (det - APPROX <= 0)
-      continue;
-
-    det = sqrt(det);
-
-    double
-      num = -(d.x*l.a.x) - (d.y*l.a.y),
-      t1  = (num + det) / denom,
-      t2  = (num - det) / denom;
-
-    if (t1 >= 0 && t1 <= 1) {
-      double z = l.a.z + (t1 * d.z);
-      if (abs(z) < y.e) {
-        DEBUG_COUT("t1 solution found.")
-        DEBUG_LEAVE;
-        return true;
+  for (size_t i = 0; i < n_segments; i++) {
+    const Vec3
+      &a = pts[segments[i][0]],
+      &b = pts[segments[i][1]];
+    const double planes[2] = { -e, e };
+    for (size_t j = 0; j < 2; j++) {
+      if ((a.z - planes[j]) * (b.z - planes[j]) < 0) {
+        const double t = (planes[j] - a.z) / (b.z - a.z);
+        clipped[n++] = Vec3(a.x + t*(b.x - a.x), a.y + t*(b.y - a.y), 0);
       }
     }
+  }
 
-    if (t2 >= 0 && t2 <= 1) {
-      double z = l.a.z + (t2 * d.z);
-      if (abs(z) < y.e) {
-        DEBUG_COUT("t2 solution found.")
-        DEBUG_LEAVE;
-        return true;
-      }
-    }
+  if (n == 0) {
+    DEBUG_COUT("Entirely above or below the cylinder.");
+    DEBUG_LEAVE;
+    return false;
+  }
+
+  // furthest point is a vertex, if it's inside the radius so is everything
+  double max2 = 0;
+  for (size_t i = 0; i < n; i++) {
+    max2 = max(max2, norm2(clipped[i]));
+  }
+  if (max2 < r*r) {
+    DEBUG_COUT("Inside the cylinder, not touching the side.");
+    DEBUG_LEAVE;
+    return false;
+  }
 
+  // closest point: build the hull of the projection (monotone chain), then the origin is inside or closest to an edge
+  sort(clipped.begin(), clipped.begin() + n, [](const Vec3& a, const Vec3& b) {
+    return a.x < b.x || (a.x == b.x && a.y < b.y);
+  });
+  array<Vec3, 2*CYL_MAX_CLIP_POINTS> hull;
+  size_t k = 0;
+  for (size_t i = 0; i < n; i++) {
+    while (k >= 2 && _cross2(hull[k-2], hull[k-1], clipped[i]) <= 0) k--;
+    hull[k++] = clipped[i];
+  }
+  const size_t lower = k + 1;
+  for (size_t i = n - 1; i > 0; i--) {
+    while (k >= lower && _cross2(hull[k-2], hull[k-1], clipped[i-1]) <= 0) k--;
+    hull[k++] = clipped[i-1];
   }
-  
-  DEBUG_COUT("No collision found.");
+  if (k > 1) k--;  // last point is the first one again
+
+  const Vec3 origin = Vec3::zero();
+  bool inside = k >= 3;
+  double min2 = norm2(hull[0]);
+  for (size_t i = 0; i < k; i++) {
+    const Vec3 &a = hull[i], &b = hull[(i+1) % k];
+    if (_cross2(a, b, origin) < 0) inside = false;
+    min2 = min(min2, _origin_dist2(a, b));
+  }
+
+  const bool ret = inside || min2 <= r*r;
+  DEBUG_COUT("Closest point at " << (inside ? 0.0 : sqrt(min2)) << ", furthest at " << sqrt(max2) << ", radius " << r);
   DEBUG_LEAVE;
-  return false;
+  return ret;
+}
+
+
+// Checks for intersections between a prism and the **side** of a cylinder. Does not check ends of the cylinder.
+// The prism is clipped to the cylinder's end planes and projected onto its cross section. This is exact.
+bool intersect(Prism x, Cylinder y) {
+  const Quaternion inv = inverse(y.orientation);
+  array<Vec3, 8> pts = x.vertexes();
+  for (size_t i = 0; i < 8; i++) {
+    pts[i] = rotate_point(pts[i], y.center, inv) - y.center;
+  }
+
+  // same order as Prism::edges
+  static const uint8_t edges[12][2] = {
+    {0, 4}, {0, 1}, {4, 5},
+    {1, 5}, {1, 2}, {5, 6},
+    {2, 6}, {2, 3}, {6, 7},
+    {3, 7}, {3, 0}, {7, 4}
+  };
+
+  return _cylinder_side_intersect(pts.data(), 8, edges, 12, y.r, y.e);
 }
 
 
@@ -0,0 +1,440 @@
+#include "mesh.hpp"
+#include <map>
+#include <deque>
+#include <tuple>
+#include <limits>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+
+
+using namespace std;
+
+
+namespace MeshImport {
+
+
+string error_message(ErrorType e) {
+  switch (e) {
+    case NoError:
+      return "";
+    case FileError:
+      return "Could not read mesh file.";
+    case UnknownFormat:
+      return "Unknown mesh format, expected .stl or .obj.";
+    case ParseError:
+      return "Mesh file is malformed.";
+    case EmptyMesh:
+      return "Mesh contains no triangles.";
+    case CacheMiss:
+      return "No valid decomposition cache for this mesh.";
+    case CacheWriteError:
+      return "Could not write decomposition cache.";
+    default:
+      return "Error in decoding error type: invalid enumeration value.";
+  }
+}
+
+
+bool _read_file(const string& path, string& dst) {
+  ifstream f(path, ios::in | ios::binary);
+  if (!f) return false;
+  ostringstream ss;
+  ss << f.rdbuf();
+  dst = ss.str();
+  return !f.bad();
+}
+
+
+// merges exactly coincident vertexes, which STL repeats for every triangle
+typedef map<tuple<double, double, double>, uint32_t> _VertexMap;
+
+uint32_t _add_vertex(TriangleMesh& mesh, _VertexMap& seen, const Vec3& v) {
+  const auto key = make_tuple(v.x, v.y, v.z);
+  const auto it  = seen.find(key);
+  if (it != seen.end()) return it->second;
+  const uint32_t idx = mesh.vertexes.size();
+  mesh.vertexes.push_back(v);
+  seen[key] = idx;
+  return idx;
+}
+
+
+MeshResult load_stl(const string& path, double scale) {
+  DEBUG_ENTER(__PRETTY_FUNCTION__);
+  string data;
+  if (!_read_file(path, data)) {
+    DEBUG_LEAVE;
+    return FileError;
+  }
+
+  TriangleMesh mesh;
+  _VertexMap seen;
+
+  // binary files may also start with "solid", so go by the size the header claims instead
+  uint32_t n = 0;
+  if (data.size() >= 84) memcpy(&n, data.data() + 80, sizeof(n));
+
+  if (data.size() >= 84 && data.size() == 84 + 50 * (size_t)n) {
+    DEBUG_COUT("Binary STL with " << n << " triangles.");
+    for (uint32_t t = 0; t < n; t++) {
+      // 12 floats (normal, 3 vertexes) then a 2 byte attribute count
+      float f[12];
+      memcpy(f, data.data() + 84 + 50 * (size_t)t, sizeof(f));
+      TriIdx tri;
+      for (size_t k = 0; k < 3; k++) {
+        tri[k] = _add_vertex(mesh, seen, scale * Vec3(f[3 + 3*k], f[4 + 3*k], f[5 + 3*k]));
+      }
+      mesh.triangles.push_back(tri);
+    }
+  } else {
+    DEBUG_COUT("ASCII STL.");
+    istringstream ss(data);
+    string tok;
+    TriIdx tri;
+    size_t k = 0;
+    while (ss >> tok) {
+      if (tok != "vertex") continue;
+      double x, y, z;
+      if (!(ss >> x >> y >> z)) {
+        DEBUG_LEAVE;
+        return ParseError;
+      }
+      tri[k++] = _add_vertex(mesh, seen, scale * Vec3(x, y, z));
+      if (k == 3) {
+        mesh.triangles.push_back(tri);
+        k = 0;
+      }
+    }
+    if (k != 0) {
+      DEBUG_LEAVE;
+      return ParseError;
+    }
+  }
+
+  DEBUG_LEAVE;
+  if (mesh.triangles.empty()) return EmptyMesh;
+  return mesh;
+}
+
+
+MeshResult load_obj(const string& path, double scale) {
+  DEBUG_ENTER(__PRETTY_FUNCTION__);
+  string data;
+  if (!_read_file(path, data)) {
+    DEBUG_LEAVE;
+    return FileError;
+  }
+
+  TriangleMesh mesh;
+  istringstream lines(data);
+  string line;
+  vector<uint32_t> face;
+
+  while (getline(lines, line)) {
+    istringstream ss(line);
+    string kind;
+    if (!(ss >> kind)) continue;
+
+    if (kind == "v") {
+      double x, y, z;
+      if (!(ss >> x >> y >> z)) {
+        DEBUG_LEAVE;
+        return ParseError;
+      }
+      mesh.vertexes.push_back(scale * Vec3(x, y, z));
+    }
+    else if (kind == "f") {
+      // entries look like v, v/vt, v//vn or v/vt/vn; indexes are 1-based, negative ones count from the end
+      face.clear();
+      string entry;
+      while (ss >> entry) {
+        long idx = strtol(entry.c_str(), NULL, 10);
+        if (idx < 0) idx += mesh.vertexes.size() + 1;
+        if (idx < 1 || idx > (long)mesh.vertexes.size()) {
+          DEBUG_LEAVE;
+          return ParseError;
+        }
+        face.push_back(idx - 1);
+      }
+      if (face.size() < 3) {
+        DEBUG_LEAVE;
+        return ParseError;
+      }
+      for (size_t k = 1; k + 1 < face.size(); k++) {
+        mesh.triangles.push_back({{ face[0], face[k], face[k + 1] }});
+      }
+    }
+    // everything else (normals, texture coordinates, groups, materials) does not matter for collisions
+  }
+
+  DEBUG_LEAVE;
+  if (mesh.triangles.empty()) return EmptyMesh;
+  return mesh;
+}
+
+
+MeshResult load_mesh(const string& path, double scale) {
+  const auto dot_pos = path.rfind('.');
+  if (dot_pos == string::npos) return UnknownFormat;
+
+  string ext = path.substr(dot_pos + 1);
+  transform(ext.begin(), ext.end(), ext.begin(), ::tolower);
+
+  if (ext == "stl") return load_stl(path, scale);
+  if (ext == "obj") return load_obj(path, scale);
+  return UnknownFormat;
+}
+
+
+/* Decomposition */
+
+
+typedef struct _Part {
+  vector<uint32_t> triangles;
+  uint32_t         depth;
+} _Part;
+
+
+Vec3 _tri_centroid(const TriangleMesh& mesh, uint32_t t) {
+  const TriIdx& tri = mesh.triangles[t];
+  return (mesh.vertexes[tri[0]] + mesh.vertexes[tri[1]] + mesh.vertexes[tri[2]]) / 3.0;
+}
+
+
+// A part is convex enough when its hull hugs its surface from both sides:
+//  - no point of the surface lies deeper than `tol` inside the hull (catches notches and inner walls), and
+//  - no hull face is further than `tol` from the surface (catches open shells, like the tank without a lid,
+//    whose surface is all on the hull but which is hollow)
+bool _needs_split(const TriangleMesh& mesh, const _Part& part, const ConvexPiece& piece, double tol) {
+  vector<Vec3>   n;
+  vector<double> d;
+  n.reserve(piece.faces.size());
+  d.reserve(piece.faces.size());
+  const auto& v = piece.hull.vertexes;
+  for (size_t i = 0; i < piece.faces.size(); i++) {
+    const TriIdx& f = piece.faces[i];
+    n.push_back(normalized(cross(v[f[1]] - v[f[0]], v[f[2]] - v[f[0]])));
+    d.push_back(dot(n.back(), v[f[0]]));
+  }
+
+  for (size_t t = 0; t < part.triangles.size(); t++) {
+    const TriIdx& tri = mesh.triangles[part.triangles[t]];
+    const Vec3 samples[4] = {
+      mesh.vertexes[tri[0]], mesh.vertexes[tri[1]], mesh.vertexes[tri[2]],
+      _tri_centroid(mesh, part.triangles[t])
+    };
+    for (size_t s = 0; s < 4; s++) {
+      double depth = numeric_limits<double>::infinity();
+      for (size_t i = 0; i < n.size(); i++) {
+        depth = min(depth, d[i] - dot(n[i], samples[s]));
+      }
+      if (depth > tol) return true;
+    }
+  }
+
+  const double tol2 = tol * tol;
+  for (size_t i = 0; i < piece.faces.size(); i++) {
+    const TriIdx& f = piece.faces[i];
+    const Vec3 c = (v[f[0]] + v[f[1]] + v[f[2]]) / 3.0;
+    bool covered = false;
+    for (size_t t = 0; t < part.triangles.size() && !covered; t++) {
+      const TriIdx& tri = mesh.triangles[part.triangles[t]];
+      covered = norm2(closest_point(c, mesh.vertexes[tri[0]], mesh.vertexes[tri[1]], mesh.vertexes[tri[2]]) - c) <= tol2;
+    }
+    if (!covered) return true;
+  }
+  return false;
+}
+
+
+ConvexPiece _part_hull(const TriangleMesh& mesh, const _Part& part, vector<uint32_t>& marker, uint32_t stamp) {
+  vector<Vec3> pts;
+  for (size_t t = 0; t < part.triangles.size(); t++) {
+    const TriIdx& tri = mesh.triangles[part.triangles[t]];
+    for (size_t k = 0; k < 3; k++) {
+      if (marker[tri[k]] != stamp) {
+        marker[tri[k]] = stamp;
+        pts.push_back(mesh.vertexes[tri[k]]);
+      }
+    }
+  }
+  return convex_hull(pts);
+}
+
+
+vector<ConvexPiece> decompose(const TriangleMesh& mesh, const DecompositionParams& params) {
+  DEBUG_ENTER(__PRETTY_FUNCTION__);
+  vector<ConvexPiece> pieces;
+  if (mesh.triangles.empty()) {
+    DEBUG_LEAVE;
+    return pieces;
+  }
+
+  // breadth first, so that hitting max_pieces leaves parts of similar size
+  deque<_Part> todo;
+  todo.push_back(_Part());
+  todo.front().depth = 0;
+  todo.front().triangles.reserve(mesh.triangles.size());
+  for (uint32_t t = 0; t < mesh.triangles.size(); t++) {
+    todo.front().triangles.push_back(t);
+  }
+
+  vector<uint32_t> marker(mesh.vertexes.size(), 0);
+  uint32_t stamp = 0;
+
+  while (!todo.empty()) {
+    _Part part = todo.front();
+    todo.pop_front();
+
+    auto piece = _part_hull(mesh, part, marker, ++stamp);
+
+    const bool final =
+      part.depth >= params.max_depth
+      || part.triangles.size() <= 1
+      || pieces.size() + todo.size() + 2 > params.max_pieces
+      || !_needs_split(mesh, part, piece, params.concavity);
+
+    if (final) {
+      pieces.push_back(piece);
+      continue;
+    }
+
+    // split at the median triangle along the widest axis of the triangle centres
+    vector<Vec3> centres;
+    centres.reserve(part.triangles.size());
+    for (size_t t = 0; t < part.triangles.size(); t++) {
+      centres.push_back(_tri_centroid(mesh, part.triangles[t]));
+    }
+    const Vec3 e = widths(bounds(centres));
+    const int axis = (e.x >= e.y && e.x >= e.z) ? 0 : (e.y >= e.z ? 1 : 2);
+
+    const size_t half = part.triangles.size() / 2;
+    nth_element(part.triangles.begin(), part.triangles.begin() + half, part.triangles.end(), [&mesh, axis](uint32_t l, uint32_t r) {
+      return _tri_centroid(mesh, l)[axis] < _tri_centroid(mesh, r)[axis];
+    });
+
+    _Part lo, hi;
+    lo.depth = hi.depth = part.depth + 1;
+    lo.triangles.assign(part.triangles.begin(), part.triangles.begin() + half);
+    hi.triangles.assign(part.triangles.begin() + half, part.triangles.end());
+    todo.push_back(lo);
+    todo.push_back(hi);
+  }
+
+  DEBUG_COUT("Decomposed " << mesh.triangles.size() << " triangles into " << pieces.size() << " convex pieces.");
+  DEBUG_LEAVE;
+  return pieces;
+}
+
+
+/* Cache */
+
+
+// FNV-1a
+void _hash_bytes(uint64_t& h, const void* data, size_t size) {
+  const unsigned char* p = (const unsigned char*)data;
+  for (size_t i = 0; i < size; i++) {
+    h ^= p[i];
+    h *= 1099511628211ULL;
+  }
+}
+
+
+uint64_t mesh_hash(const string& path, const DecompositionParams& params) {
+  uint64_t h = 14695981039346656037ULL;
+  string data;
+  _read_file(path, data);
+
+  const uint32_t version = MESH_CACHE_VERSION;
+  _hash_bytes(h, &version, sizeof(version));
+  _hash_bytes(h, data.data(), data.size());
+  _hash_bytes(h, &params.scale, sizeof(params.scale));
+  _hash_bytes(h, &params.concavity, sizeof(params.concavity));
+  _hash_bytes(h, &params.max_depth, sizeof(params.max_depth));
+  _hash_bytes(h, &params.max_pieces, sizeof(params.max_pieces));
+  return h;
+}
+
+
+// Cache format (text):
+//   ptf-cvx <version> <hash>
+//   <number of pieces>
+//   then for each piece the number of hull vertexes followed by one vertex per line.
+// Only the hull vertexes are stored; rebuilding the hull from those is cheap compared to the decomposition.
+DecompositionResult read_cache(const string& cache_path, uint64_t hash) {
+  ifstream f(cache_path);
+  if (!f) return CacheMiss;
+
+  string magic;
+  uint32_t version;
+  uint64_t file_hash;
+  size_t n_pieces;
+  if (!(f >> magic >> version >> hex >> file_hash >> dec >> n_pieces)) return CacheMiss;
+  if (magic != "ptf-cvx" || version != MESH_CACHE_VERSION || file_hash != hash) return CacheMiss;
+
+  vector<ConvexPiece> pieces;
+  pieces.reserve(n_pieces);
+  for (size_t i = 0; i < n_pieces; i++) {
+    size_t n_vertexes;
+    if (!(f >> n_vertexes)) return CacheMiss;
+    vector<Vec3> pts(n_vertexes);
+    for (size_t j = 0; j < n_vertexes; j++) {
+      if (!(f >> pts[j].x >> pts[j].y >> pts[j].z)) return CacheMiss;
+    }
+    pieces.push_back(convex_hull(pts));
+  }
+  return pieces;
+}
+
+
+ErrorType write_cache(const string& cache_path, uint64_t hash, const vector<ConvexPiece>& pieces) {
+  FILE* f = fopen(cache_path.c_str(), "w");
+  if (!f) return CacheWriteError;
+
+  bool ok = fprintf(f, "ptf-cvx %u %llx\n%zu\n", MESH_CACHE_VERSION, (unsigned long long)hash, pieces.size()) > 0;
+  for (size_t i = 0; i < pieces.size() && ok; i++) {
+    const auto& v = pieces[i].hull.vertexes;
+    ok = fprintf(f, "%zu\n", v.size()) > 0;
+    for (size_t j = 0; j < v.size() && ok; j++) {
+      ok = fprintf(f, "%.17g %.17g %.17g\n", v[j].x, v[j].y, v[j].z) > 0;
+    }
+  }
+  ok = (fclose(f) == 0) && ok;
+  return ok ? NoError : CacheWriteError;
+}
+
+
+BVHResult load_collision_mesh(const string& path, const DecompositionParams& params, const string& cache_path) {
+  DEBUG_ENTER(__PRETTY_FUNCTION__);
+  const string cache = cache_path.empty() ? path + MESH_CACHE_EXT : cache_path;
+  const uint64_t hash = mesh_hash(path, params);
+
+  auto cached = read_cache(cache, hash);
+  if (boost::get<vector<ConvexPiece>>(&cached)) {
+    DEBUG_COUT("Using cached decomposition " << cache);
+    DEBUG_LEAVE;
+    return build_bvh(boost::get<vector<ConvexPiece>>(cached));
+  }
+
+  auto mesh = load_mesh(path, params.scale);
+  if (const ErrorType* e = boost::get<ErrorType>(&mesh)) {
+    DEBUG_COUT("Could not load mesh: " << error_message(*e));
+    DEBUG_LEAVE;
+    return *e;
+  }
+
+  const auto pieces = decompose(boost::get<TriangleMesh>(mesh), params);
+  if (write_cache(cache, hash, pieces) != NoError) {
+    DEBUG_COUT("Could not write decomposition cache " << cache);
+  }
+
+  DEBUG_LEAVE;
+  return build_bvh(pieces);
+}
+
+
+}
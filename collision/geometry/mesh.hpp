@@ -0,0 +1,97 @@
+#ifndef __MESH
+#define __MESH
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <boost/variant.hpp>
+#include "geom.hpp"
+#include "hull.hpp"
+#include "bvh.hpp"
+
+
+// Triangle mesh import (STL/OBJ of the tank, PMT cover, supports, ...) and approximate convex decomposition.
+//
+// The decomposition splits the mesh surface recursively until the convex hull of every part hugs the part itself,
+//    so concave models (e.g. the inside of the tank) are not swallowed by a single hull like the hand-made primitives.
+// Decomposition is slow for large meshes, so results are cached on disk next to the mesh and reused as long as
+//    the mesh file and the parameters are unchanged.
+
+
+// version of the cache file format; bump when it changes so old caches are ignored
+#define MESH_CACHE_VERSION 1
+// extension appended to the mesh path for the default cache location
+#define MESH_CACHE_EXT ".cvx"
+
+
+typedef struct TriangleMesh {
+  std::vector<Vec3>   vertexes;
+  std::vector<TriIdx> triangles;
+} TriangleMesh;
+
+
+typedef struct DecompositionParams {
+  double   scale;       // multiplies all coordinates in the file, e.g. 0.001 for CAD exports in mm
+  double   concavity;   // [m] a part is split while its hull strays further than this from its surface
+  uint32_t max_depth;   // maximum number of times the mesh is split
+  uint32_t max_pieces;  // stop splitting once there are this many parts
+} DecompositionParams;
+
+
+// 2 mm, which is well below the "for safety" padding used on the hand-made geometry
+static const DecompositionParams DEFAULT_DECOMPOSITION = { 1.0, 0.002, 12, 512 };
+
+
+namespace MeshImport {
+
+
+enum ErrorType {
+  NoError,
+  FileError,      // could not open or read the file
+  UnknownFormat,  // not .stl or .obj
+  ParseError,
+  EmptyMesh,
+  CacheMiss,      // no cache, or cache is for a different mesh/parameters
+  CacheWriteError
+};
+
+
+typedef boost::variant<TriangleMesh, ErrorType> MeshResult;
+typedef boost::variant<std::vector<ConvexPiece>, ErrorType> DecompositionResult;
+typedef boost::variant<BVH, ErrorType> BVHResult;
+
+
+std::string error_message(ErrorType e);
+
+
+// `scale` multiplies all coordinates
+MeshResult load_stl(const std::string& path, double scale = 1.0);  // ASCII or binary
+MeshResult load_obj(const std::string& path, double scale = 1.0);  // polygons are fan triangulated
+MeshResult load_mesh(const std::string& path, double scale = 1.0);  // dispatched by extension
+
+
+// approximate convex decomposition; pieces cover the whole mesh surface
+std::vector<ConvexPiece> decompose(const TriangleMesh& mesh, const DecompositionParams& params = DEFAULT_DECOMPOSITION);
+
+
+// cache key for a mesh file and parameters; changes whenever either does
+uint64_t mesh_hash(const std::string& path, const DecompositionParams& params);
+
+DecompositionResult read_cache(const std::string& cache_path, uint64_t hash);
+ErrorType           write_cache(const std::string& cache_path, uint64_t hash, const std::vector<ConvexPiece>& pieces);
+
+
+// Loads a mesh, decomposes it (or reads the cached decomposition) and builds its BVH.
+// If cache_path is empty the cache is kept at path + MESH_CACHE_EXT.
+// Failure to write the cache is not an error, the decomposition is still returned.
+BVHResult load_collision_mesh(
+  const std::string& path,
+  const DecompositionParams& params = DEFAULT_DECOMPOSITION,
+  const std::string& cache_path = ""
+);
+
+
+}
+
+
+#endif
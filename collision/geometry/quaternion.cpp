@@ -1,12 +1,8 @@
 #include "quaternion.hpp"
 
 
-// constructors
+// constructors and arithmetic are inline in quaternion.hpp
 
-Quaternion::Quaternion() : w(0), x(0), y(0), z(0) {}
-
-Quaternion::Quaternion(double _w, double _x, double _y, double _z)
-:  w(_w), x(_x), y(_y), z(_z) {}
 
 void Quaternion::normalize() {
   double inorm = 1/norm(this);
@@ -20,14 +16,6 @@ Quaternion Quaternion::normalized() const {
   return (1/norm(this)) * *this;
 }
 
-Quaternion Quaternion::identity() {
-  return Quaternion(1, 0, 0, 0);
-}
-
-Quaternion Quaternion::from_vec3(const Vec3& vec) {
-  return Quaternion(0, vec.x, vec.y, vec.z);
-}
-
 Quaternion Quaternion::from_axis_angle(const Vec3& axis, double angle) {
   double sin2 = sin(angle/2);
   return Quaternion(cos(angle/2), sin2*axis.x, sin2*axis.y, sin2*axis.z);
@@ -52,62 +40,6 @@ Quaternion Quaternion::from_azimuthal(double theta) {
 }
 
 
-// constexpr Quaternion Quaternion::identity()  {
-// }
-
-Quaternion Quaternion::basis_real() {
-  return Quaternion(1, 0, 0, 0);
-}
-
-Quaternion Quaternion::basis_i() {
-  return Quaternion(0, 1, 0, 0);
-}
-
-Quaternion Quaternion::basis_j() {
-  return Quaternion(0, 0, 1, 0);
-}
-
-Quaternion Quaternion::basis_k() {
-  return Quaternion(0, 0, 0, 1);
-}
-
-
-// operators
-
-
-Quaternion operator+(const Quaternion& q1, const Quaternion& q2) {
-  return Quaternion(q1.w + q2.w, q1.x + q2.x, q1.y + q2.y, q1.z + q2.z);
-}
-
-
-Quaternion operator-(const Quaternion& q1, const Quaternion& q2) {
-  return Quaternion(q1.w - q2.w, q1.x - q2.x, q1.y - q2.y, q1.z - q2.z);
-}
-
-
-Quaternion operator*(const Quaternion& q1, const Quaternion& q2) {
-  return Quaternion(
-    (q1.w * q2.w) - (q1.x * q2.x) - (q1.y * q2.y) - (q1.z * q2.z),
-    (q1.w * q2.x) + (q1.x * q2.w) + (q1.y * q2.z) - (q1.z * q2.y),
-    (q1.w * q2.y) - (q1.x * q2.z) + (q1.y * q2.w) + (q1.z * q2.x),
-    (q1.w * q2.z) + (q1.x * q2.y) - (q1.y * q2.x) + (q1.z * q2.w)
-  );
-}
-
-
-Quaternion operator/(const Quaternion& q1, const Quaternion& q2) {
-  return q1 * inverse(q2);
-}
-
-Quaternion operator*(const Quaternion& q, const double lambda) {
-  return Quaternion(lambda*q.w, lambda*q.x, lambda*q.y, lambda*q.z);
-}
-
-Quaternion operator*(const double lambda, const Quaternion& q) {
-  return Quaternion(lambda*q.w, lambda*q.x, lambda*q.y, lambda*q.z);
-}
-
-
 // funcs
 
 
@@ -116,16 +48,6 @@ bool is_versor(const Quaternion& q) {
 }
 
 
-double scalar_part(const Quaternion& q) {
-  return q.w;
-}
-
-
-Vec3 vector_part(const Quaternion& q) {
-  return Vec3(q.x, q.y, q.z);
-}
-
-
 Vec3 axis(const Quaternion& q) {
   return Vec3(
     q.x / sqrt(1 - q.w*q.w),
@@ -140,33 +62,6 @@ double angle(const Quaternion& q) {
 }
 
 
-Quaternion hamilton_product(const Quaternion& q1, const Quaternion& q2) {
-  return q1 * q2;
-}
-
-
-double dot(const Quaternion& q1, const Quaternion& q2) {
-  return (q1.w * q2.w) + (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z);
-}
-
-
-double norm(const Quaternion& q) {
-  return sqrt((q.w*q.w) + (q.x*q.x) + (q.y*q.y) + (q.z*q.z));
-}
-
-
-double norm(const Quaternion* q) {
-  if (q == NULL) return nan("");
-  return sqrt((q->w*q->w) + (q->x*q->x) + (q->y*q->y) + (q->z*q->z));
-}
-
-
-Quaternion inverse(const Quaternion& q) {
-  double _norm = norm(q);
-  return (1/(_norm*_norm)) * Quaternion(q.w, -q.x, -q.y, -q.z);
-}
-
-
 Quaternion conjugate(const Quaternion& q) {
   return -0.5 * (
      q + 
@@ -11,48 +11,96 @@ typedef struct Quaternion {
   double y;
   double z;
 
-  Quaternion();
-  Quaternion(double _w, double _x, double _y, double _z);
+  constexpr Quaternion() : w(0), x(0), y(0), z(0) {}
+  constexpr Quaternion(double _w, double _x, double _y, double _z) : w(_w), x(_x), y(_y), z(_z) {}
 
   void normalize();
   Quaternion normalized() const;
 
-  static Quaternion from_vec3(const Vec3& vec);
+  static constexpr Quaternion from_vec3(const Vec3& vec) { return Quaternion(0, vec.x, vec.y, vec.z); }
   static Quaternion from_axis_angle(const Vec3& axis, double angle);
   static Quaternion from_spherical_angle(double theta, double phi);
   static Quaternion from_azimuthal(double theta);
 
-  static Quaternion identity();
-  static Quaternion basis_real();
-  static Quaternion basis_i();
-  static Quaternion basis_j();
-  static Quaternion basis_k();
+  static constexpr Quaternion identity()   { return Quaternion(1, 0, 0, 0); }
+  static constexpr Quaternion basis_real() { return Quaternion(1, 0, 0, 0); }
+  static constexpr Quaternion basis_i()    { return Quaternion(0, 1, 0, 0); }
+  static constexpr Quaternion basis_j()    { return Quaternion(0, 0, 1, 0); }
+  static constexpr Quaternion basis_k()    { return Quaternion(0, 0, 0, 1); }
 } Quaternion;
 
 
-Quaternion operator+(const Quaternion& q1, const Quaternion& q2);
-Quaternion operator-(const Quaternion& q1, const Quaternion& q2);
-Quaternion operator*(const Quaternion& q1, const Quaternion& q2);  // Hamilton product
-Quaternion operator/(const Quaternion& q1, const Quaternion& q2);  // mult. inv. resp. Hamilton product
+// The arithmetic is defined here so it can be inlined (see vec3.hpp); anything with trig stays in quaternion.cpp.
 
-Quaternion operator*(const Quaternion& q, const double lambda);
-Quaternion operator*(const double lambda, const Quaternion& q);
+
+constexpr Quaternion operator+(const Quaternion& q1, const Quaternion& q2) {
+  return Quaternion(q1.w + q2.w, q1.x + q2.x, q1.y + q2.y, q1.z + q2.z);
+}
+
+constexpr Quaternion operator-(const Quaternion& q1, const Quaternion& q2) {
+  return Quaternion(q1.w - q2.w, q1.x - q2.x, q1.y - q2.y, q1.z - q2.z);
+}
+
+// Hamilton product
+constexpr Quaternion operator*(const Quaternion& q1, const Quaternion& q2) {
+  return Quaternion(
+    (q1.w * q2.w) - (q1.x * q2.x) - (q1.y * q2.y) - (q1.z * q2.z),
+    (q1.w * q2.x) + (q1.x * q2.w) + (q1.y * q2.z) - (q1.z * q2.y),
+    (q1.w * q2.y) - (q1.x * q2.z) + (q1.y * q2.w) + (q1.z * q2.x),
+    (q1.w * q2.z) + (q1.x * q2.y) - (q1.y * q2.x) + (q1.z * q2.w)
+  );
+}
+
+constexpr Quaternion operator*(const Quaternion& q, const double lambda) {
+  return Quaternion(lambda*q.w, lambda*q.x, lambda*q.y, lambda*q.z);
+}
+
+constexpr Quaternion operator*(const double lambda, const Quaternion& q) {
+  return Quaternion(lambda*q.w, lambda*q.x, lambda*q.y, lambda*q.z);
+}
+
+constexpr double scalar_part(const Quaternion& q) {
+  return q.w;
+}
+
+constexpr Vec3 vector_part(const Quaternion& q) {
+  return Vec3(q.x, q.y, q.z);
+}
+
+constexpr Quaternion hamilton_product(const Quaternion& q1, const Quaternion& q2) {
+  return q1 * q2;
+}
+
+constexpr double dot(const Quaternion& q1, const Quaternion& q2) {
+  return (q1.w * q2.w) + (q1.x * q2.x) + (q1.y * q2.y) + (q1.z * q2.z);
+}
+
+inline double norm(const Quaternion& q) {
+  return sqrt((q.w*q.w) + (q.x*q.x) + (q.y*q.y) + (q.z*q.z));
+}
+
+inline double norm(const Quaternion* q) {
+  if (q == NULL) return nan("");
+  return sqrt((q->w*q->w) + (q->x*q->x) + (q->y*q->y) + (q->z*q->z));
+}
+
+// mult. inv. resp. Hamilton product
+inline Quaternion inverse(const Quaternion& q) {
+  double _norm = norm(q);
+  return (1/(_norm*_norm)) * Quaternion(q.w, -q.x, -q.y, -q.z);
+}
+
+inline Quaternion operator/(const Quaternion& q1, const Quaternion& q2) {
+  return q1 * inverse(q2);
+}
 
 
 bool       is_versor(const Quaternion& q);
-double     scalar_part(const Quaternion& q);
-Vec3       vector_part(const Quaternion& q);
 Vec3       axis(const Quaternion& q);
 double     angle(const Quaternion& q);  // radians
-double     norm(const Quaternion& q);
-double     norm(const Quaternion* q);
-Quaternion hamilton_product(const Quaternion& q1, const Quaternion& q2);
-double     dot(const Quaternion& q1, const Quaternion& q2);
 // Quaternion pow(const Quaternion& q, int p);
 // Quaternion pow(const Quaternion& q, double p, size_t n = 10);
-Quaternion inverse(const Quaternion& q);
 Quaternion conjugate(const Quaternion& q);
 Quaternion slerp(Quaternion q1, Quaternion q2, double t);
 
-
 #endif
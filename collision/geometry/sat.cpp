@@ -222,7 +222,7 @@ void project(const Vec3& direction, const vector<Vec3>& to_project, vector<doubl
   dst.reserve(to_project.size());
 
   for (size_t i = 0; i < to_project.size(); i++) {
-    dst[i] = project(direction, to_project[i]);
+    dst.push_back(project(direction, to_project[i]));
   }
 }
 
@@ -294,37 +294,70 @@ bool intersect(const ConvexPolygon& poly1, const ConvexPolygon& poly2) {
 }
 
 
+// cheap and conservative: only the polyhedron's face normals are tried, so this can miss a separation but never
+// reports one that isn't there (unlike intersect(Sphere, ConvexPolyhedron), which only looks at vertexes and edges)
+bool _separated_by_normals(const Sphere& s, const ConvexPolyhedron& p) {
+  for (size_t i = 0; i < p.normals.size(); i++) {
+    const Vec3 n = normalized(p.normals[i]);
+    double max_proj = dot(n, p.vertexes[0]);
+    for (size_t j = 1; j < p.vertexes.size(); j++) {
+      max_proj = max(max_proj, dot(n, p.vertexes[j]));
+    }
+    if (dot(n, s.center) - s.r > max_proj) return true;
+  }
+  return false;
+}
+
+
 bool intersect(const ConvexPolyhedron& polyh1, const ConvexPolyhedron& polyh2) {
+  Vec3 axis = Vec3::zero();
+  return intersect(polyh1, polyh2, &axis);
+}
+
+
+bool intersect(const ConvexPolyhedron& polyh1, const ConvexPolyhedron& polyh2, Vec3* axis) {
+  // the previous separating axis is the most likely one, and a single projection
+  if (norm2(*axis) > 0 && separated(polyh1.vertexes, polyh2.vertexes, *axis)) return false;
+
   const auto num_axes = polyh1.normals.size() + polyh2.normals.size() + polyh1.edges.size()*polyh2.edges.size();
   if (num_axes >= NUM_AXES_FOR_BOUNDS_CHECK && !intersect(bounding_sphere(polyh1), bounding_sphere(polyh2))) {
     return false;
   }
   else if (num_axes >= NUM_AXES_FOR_PAIRWISE && (
-    !intersect(bounding_sphere(polyh1), polyh2)
-    || !intersect(bounding_sphere(polyh2), polyh1)
+    _separated_by_normals(bounding_sphere(polyh1), polyh2)
+    || _separated_by_normals(bounding_sphere(polyh2), polyh1)
   )) {
     return false;
   }
   
   for (size_t i = 0; i < polyh1.normals.size(); i++) {
     auto normal = polyh1.normals[i];
-    if (separated(polyh1.vertexes, polyh2.vertexes, normal)) return false;
+    if (separated(polyh1.vertexes, polyh2.vertexes, normal)) {
+      *axis = normal;
+      return false;
+    }
   }
   for (size_t i = 0; i < polyh2.normals.size(); i++) {
     auto normal = polyh2.normals[i];
-    if (separated(polyh1.vertexes, polyh2.vertexes, normal)) return false;
+    if (separated(polyh1.vertexes, polyh2.vertexes, normal)) {
+      *axis = normal;
+      return false;
+    }
   }
   for (size_t i = 0; i < polyh1.edges.size(); i++) {
     auto edge1 = polyh1.edges[i];
     Vec3 dir1  = (polyh1.vertexes[edge1.second] - polyh1.vertexes[edge1.first]);
 
     for (size_t j = 0; j < polyh2.edges.size(); j++) {
-      auto edge2 = polyh2.edges[i];
+      auto edge2 = polyh2.edges[j];
       Vec3 dir2  = (polyh2.vertexes[edge2.second] - polyh2.vertexes[edge2.first]);
       
       auto dir = cross(dir1, dir2);
 
-      if (separated(polyh1.vertexes, polyh2.vertexes, dir)) return false;
+      if (separated(polyh1.vertexes, polyh2.vertexes, dir)) {
+        *axis = dir;
+        return false;
+      }
     }
   }
   return true;
@@ -82,6 +82,8 @@ bool separated(const std::vector<Vec3>& points1, const std::vector<Vec3>& points
 
 bool intersect(const ConvexPolygon& poly1, const ConvexPolygon& poly2);
 bool intersect(const ConvexPolyhedron& polyh1, const ConvexPolyhedron& polyh2);
+// `axis` is tried first, and set to the separating axis if one is found (see sat_cache.hpp)
+bool intersect(const ConvexPolyhedron& polyh1, const ConvexPolyhedron& polyh2, Vec3* axis);
 bool intersect(const ConvexPolygon& polygon, const ConvexPolyhedron& polyhedron);
 // alias to the latter
 bool intersect(const ConvexPolyhedron& polyhedron, const ConvexPolygon& polygon);
@@ -0,0 +1,126 @@
+#include "sat_cache.hpp"
+
+
+using namespace std;
+
+
+void clear(SATCache& cache) {
+  cache.axes.clear();
+  cache.hits   = 0;
+  cache.misses = 0;
+}
+
+
+bool intersect(Prism x, Prism y, SATCache& cache, SATKey key) {
+  return _with_cached_axis(cache, key, [&](Vec3* axis) { return intersect(x, y, axis); });
+}
+
+
+bool intersect(Prism x, Prism y, Vec3 disp, SATCache& cache, SATKey key) {
+  return _with_cached_axis(cache, key, [&](Vec3* axis) { return intersect(x, y, disp, axis); });
+}
+
+
+bool intersect(Prism x, Prism y, Quaternion rotation, Vec3 about, SATCache& cache, SATKey key) {
+  return _with_cached_axis(cache, key, [&](Vec3* axis) { return intersect(x, y, rotation, about, axis); });
+}
+
+
+// only prisms are SAT tested, everything else goes to the uncached version
+struct cached_intersect_visitor : public boost::static_visitor<bool> {
+  cached_intersect_visitor(Prism prism, SATCache& cache, SATKey key)
+    : p(prism), c(cache), k(key) {}
+  Prism     p;
+  SATCache& c;
+  SATKey    k;
+
+  bool operator()(Prism t) const {
+    return intersect(p, t, c, k);
+  }
+
+  template<typename T>
+  bool operator()(T t) const {
+    return intersect(p, t);
+  }
+};
+
+
+struct cached_displacement_intersect_visitor : public boost::static_visitor<bool> {
+  cached_displacement_intersect_visitor(Prism prism, Vec3 disp, SATCache& cache, SATKey key)
+    : p(prism), d(disp), c(cache), k(key) {}
+  Prism     p;
+  Vec3      d;
+  SATCache& c;
+  SATKey    k;
+
+  bool operator()(Prism t) const {
+    return intersect(p, t, d, c, k);
+  }
+
+  template<typename T>
+  bool operator()(T t) const {
+    return intersect(p, t, d);
+  }
+};
+
+
+struct cached_rotation_intersect_visitor : public boost::static_visitor<bool> {
+  cached_rotation_intersect_visitor(Prism prism, Quaternion rotation, Vec3 about, SATCache& cache, SATKey key)
+    : p(prism), r(rotation), a(about), c(cache), k(key) {}
+  Prism      p;
+  Quaternion r;
+  Vec3       a;
+  SATCache&  c;
+  SATKey     k;
+
+  bool operator()(Prism t) const {
+    return intersect(p, t, r, a, c, k);
+  }
+
+  template<typename T>
+  bool operator()(T t) const {
+    return intersect(p, t, r, a);
+  }
+};
+
+
+bool intersect(Prism x, Intersectable y, SATCache& cache, SATKey key) {
+  auto visitor = cached_intersect_visitor(x, cache, key);
+  return boost::apply_visitor(visitor, y);
+}
+
+
+bool intersect(Prism x, Intersectable y, Vec3 disp, SATCache& cache, SATKey key) {
+  auto visitor = cached_displacement_intersect_visitor(x, disp, cache, key);
+  return boost::apply_visitor(visitor, y);
+}
+
+
+bool intersect(Prism x, Intersectable y, Quaternion rotation, Vec3 about, SATCache& cache, SATKey key) {
+  auto visitor = cached_rotation_intersect_visitor(x, rotation, about, cache, key);
+  return boost::apply_visitor(visitor, y);
+}
+
+
+bool intersect(Prism x, const vector<Intersectable>& ys, SATCache& cache, uint32_t part) {
+  for (size_t i = 0; i < ys.size(); i++) {
+    if (intersect(x, ys[i], cache, sat_key(i, part))) return true;
+  }
+  return false;
+}
+
+
+bool intersect(Prism x, const vector<Intersectable>& ys, Vec3 disp, SATCache& cache, uint32_t part) {
+  for (size_t i = 0; i < ys.size(); i++) {
+    if (intersect(x, ys[i], disp, cache, sat_key(i, part))) return true;
+  }
+  return false;
+}
+
+
+bool intersect(Prism x, const vector<Intersectable>& ys, Quaternion rotation, Vec3 about, SATCache& cache, uint32_t part) {
+  for (size_t i = 0; i < ys.size(); i++) {
+    if (intersect(x, ys[i], rotation, about, cache, sat_key(i, part))) return true;
+  }
+  return false;
+}
@@ -0,0 +1,72 @@
+#ifndef __SAT_CACHE
+#define __SAT_CACHE
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "geom.hpp"
+#include "bvh.hpp"
+
+
+// Separating axis cache for pairs that are tested over and over.
+//
+// Rotation steps and successive scan points test the same pairs with poses that barely change, so the axis that
+//    separated a pair last time almost always separates it again. The cached axis is tried before the full SAT test,
+//    which makes most repeated checks a single projection.
+// A cached axis is only ever a first guess: a stale or wrong entry costs one projection, never a wrong answer.
+// Only the SAT based tests (Prism <=> Prism, Prism <=> imported mesh) use it, everything else ignores the cache.
+
+
+typedef uint64_t SATKey;
+
+
+// `object` identifies the primitive (e.g. its index in the static geometry), `part` the gantry part tested against it
+inline SATKey sat_key(uint32_t object, uint32_t part) {
+  return ((SATKey)object << 32) | part;
+}
+
+
+typedef struct SATCache {
+  SATCache() : hits(0), misses(0) {}
+
+  std::unordered_map<SATKey, Vec3> axes;  // last separating axis of each pair
+  uint64_t hits;    // pair separated by its cached axis
+  uint64_t misses;  // full test needed
+} SATCache;
+
+
+void clear(SATCache& cache);
+
+
+// runs `test(Vec3* axis)` with the cached axis for `key`, and keeps the statistics
+template<typename F>
+bool _with_cached_axis(SATCache& cache, SATKey key, F test) {
+  Vec3& axis = cache.axes[key];
+  const Vec3 before = axis;
+  const bool ret = test(&axis);
+  if (!ret && norm2(before) > 0 && axis == before) cache.hits++;
+  else cache.misses++;
+  return ret;
+}
+
+
+// same as the versions in geom.hpp, with the axis kept in `cache` under `key`
+bool intersect(Prism x, Prism y, SATCache& cache, SATKey key);
+bool intersect(Prism x, Prism y, Vec3 disp, SATCache& cache, SATKey key);
+bool intersect(Prism x, Prism y, Quaternion rotation, Vec3 about, SATCache& cache, SATKey key);
+
+bool intersect(Prism x, Intersectable y, SATCache& cache, SATKey key);
+bool intersect(Prism x, Intersectable y, Vec3 disp, SATCache& cache, SATKey key);
+bool intersect(Prism x, Intersectable y, Quaternion rotation, Vec3 about, SATCache& cache, SATKey key);
+
+// keyed on sat_key(index in ys, part)
+bool intersect(Prism x, const std::vector<Intersectable>& ys, SATCache& cache, uint32_t part);
+bool intersect(Prism x, const std::vector<Intersectable>& ys, Vec3 disp, SATCache& cache, uint32_t part);
+bool intersect(Prism x, const std::vector<Intersectable>& ys, Quaternion rotation, Vec3 about, SATCache& cache, uint32_t part);
+
+// keyed on sat_key(index of the piece in y.pieces, part)
+bool intersect(const Prism& x, const BVH& y, SATCache& cache, uint32_t part);
+bool intersect(const Prism& x, const BVH& y, const Vec3& disp, SATCache& cache, uint32_t part);
+
+
+#endif
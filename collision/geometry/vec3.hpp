@@ -5,18 +5,20 @@
 
 
 // represents positions as well (for convinience, even though not all operations make sense)
+// The arithmetic is all defined in this header (constexpr where C++11 allows) so the SAT and sweep loops
+//   can be inlined and vectorized instead of calling into vec3.cpp for every add.
 typedef struct Vec3 {
-  Vec3();
-  Vec3(double _x, double _y, double _z);
+  constexpr Vec3() : x(0), y(0), z(0) {}
+  constexpr Vec3(double _x, double _y, double _z) : x(_x), y(_y), z(_z) {}
 
   double x;
   double y;
   double z;
 
-  static Vec3 zero();
-  static Vec3 basis_x();
-  static Vec3 basis_y();
-  static Vec3 basis_z();
+  static constexpr Vec3 zero()    { return Vec3(0, 0, 0); }
+  static constexpr Vec3 basis_x() { return Vec3(1, 0, 0); }
+  static constexpr Vec3 basis_y() { return Vec3(0, 1, 0); }
+  static constexpr Vec3 basis_z() { return Vec3(0, 0, 1); }
 
   template <typename T>
   static Vec3 basis(T i) {
@@ -87,27 +89,74 @@ typedef struct Vec3 {
 } Vec3;
 
 
-bool operator==(const Vec3& p1, const Vec3& p2);
-Vec3 operator+(const Vec3& p1, const Vec3& p2);
-Vec3 operator-(const Vec3& p1, const Vec3& p2);
+constexpr bool operator==(const Vec3& p1, const Vec3& p2) {
+  return p1.x == p2.x && p1.y == p2.y && p1.z == p2.z;
+}
 
-double operator*(const Vec3& p1, const Vec3& p2);
-// both dot and cross are defined because '*' for Vec3 is the dot product,
-//   while for Quaternion it's the Hamilton product. This just makes it a
-//   little clearer what's happening.
-double dot(const Vec3& p1, const Vec3& p2);
-Vec3   cross(const Vec3 p1, const Vec3 p2);
+constexpr Vec3 operator+(const Vec3& p1, const Vec3& p2) {
+  return Vec3(p1.x + p2.x, p1.y + p2.y, p1.z + p2.z);
+}
 
-Vec3 operator-(const Vec3& p);
-Vec3 operator*(const double d, const Vec3& p);
-Vec3 operator*(const Vec3& p, const double d);
-Vec3 operator/(const Vec3& p, const double d);
+constexpr Vec3 operator-(const Vec3& p1, const Vec3& p2) {
+  return Vec3(p1.x - p2.x, p1.y - p2.y, p1.z - p2.z);
+}
 
-double norm(const Vec3 p);
-double norm2(const Vec3 p);  // norm squared
-Vec3   normalized(const Vec3 p);
+// dot product
+constexpr double operator*(const Vec3& p1, const Vec3& p2) {
+  return (p1.x * p2.x) + (p1.y * p2.y) + (p1.z * p2.z);
+}
 
-bool approxeq(const Vec3& p1, const Vec3& p2);
+// both dot and cross are defined because '*' for Vec3 is the dot product,
+//   while for Quaternion it's the Hamilton product. This just makes it a
+//   little clearer what's happening.
+constexpr double dot(const Vec3& p1, const Vec3& p2) {
+  return p1 * p2;
+}
+
+constexpr Vec3 cross(const Vec3 p1, const Vec3 p2) {
+  return Vec3(
+    (p1.y * p2.z) - (p1.z * p2.y),
+    (p1.z * p2.x) - (p1.x * p2.z),
+    (p1.x * p2.y) - (p1.y * p2.x)
+  );
+}
+
+constexpr Vec3 operator-(const Vec3& p) {
+  return Vec3(-p.x, -p.y, -p.z);
+}
+
+constexpr Vec3 operator*(const double d, const Vec3& p) {
+  return Vec3(d * p.x, d * p.y, d * p.z);
+}
+
+constexpr Vec3 operator*(const Vec3& p, const double d) {
+  return d * p;
+}
+
+// multiplies by the reciprocal, as it always has; results would change in the last bit otherwise
+constexpr Vec3 operator/(const Vec3& p, const double d) {
+  return (1/d) * p;
+}
+
+// norm squared
+constexpr double norm2(const Vec3 p) {
+  return (p.x*p.x) + (p.y*p.y) + (p.z*p.z);
+}
+
+inline double norm(const Vec3 p) {
+  return sqrt((p.x * p.x) + (p.y * p.y) + (p.z * p.z));
+}
+
+inline Vec3 normalized(const Vec3 p) {
+  return p / norm(p);
+}
+
+inline bool approxeq(const Vec3& p1, const Vec3& p2) {
+  return
+    (fabs(p1.x - p2.x) < APPROX) &&
+    (fabs(p1.y - p2.y) < APPROX) &&
+    (fabs(p1.z - p2.z) < APPROX);
+}
 
 std::ostream &operator<<(std::ostream& os, const Vec3& p);
 
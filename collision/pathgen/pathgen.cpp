@@ -33,17 +33,32 @@ namespace Cyl  = PathGeneration::Private::Cyl;
 
 namespace PathGeneration {
 
+
+// gantry parts, used as the `part` of separating axis cache keys
+enum GantryPart {
+  OpticalBox0 = 0,
+  OpticalBox1 = 1,
+  Prisms0     = 2,  // 3 parts each, see point_to_prisms
+  Prisms1     = 5
+};
+
+// cache key "object" for gantry-gantry checks, can't be an index in the static geometry
+#define GANTRY_GANTRY_OBJECT 0xFFFFFFFFu
+
+
 // alternate version of public function
 bool is_destination_valid(
   const Point& gantry0,
   const Point& gantry1,
-  const vector<Intersectable>& static_geometry
+  const vector<Intersectable>& static_geometry,
+  SATCache& cache
 );
 
 bool is_move_valid(
   const MovePath moving,
   const WhichGantry is_moving,
-  const vector<Intersectable>& static_geometry
+  const vector<Intersectable>& static_geometry,
+  SATCache& cache
 );
 
 MovePath generate_move(
@@ -63,20 +78,27 @@ bool check_any_collisions(
 bool check_any_collisions(
   const Point& gantry0,
   const Point& gantry1,
-  const vector<Intersectable>& static_geometry
+  const vector<Intersectable>& static_geometry,
+  SATCache& cache
 );
 
 // Most-used public functions
 
 
 variant<MovePath, ErrorType> single_move(const MovePoint& from, const MovePoint& to, const vector<Intersectable>& static_geometry) {
+  SATCache cache;
+  return single_move(from, to, static_geometry, cache);
+}
+
+
+variant<MovePath, ErrorType> single_move(const MovePoint& from, const MovePoint& to, const vector<Intersectable>& static_geometry, SATCache& cache) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
   DEBUG_COUT("Checking destination and source...");
 
-  if (!is_destination_valid(to.gantry0, to.gantry1, static_geometry)) {
+  if (!is_destination_valid(to.gantry0, to.gantry1, static_geometry, cache)) {
     return ErrorType::InvalidDestination;
   }
-  else if (!is_destination_valid(from.gantry0, from.gantry1, static_geometry)) {
+  else if (!is_destination_valid(from.gantry0, from.gantry1, static_geometry, cache)) {
     return ErrorType::InvalidOrigin;
   }
 
@@ -91,12 +113,12 @@ variant<MovePath, ErrorType> single_move(const MovePoint& from, const MovePoint&
     DEBUG_COUT("Attempting dim order " << C_BOLD << i << ": " << order0 << C_RESET);
     
     auto path0  = generate_move({from.gantry0, to.gantry0}, from.gantry1, Gantry0, order0);
-    if (is_move_valid(path0, Gantry0, static_geometry)) {
+    if (is_move_valid(path0, Gantry0, static_geometry, cache)) {
       for (size_t j = 0; j < all_orders.size(); j++) {
         auto order1 = all_orders[j];
         auto path1  = generate_move({from.gantry1, to.gantry1}, to.gantry0, Gantry1, order1);
         // cerr << "," << j;
-        if (is_move_valid(path1, Gantry1, static_geometry)) {
+        if (is_move_valid(path1, Gantry1, static_geometry, cache)) {
           path0.reserve(10);
           path0.insert(path0.end(), path1.begin(), path1.end());
           DEBUG_COUT(C_BR_GREEN << "Move found." << C_RESET);
@@ -119,11 +141,11 @@ variant<MovePath, ErrorType> single_move(const MovePoint& from, const MovePoint&
     DEBUG_COUT("Attempting dim order " << C_BOLD << i << ": " << order1 << C_RESET);
 
     auto path1  = generate_move({from.gantry1, to.gantry1}, from.gantry0, Gantry1, order1);
-    if (is_move_valid(path1, Gantry1, static_geometry)) {
+    if (is_move_valid(path1, Gantry1, static_geometry, cache)) {
       for (size_t j = 0; j < all_orders.size(); j++) {
         auto order0 = all_orders[j];
         auto path0  = generate_move({from.gantry0, to.gantry0}, to.gantry1, Gantry0, order0);
-        if (is_move_valid(path0, Gantry0, static_geometry)) {
+        if (is_move_valid(path0, Gantry0, static_geometry, cache)) {
           path1.reserve(10);
           path1.insert(path1.end(), path0.begin(), path0.end());
           DEBUG_COUT(C_BR_GREEN << "Move found." << C_RESET);
@@ -161,6 +183,17 @@ bool is_destination_valid(
   const Point& gantry0,
   const Point& gantry1,
   const vector<Intersectable>& static_geometry
+) {
+  SATCache cache;
+  return is_destination_valid(gantry0, gantry1, static_geometry, cache);
+}
+
+
+bool is_destination_valid(
+  const Point& gantry0,
+  const Point& gantry1,
+  const vector<Intersectable>& static_geometry,
+  SATCache& cache
 ) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
 
@@ -176,7 +209,7 @@ bool is_destination_valid(
     return false;
   }
   DEBUG_COUT("Distance constraints ok. Checking collisions.");
-  if (check_any_collisions(gantry0, gantry1, static_geometry)) {
+  if (check_any_collisions(gantry0, gantry1, static_geometry, cache)) {
     DEBUG_COUT("Found collision.");
     DEBUG_LEAVE;
     return false;
@@ -195,7 +228,8 @@ Angle eldiff(const Angle& a1, const Angle& a2) {
 bool is_move_valid(
   const MovePath moving,
   const WhichGantry is_moving,
-  const vector<Intersectable>& static_geometry
+  const vector<Intersectable>& static_geometry,
+  SATCache& cache
 ) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
   DEBUG_COUT("Move contains " << moving.size() << " substeps and gantry " << (is_moving == Gantry0 ? "0" : "1") << " is moving.");
@@ -211,8 +245,8 @@ bool is_move_valid(
     
     if (norm2(dp0) > 0) {
       DEBUG_COUT("Found nonzero displacement for gantry 0: " << SD::serialize(dp0));
-      if (intersect(point_to_optical_box(pt.gantry0, false), static_geometry, dp0)
-          || intersect(point_to_optical_box(pt.gantry1, true), static_geometry)) {
+      if (intersect(point_to_optical_box(pt.gantry0, false), static_geometry, dp0, cache, OpticalBox0)
+          || intersect(point_to_optical_box(pt.gantry1, true), static_geometry, cache, OpticalBox1)) {
         DEBUG_COUT("Found collision.");
         DEBUG_LEAVE;
         return false;
@@ -220,8 +254,8 @@ bool is_move_valid(
     }
     else if (norm2(dp1) > 0) {
       DEBUG_COUT("Found nonzero displacement for gantry 1: " << SD::serialize(dp1));
-      if (intersect(point_to_optical_box(pt.gantry0, false), static_geometry)
-          || intersect(point_to_optical_box(pt.gantry1, true), static_geometry, dp1)) {
+      if (intersect(point_to_optical_box(pt.gantry0, false), static_geometry, cache, OpticalBox0)
+          || intersect(point_to_optical_box(pt.gantry1, true), static_geometry, dp1, cache, OpticalBox1)) {
         DEBUG_COUT("Found collision.");
         DEBUG_LEAVE;
         return false;
@@ -229,8 +263,8 @@ bool is_move_valid(
     }
     else if (da0.theta != 0 || da0.phi != 0) {
       DEBUG_COUT("Found nonzero rotation for gantry 0: theta=" << da0.theta << ", phi=" << da0.phi);
-      if (intersect(point_to_optical_box(pt.gantry0, false), static_geometry, Quaternion::from_spherical_angle(da0.theta, da0.phi), pt.gantry0.position)
-          || intersect(point_to_optical_box(pt.gantry1, false), static_geometry)) {
+      if (intersect(point_to_optical_box(pt.gantry0, false), static_geometry, Quaternion::from_spherical_angle(da0.theta, da0.phi), pt.gantry0.position, cache, OpticalBox0)
+          || intersect(point_to_optical_box(pt.gantry1, false), static_geometry, cache, OpticalBox1)) {
         DEBUG_COUT("Found collision.");
         DEBUG_LEAVE;
         return false;
@@ -238,16 +272,16 @@ bool is_move_valid(
     }
     else if (da1.theta != 0 || da1.phi != 0) {
       DEBUG_COUT("Found nonzero rotation for gantry 1: theta=" << da1.theta << ", phi=" << da1.phi);
-      if (intersect(point_to_optical_box(pt.gantry1, false), static_geometry, Quaternion::from_spherical_angle(da1.theta, da1.phi), pt.gantry1.position)
-          || intersect(point_to_optical_box(pt.gantry0, false), static_geometry)) {
+      if (intersect(point_to_optical_box(pt.gantry1, false), static_geometry, Quaternion::from_spherical_angle(da1.theta, da1.phi), pt.gantry1.position, cache, OpticalBox1)
+          || intersect(point_to_optical_box(pt.gantry0, false), static_geometry, cache, OpticalBox0)) {
         DEBUG_COUT("Found collision.");
         DEBUG_LEAVE;
         return false;
       }
     } else {
       DEBUG_COUT("Found no movement. Should be covered by start/dest checks.");
-      if (intersect(point_to_optical_box(pt.gantry1, false), static_geometry)
-          || intersect(point_to_optical_box(pt.gantry0, false), static_geometry)) {
+      if (intersect(point_to_optical_box(pt.gantry1, false), static_geometry, cache, OpticalBox1)
+          || intersect(point_to_optical_box(pt.gantry0, false), static_geometry, cache, OpticalBox0)) {
         DEBUG_COUT("Found collision.");
         DEBUG_LEAVE;
         return false;
@@ -414,7 +448,7 @@ string dim_name(size_t i) {
 /* Collision checks */
 
 
-bool check_any_collisions(const Point& gantry0, const Point& gantry1, const vector<Intersectable>& static_geometry) {
+bool check_any_collisions(const Point& gantry0, const Point& gantry1, const vector<Intersectable>& static_geometry, SATCache& cache) {
   DEBUG_ENTER(__PRETTY_FUNCTION__);
 
   const auto
@@ -428,7 +462,7 @@ bool check_any_collisions(const Point& gantry0, const Point& gantry1, const vect
   
   for (size_t i = 0 ; i < 3; i++) {
     for (size_t j = 0; j < 3; j++) {
-      if (intersect(g0[i], g1[j])) {
+      if (intersect(g0[i], g1[j], cache, sat_key(GANTRY_GANTRY_OBJECT, 3*i + j))) {
         DEBUG_COUT("Gantry-gantry collision found, " << i << ", " << j);
         DEBUG_LEAVE;
         return true;
@@ -442,7 +476,8 @@ bool check_any_collisions(const Point& gantry0, const Point& gantry1, const vect
     DEBUG_COUT("Checking with object " << gi);
 
     for (size_t i = 0; i < 3; i++) {
-      if (intersect(g0[i], static_geometry[gi]) || intersect(g1[i], static_geometry[gi])) {
+      if (intersect(g0[i], static_geometry[gi], cache, sat_key(gi, Prisms0 + i))
+          || intersect(g1[i], static_geometry[gi], cache, sat_key(gi, Prisms1 + i))) {
         DEBUG_COUT(
           "Collision found, with prism " << i
           << " for gantry " << (intersect(g0[i], static_geometry[gi]) ? 0 : 1)
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "geom.hpp"
+#include "sat_cache.hpp"
 #include "serialization.hpp"
 
 
@@ -186,6 +187,14 @@ variant<MovePath, ErrorType> single_move(
   const vector<Intersectable>& static_geometry
 );
 
+// same, but keeps separating axes in `cache` so successive moves (e.g. through a scan) check faster
+variant<MovePath, ErrorType> single_move(
+  const MovePoint& from,
+  const MovePoint& to,
+  const vector<Intersectable>& static_geometry,
+  SATCache& cache
+);
+
 
 variant<vector<MovePath>, ErrorType> scan_path(
   const ScanParams params,
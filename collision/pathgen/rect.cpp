@@ -93,12 +93,15 @@ variant<vector<MovePath>, ErrorType> gen_path(const GeneralParams p, const Recta
   DEBUG_COUT("Generated desired path with " << desired_path.size() << " points.");
   vector<MovePath> ret;
   ret.reserve(desired_path.size());
+  // successive points are close together, so the same axes keep separating the gantry from the geometry
+  SATCache cache;
 
   for (size_t i = 1; i < desired_path.size(); ++i) {
     auto subpath = single_move(
       from_pair(desired_path[i-1], p.which_gantry),
       from_pair(desired_path[i],   p.which_gantry),
-      static_geometry
+      static_geometry,
+      cache
     );
     if (__builtin_expect(has<ErrorType>(subpath), 0)) {
       DEBUG_COUT("Subpath generation failed at index " << (i-1) << "\u2013" << i << ".");
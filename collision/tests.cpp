@@ -17,6 +17,9 @@
 #include "serialization_internal.hpp"
 #include "has.hpp"
 #include "pathgen.hpp"
+#include "mesh.hpp"
+#include "sat_cache.hpp"
+#include "pathcalc/TGantryConfigCalculator.hxx"
 
 
 namespace PG = PathGeneration;
@@ -232,6 +235,62 @@ BOOST_AUTO_TEST_CASE(testPrismPoints, _TOL) {
 // }
 
 
+// the arithmetic is inline now, this makes sure it can be used at compile time
+BOOST_AUTO_TEST_CASE(testArithmeticConstexpr) {
+  constexpr Vec3 a = Vec3(1.0, 2.0, 3.0) + 2.0 * Vec3::basis_z();
+  constexpr Quaternion k = Quaternion::basis_i() * Quaternion::basis_j();
+
+  static_assert(a == Vec3(1.0, 2.0, 5.0), "constexpr Vec3");
+  static_assert(cross(Vec3::basis_x(), Vec3::basis_y()) == Vec3::basis_z(), "constexpr cross");
+  static_assert(dot(a, a) == norm2(a), "constexpr dot");
+  static_assert(k.w == 0 && k.x == 0 && k.y == 0 && k.z == 1, "constexpr Hamilton product");
+  static_assert(vector_part(Quaternion::from_vec3(a)) == a, "constexpr vector part");
+
+  BOOST_TEST(norm(Vec3(3.0, 4.0, 0.0)) == 5.0);
+}
+
+
+// Results of the old out-of-line implementations (vec3.cpp/quaternion.cpp) for the same inputs.
+// These are compared exactly, inlining must not change a single bit.
+BOOST_AUTO_TEST_CASE(testArithmeticBitIdentical) {
+  const Vec3 a = {0.1, -0.7, 2.3};
+  const Vec3 b = {1.9, 0.45, -0.33};
+  const Quaternion p = {0.3, -1.1, 0.7, 0.2};
+  const Quaternion q = Quaternion::from_spherical_angle(0.4, 1.3);
+
+  const Vec3 c = cross(a, b);
+  const Vec3 n = normalized(a);
+  const Vec3 r = rotate_point(a, b, q);
+  const Quaternion m = p * q;
+  const Quaternion i = inverse(p);
+
+  BOOST_TEST(c.x == -0x1.9ba5e353f7cedp-1);
+  BOOST_TEST(c.y ==  0x1.19cac083126e9p+2);
+  BOOST_TEST(c.z ==  0x1.5ffffffffffffp+0);
+
+  BOOST_TEST(n.x ==  0x1.5472a9aef95b4p-5);
+  BOOST_TEST(n.y == -0x1.29e454791a2fdp-2);
+  BOOST_TEST(n.z ==  0x1.e964d3eb86732p-1);
+
+  BOOST_TEST(r.x ==  0x1.0f42de1ff05a5p+2);
+  BOOST_TEST(r.y ==  0x1.855f66036a4c6p-3);
+  BOOST_TEST(r.z ==  0x1.0dd08a6292b37p+1);
+
+  BOOST_TEST(m.w == -0x1.6149d4af8242fp-2);
+  BOOST_TEST(m.x == -0x1.cdefdc695452p-1);
+  BOOST_TEST(m.y ==  0x1.bf7ecc18192ebp-1);
+  BOOST_TEST(m.z == -0x1.758993a93aa99p-2);
+
+  BOOST_TEST(i.w ==  0x1.4fbcda3ac10c9p-3);
+  BOOST_TEST(i.x ==  0x1.33c272b5dba0ep-1);
+  BOOST_TEST(i.y == -0x1.87b1a9448be3fp-2);
+  BOOST_TEST(i.z == -0x1.bfa6784e56bb7p-4);
+
+  BOOST_TEST(norm(a) ==  0x1.33ffbbe918ca2p+1);
+  BOOST_TEST(dot(a, b) == -0x1.c49ba5e353f7dp-1);
+}
+
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE(intersections);
 
@@ -639,6 +698,34 @@ BOOST_AUTO_TEST_CASE(testMovingPrismSphereXZEdgeSeparatedIntersectionVel, _TOL)
   BOOST_TEST(intersect(x, s, disp));
 }
 
+// closest approach of the XY edge is sqrt(2)*(1 - t) for disp = t*(1, 1, 0)
+BOOST_AUTO_TEST_CASE(testMovingPrismSphereXYEdgeGraze, _TOL) {
+  Prism x = {
+    Vec3(0.0, 0.0, 0.0),
+    1, 1, 1,
+    0.0, 0.0
+  };
+  Sphere s = { Vec3(2, 2, 0), 0.5 };
+
+  BOOST_TEST(!intersect(x, s, 0.6 * Vec3(1, 1, 0)));
+  BOOST_TEST( intersect(x, s, 0.7 * Vec3(1, 1, 0)));
+}
+
+// the displacement is in the global frame, not the prism's
+BOOST_AUTO_TEST_CASE(testMovingPrismSphereRotatedPrism, _TOL) {
+  Prism x = {
+    Vec3(0.0, 0.0, 0.0),
+    2, 0.1, 0.1,
+    Quaternion::from_axis_angle(Vec3::basis_z(), PI/2)  // long along y
+  };
+  Sphere s = { Vec3(1, 1.5, 0), 0.1 };
+
+  BOOST_TEST(!intersect(x, s, Vec3::zero()));
+  BOOST_TEST(!intersect(x, s, 0.5 * Vec3::basis_x()));
+  BOOST_TEST( intersect(x, s, Vec3::basis_x()));
+  BOOST_TEST(!intersect(x, s, Vec3::basis_y()));
+}
+
 
 /*
  * Rotating prism + sphere intersection
@@ -808,8 +895,9 @@ BOOST_AUTO_TEST_CASE(testPrismCylinderNoIntersectionInternal, _TOL) {
 
 
 BOOST_AUTO_TEST_CASE(testPrismCylinderNoIntersectionExceedExtent, _TOL) {
+  // entirely above the top of the cylinder (e is the half height, so the prism starts at z = 2.5)
   Prism p = {
-    Vec3(0.0, 0.0, 3.0),
+    Vec3(0.0, 0.0, 4.0),
     1.5, 1.5, 1.5,
     Quaternion::identity()
   };
@@ -839,21 +927,39 @@ BOOST_AUTO_TEST_CASE(testPrismCylinderIntersectionSimple, _TOL) {
 }
 
 
-// This test will fail. If full collision detection between cylinders and prisms is implemented, uncomment this test.
-// BOOST_AUTO_TEST_CASE(testPrismCylinderIntersectionLarge, _TOL) {
-//   Prism p = {
-//     Vec3(0.0, 0.0, 0.0),
-//     1.5, 1.5, 1.5,
-//     Quaternion::identity()
-//   };
-//   Cylinder c = {
-//     {0.0, 0.0, 0.0},
-//     1.0, 2.0,
-//     Quaternion::identity()
-//   };
-//
-//   BOOST_TEST(intersect(p, c));
-// }
+BOOST_AUTO_TEST_CASE(testPrismCylinderIntersectionLarge, _TOL) {
+  Prism p = {
+    Vec3(0.0, 0.0, 0.0),
+    1.5, 1.5, 1.5,
+    Quaternion::identity()
+  };
+  Cylinder c = {
+    {0.0, 0.0, 0.0},
+    1.0, 2.0,
+    Quaternion::identity()
+  };
+
+  BOOST_TEST(intersect(p, c));
+}
+
+
+BOOST_AUTO_TEST_CASE(testPrismCylinderIntersectionOffsetCenter, _TOL) {
+  // the cylinder's frame has to be taken about its own centre
+  Prism p = {
+    Vec3(5.0, 5.0, 2.0),
+    0.5, 0.5, 0.5,
+    Quaternion::identity()
+  };
+  Cylinder c = {
+    {5.0, 5.0, 5.0},
+    1.0, 2.0,
+    Quaternion::from_spherical_angle(0.0, PI/2)
+  };
+
+  BOOST_TEST(!intersect(p, c));
+  p.center = Vec3(5.0, 5.0, 4.0);
+  BOOST_TEST(intersect(p, c));
+}
 
 
 BOOST_AUTO_TEST_CASE(testPrismCylinderIntersectionRot, _TOL) {
@@ -872,6 +978,283 @@ BOOST_AUTO_TEST_CASE(testPrismCylinderIntersectionRot, _TOL) {
 }
 
 
+/*
+ *  Moving prism + cylinder
+ */
+
+
+BOOST_AUTO_TEST_CASE(testMovingPrismCylinderCrossesWall, _TOL) {
+  // starts inside, ends outside, but neither end touches the wall
+  Prism p = {Vec3(0.0, 0.0, 0.0), 0.2, 0.2, 0.2, Quaternion::identity()};
+  Cylinder c = {{0.0, 0.0, 0.0}, 1.0, 2.0, Quaternion::identity()};
+
+  BOOST_TEST(!intersect(p, c));
+  BOOST_TEST(!intersect(Prism(Vec3(3.0, 0.0, 0.0), 0.2, 0.2, 0.2, Quaternion::identity()), c));
+  BOOST_TEST(intersect(p, c, Vec3(3.0, 0.0, 0.0)));
+}
+
+
+BOOST_AUTO_TEST_CASE(testMovingPrismCylinderNoIntersectionInternal, _TOL) {
+  Prism p = {Vec3(-0.5, 0.0, 0.0), 0.2, 0.2, 0.2, Quaternion::from_spherical_angle(0.4, 0.7)};
+  Cylinder c = {{0.0, 0.0, 0.0}, 1.0, 2.0, Quaternion::identity()};
+
+  BOOST_TEST(!intersect(p, c, Vec3(1.0, 0.0, 1.0)));
+}
+
+
+BOOST_AUTO_TEST_CASE(testMovingPrismCylinderNoIntersectionAbove, _TOL) {
+  // passes over the top of the cylinder, which is not checked
+  Prism p = {Vec3(-3.0, 0.0, 3.0), 0.5, 0.5, 0.5, Quaternion::identity()};
+  Cylinder c = {{0.0, 0.0, 0.0}, 1.0, 2.0, Quaternion::identity()};
+
+  BOOST_TEST(!intersect(p, c, Vec3(6.0, 0.0, 0.0)));
+  BOOST_TEST(intersect(p, c, Vec3(6.0, 0.0, -3.0)));
+}
+
+
+/*
+ * Separating axis cache
+ */
+
+
+BOOST_AUTO_TEST_CASE(testSATCacheReusesAxis, _TOL) {
+  Prism a = {Vec3(0.0, 0.0, 0.0), 0.5, 0.5, 0.5, Quaternion::identity()};
+  Prism b = {Vec3(1.2, 0.0, 0.0), 0.5, 0.5, 0.5, Quaternion::from_spherical_angle(0.3, 0.1)};
+  SATCache cache;
+  const SATKey key = sat_key(3, 1);
+
+  BOOST_TEST(!intersect(a, b, cache, key));
+  BOOST_TEST(cache.misses == 1);
+  BOOST_TEST(norm2(cache.axes[key]) > 0);
+
+  // nudged a little, still separated by the same axis
+  a.center = Vec3(0.01, 0.02, 0.0);
+  BOOST_TEST(!intersect(a, b, cache, key));
+  BOOST_TEST(cache.hits == 1);
+
+  // a different part doesn't share the axis
+  BOOST_TEST(!intersect(a, b, cache, sat_key(3, 2)));
+  BOOST_TEST(cache.hits == 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(testSATCacheStaleAxis, _TOL) {
+  Prism a = {Vec3(0.0, 0.0, 0.0), 0.5, 0.5, 0.5, Quaternion::identity()};
+  Prism b = {Vec3(0.8, 0.0, 0.0), 0.5, 0.5, 0.5, Quaternion::identity()};
+  SATCache cache;
+
+  // a wrong axis must not hide a collision
+  cache.axes[sat_key(0, 0)] = Vec3::basis_z();
+  BOOST_TEST(intersect(a, b, cache, sat_key(0, 0)));
+  BOOST_TEST(cache.hits == 0);
+
+  b.center = Vec3(0.0, 0.0, 1.1);
+  BOOST_TEST(!intersect(a, b, cache, sat_key(0, 0)));
+  BOOST_TEST(cache.hits == 1);
+}
+
+
+BOOST_AUTO_TEST_CASE(testSATCacheMatchesUncached, _TOL) {
+  std::mt19937_64 gen(28);
+  std::uniform_real_distribution<double> u(-1.0, 1.0);
+
+  vector<Intersectable> geometry;
+  for (int i = 0; i < 10; i++) {
+    geometry.push_back(Prism(Vec3(0.6*u(gen), 0.6*u(gen), 0.6*u(gen)), 0.05, 0.1, 0.05, u(gen), u(gen)));
+  }
+  geometry.push_back((Sphere) {Vec3(0.0, 0.5, 0.0), 0.1});
+
+  SATCache cache;
+  Vec3   pos   = Vec3::zero();
+  double theta = 0.0, phi = 0.0;
+  for (int step = 0; step < 2000; step++) {
+    pos    = pos + 0.01 * Vec3(u(gen), u(gen), u(gen));
+    theta += 0.01 * u(gen);
+    phi   += 0.01 * u(gen);
+    if (norm(pos) > 0.3) pos = Vec3::zero();
+
+    const Prism p = {pos, 0.05, 0.05, 0.1, theta, phi};
+    const Vec3  d = 0.05 * Vec3(u(gen), u(gen), u(gen));
+    BOOST_TEST(intersect(p, geometry, cache, 0) == intersect(p, geometry));
+    BOOST_TEST(intersect(p, geometry, d, cache, 1) == intersect(p, geometry, d));
+    if (step % 100 == 0) {
+      const Quaternion r = Quaternion::from_spherical_angle(0.2*u(gen), 0.2*u(gen));
+      BOOST_TEST(intersect(p, geometry, r, pos, cache, 2) == intersect(p, geometry, r, pos));
+    }
+  }
+  BOOST_TEST(cache.hits > 0);
+}
+
+
+/*
+ * Convex hulls and imported meshes
+ */
+
+
+// open topped cylinder (like the tank) with a floor, written as OBJ
+void write_tank_obj(const string& path, int sides, double r, double h) {
+  FILE* f = fopen(path.c_str(), "w");
+  for (int i = 0; i < sides; i++) {
+    const double t = TWO_PI * i / sides;
+    fprintf(f, "v %.17g %.17g 0\nv %.17g %.17g %.17g\n", r*cos(t), r*sin(t), r*cos(t), r*sin(t), h);
+  }
+  fprintf(f, "v 0 0 0\n");
+  for (int i = 0; i < sides; i++) {
+    const int
+      a = 2*i + 1,
+      b = 2*i + 2,
+      c = 2*((i + 1) % sides) + 1,
+      d = 2*((i + 1) % sides) + 2;
+    fprintf(f, "f %d %d %d %d\nf %d %d %d\n", a, c, d, b, 2*sides + 1, c, a);
+  }
+  fclose(f);
+}
+
+
+BOOST_AUTO_TEST_CASE(testConvexHullCube, _TOL) {
+  vector<Vec3> pts;
+  for (int i = 0; i < 8; i++) {
+    pts.push_back(Vec3(i & 1 ? 1 : -1, i & 2 ? 1 : -1, i & 4 ? 1 : -1));
+  }
+  pts.push_back(Vec3(0.0, 0.0, 0.0));
+  pts.push_back(Vec3(0.5, 0.2, -0.1));
+
+  auto c = convex_hull(pts);
+
+  BOOST_TEST(c.hull.vertexes.size() == 8);
+  BOOST_TEST(c.faces.size() == 12);
+  BOOST_TEST(c.hull.edges.size() == 12);
+  BOOST_TEST(c.hull.normals.size() == 6);
+  BOOST_TEST(depth(c, Vec3(0.0, 0.0, 0.0)) == 1.0);
+  BOOST_TEST(depth(c, Vec3(2.0, 0.0, 0.0)) == -1.0);
+}
+
+
+BOOST_AUTO_TEST_CASE(testConvexHullFlatPrism, _TOL) {
+  auto plate = convex_hull({{0,0,0}, {1,0,0}, {1,1,0}, {0,1,0}});
+
+  Prism above   = {Vec3(0.5, 0.5, 0.2),  0.1, 0.1, 0.1, Quaternion::identity()};
+  Prism through = {Vec3(0.5, 0.5, 0.05), 0.1, 0.1, 0.1, Quaternion::identity()};
+
+  BOOST_TEST(!plate.faces.empty());
+  BOOST_TEST(!intersect(above, plate));
+  BOOST_TEST(intersect(through, plate));
+  BOOST_TEST(intersect(above, plate, Vec3(0.0, 0.0, -0.4)));
+  BOOST_TEST(!intersect(above, plate, Vec3(0.0, 0.5, 0.0)));
+}
+
+
+BOOST_AUTO_TEST_CASE(testConvexPieceSphereCorner, _TOL) {
+  auto plate = convex_hull({{0,0,0}, {1,0,0}, {1,1,0}, {0,1,0}});
+
+  Sphere touching = {Vec3(1.05, 1.05, 0.0), 0.08};
+  Sphere missing  = {Vec3(1.06, 1.06, 0.0), 0.08};
+
+  BOOST_TEST(intersect(touching, plate));
+  BOOST_TEST(!intersect(missing, plate));
+}
+
+
+BOOST_AUTO_TEST_CASE(testConvexPiecePrismRotated, _TOL) {
+  vector<Vec3> pts;
+  for (int i = 0; i < 8; i++) {
+    pts.push_back(Vec3(i & 1 ? 1 : -1, i & 2 ? 1 : -1, i & 4 ? 1 : -1));
+  }
+  auto cube = convex_hull(pts);
+
+  Prism near     = {Vec3(1.5, 0.0, 0.0), 0.49, 0.4, 0.4, Quaternion::identity()};
+  Prism touching = {Vec3(1.5, 0.0, 0.0), 0.51, 0.4, 0.4, Quaternion::from_spherical_angle(0.3, 0.2)};
+
+  BOOST_TEST(!intersect(near, cube));
+  BOOST_TEST(intersect(touching, cube));
+}
+
+
+BOOST_AUTO_TEST_CASE(testLoadBinarySTL, _TOL) {
+  const string path = "/tmp/ptf_test_tetra.stl";
+  const float tris[4][9] = {
+    {0,0,0, 1,0,0, 0,1,0},
+    {0,0,0, 0,0,1, 1,0,0},
+    {0,0,0, 0,1,0, 0,0,1},
+    {1,0,0, 0,0,1, 0,1,0}
+  };
+  FILE* f = fopen(path.c_str(), "wb");
+  char header[80] = "solid but actually binary";
+  const uint32_t n = 4;
+  const float normal[3] = {0, 0, 0};
+  const uint16_t attr = 0;
+  fwrite(header, 1, sizeof(header), f);
+  fwrite(&n, sizeof(n), 1, f);
+  for (size_t i = 0; i < n; i++) {
+    fwrite(normal, sizeof(float), 3, f);
+    fwrite(tris[i], sizeof(float), 9, f);
+    fwrite(&attr, sizeof(attr), 1, f);
+  }
+  fclose(f);
+
+  auto m = MeshImport::load_mesh(path, 0.001);
+  BOOST_TEST(!has<MeshImport::ErrorType>(m));
+  if (has<MeshImport::ErrorType>(m)) return;
+
+  const auto& mesh = get<TriangleMesh>(m);
+  BOOST_TEST(mesh.triangles.size() == 4);
+  BOOST_TEST(mesh.vertexes.size() == 4);  // shared corners are merged
+  BOOST_TEST(mesh.vertexes[1].x == 0.001);
+}
+
+
+BOOST_AUTO_TEST_CASE(testLoadMeshErrors, _TOL) {
+  auto missing = MeshImport::load_mesh("/tmp/ptf_test_does_not_exist.obj");
+  auto unknown = MeshImport::load_mesh("/tmp/ptf_test_mesh.3ds");
+
+  BOOST_TEST(has<MeshImport::ErrorType>(missing));
+  BOOST_TEST(has<MeshImport::ErrorType>(unknown));
+  if (has<MeshImport::ErrorType>(missing)) BOOST_TEST(get<MeshImport::ErrorType>(missing) == MeshImport::FileError);
+  if (has<MeshImport::ErrorType>(unknown)) BOOST_TEST(get<MeshImport::ErrorType>(unknown) == MeshImport::UnknownFormat);
+}
+
+
+BOOST_AUTO_TEST_CASE(testMeshDecompositionTank, _TOL) {
+  const string path  = "/tmp/ptf_test_tank.obj";
+  const string cache = path + MESH_CACHE_EXT;
+  write_tank_obj(path, 64, 0.6, 1.0);
+  remove(cache.c_str());
+
+  auto r = MeshImport::load_collision_mesh(path);
+  BOOST_TEST(!has<MeshImport::ErrorType>(r));
+  if (has<MeshImport::ErrorType>(r)) return;
+  const auto& tank = get<BVH>(r);
+
+  // a single hull would fill the whole tank
+  BOOST_TEST(tank.pieces.size() > 1);
+
+  Prism inside = {Vec3(0.0,  0.0, 0.5),  0.1, 0.1, 0.1, Quaternion::identity()};
+  Prism wall   = {Vec3(0.55, 0.0, 0.5),  0.1, 0.1, 0.1, Quaternion::identity()};
+  Prism floor  = {Vec3(0.0,  0.0, 0.05), 0.1, 0.1, 0.1, Quaternion::identity()};
+  Sphere dome  = {Vec3(0.0,  0.3, 0.4),  0.25};
+
+  BOOST_TEST(!intersect(inside, tank));
+  BOOST_TEST(intersect(wall, tank));
+  BOOST_TEST(intersect(floor, tank));
+  BOOST_TEST(!intersect(dome, tank));
+  BOOST_TEST(intersect(inside, tank, Vec3(0.5, 0.0, 0.0)));
+  BOOST_TEST(!intersect(inside, tank, Vec3(0.2, 0.2, 0.0)));
+
+  // second load comes from the cache
+  auto cached = MeshImport::read_cache(cache, MeshImport::mesh_hash(path, DEFAULT_DECOMPOSITION));
+  BOOST_TEST(!has<MeshImport::ErrorType>(cached));
+  if (!has<MeshImport::ErrorType>(cached)) {
+    BOOST_TEST(get<vector<ConvexPiece>>(cached).size() == tank.pieces.size());
+  }
+
+  // different parameters must not reuse it
+  DecompositionParams coarse = DEFAULT_DECOMPOSITION;
+  coarse.concavity = 0.05;
+  auto stale = MeshImport::read_cache(cache, MeshImport::mesh_hash(path, coarse));
+  BOOST_TEST(has<MeshImport::ErrorType>(stale));
+}
+
+
 /*
  ***********************
  * Serialization Tests *
@@ -1394,4 +1777,71 @@ BOOST_AUTO_TEST_CASE(testPathExistsMultiObstacle, _TOL) {
 }
 
 
+BOOST_AUTO_TEST_SUITE_END();
+
+
+/*
+ * Gantry configuration (pathcalc/TGantryConfigCalculator, used by feMove and feScan)
+ */
+
+
+BOOST_AUTO_TEST_SUITE(GantryConfig);
+
+
+// The batch versions, pose by pose, against the single pose versions
+BOOST_AUTO_TEST_CASE(testBatchMatchesSinglePose, _TOL) {
+  TGantryConfigCalculator calc(0.160, 0.140, 0.25, 0.160, 0.060, 0.095);
+
+  const int n = 37;
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<double> angle(-2.0, 2.0), pos(-0.5, 0.5);
+  std::vector<double> rot(n), tilt(n), x(n), y(n), z(n);
+  for (int i = 0; i < n; ++i) {
+    rot[i] = angle(gen);
+    tilt[i] = angle(gen);
+    x[i] = pos(gen);
+    y[i] = pos(gen);
+    z[i] = pos(gen);
+  }
+
+  for (int gantry = 0; gantry < 2; ++gantry) {
+    std::vector<double> gantryCorners(8 * n), boxCorners(16 * n), zLower(n), zUpper(n);
+    double *gantryX[4], *gantryY[4], *boxX[8], *boxY[8];
+    for (int c = 0; c < 4; ++c) {
+      gantryX[c] = &gantryCorners[c * n];
+      gantryY[c] = &gantryCorners[(c + 4) * n];
+    }
+    for (int c = 0; c < 8; ++c) {
+      boxX[c] = &boxCorners[c * n];
+      boxY[c] = &boxCorners[(c + 8) * n];
+    }
+
+    calc.GetGantryConfig(gantry, n, rot.data(), tilt.data(), x.data(), y.data(), gantryX, gantryY);
+    calc.GetOpticalBoxConfig(gantry, n, rot.data(), tilt.data(), x.data(), y.data(), boxX, boxY);
+    calc.GetOpticalBoxZ(gantry, n, tilt.data(), z.data(), zLower.data(), zUpper.data());
+
+    for (int i = 0; i < n; ++i) {
+      XYPolygon single = calc.GetGantryConfig(gantry, rot[i], tilt[i], x[i], y[i]);
+      BOOST_TEST(single.size() == 4u);
+      for (int c = 0; c < 4; ++c) {
+        BOOST_TEST(gantryX[c][i] == single[c].first);
+        BOOST_TEST(gantryY[c][i] == single[c].second);
+      }
+
+      std::pair<XYPolygon, XYPolygon> box = calc.GetOpticalBoxConfig(gantry, rot[i], tilt[i], x[i], y[i]);
+      for (int c = 0; c < 4; ++c) {
+        BOOST_TEST(boxX[c][i] == box.first[c].first);
+        BOOST_TEST(boxY[c][i] == box.first[c].second);
+        BOOST_TEST(boxX[c + 4][i] == box.second[c].first);
+        BOOST_TEST(boxY[c + 4][i] == box.second[c].second);
+      }
+
+      std::pair<double, double> boxZ = calc.GetOpticalBoxZ(gantry, tilt[i], z[i]);
+      BOOST_TEST(zLower[i] == boxZ.first);
+      BOOST_TEST(zUpper[i] == boxZ.second);
+    }
+  }
+}
+
+
 BOOST_AUTO_TEST_SUITE_END();
@@ -1,1264 +0,0 @@
-// generated Fri, 02 Nov 18 13:29:14
-#define DEMO_PATH_LENGTH 1260
-static const double DEMO_PATH [1260][10] = {
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.0, 0.1, -97.47155917659236, -28.449210661963036},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.05, 0.1, -98.63713141507073, -32.035603239205315},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.1, 0.1, -100.22900828735952, -36.498819559700486},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.15, 0.1, -102.52880770915151, -42.10970018491298},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.2, 0.1, -106.1275758259598, -49.17290853614624},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.25, 0.1, -112.47943439710312, -57.88374649434333},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.3, 0.1, -126.02737338510362, -67.80237359833951},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.35, 0.1, -161.565051177078, -75.80305258251586},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.4, 0.1, 144.68878656036676, -73.61092497417658},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.45, 0.1, 119.7448812969422, -64.18529921598197},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.5, 0.1, 109.70797884297873, -54.56099318941614},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.55, 0.1, 104.62087398863163, -46.44504412147174},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.6, 0.1, 101.59217541029106, -39.93833559151254},
-  {0.005, 0.69, 0.005, -90, 0, 0.3, 0.65, 0.1, 99.59313426273035, -34.77524259564152},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.696, 0.1, 89.65275710291421, -31.217936358307536},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.646, 0.1, 89.59075139196506, -35.536986502387954},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.596, 0.1, 89.50178838738634, -41.00801434177182},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.546, 0.1, 89.36340642403651, -48.01102898887943},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.496, 0.1, 89.11859600341785, -56.97303441116437},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.446, 0.1, 88.56790381583535, -68.19241762993539},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.396, 0.1, 86.18592516570962, -81.45057767898804},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.346, 0.1, -84.28940686250037, -84.26111457290624},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.296, 0.1, -88.36342295838325, -70.70266373436364},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.246, 0.1, -89.0451587461278, -59.03273306994682},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.196, 0.1, -89.32596310201548, -49.63350689538788},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.146, 0.1, -89.47914362549804, -42.27251061655126},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.096, 0.1, -89.57559458063851, -36.52810355149923},
-  {0.005, 0.69, 0.005, -90, 0, 0.35, 0.046, 0.1, -89.64190604067642, -32.004880272555894},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.0, 0.1, -81.91373526507341, -28.414051858370364},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.05, 0.1, -80.65532809790024, -31.98528444825048},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.1, 0.1, -78.93881753840822, -36.424058781356074},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.15, 0.1, -76.46414363086576, -41.99376669370959},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.2, 0.1, -72.60667785308794, -48.98422979919778},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.25, 0.1, -65.8544580395783, -57.55955464573639},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.3, 0.1, -51.76617482255299, -67.21179720229091},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.35, 0.1, -17.10272896905237, -74.78210430153594},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.4, 0.1, 33.17851165939274, -72.74288084210158},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.45, 0.1, 58.240519915187186, -63.712306325910866},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.5, 0.1, 68.79077386577718, -54.295977992609664},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.55, 0.1, 74.21924669048457, -46.28764277426851},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.6, 0.1, 77.47119229084849, -39.83986093355684},
-  {0.005, 0.69, 0.005, -90, 0, 0.4, 0.65, 0.1, 79.62415507994892, -34.71071333611306},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.696, 0.1, 72.82409638425325, -30.07221029735078},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.646, 0.1, 69.98404039711731, -33.86717910872586},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.596, 0.1, 66.08375458238062, -38.481312096320806},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.546, 0.1, 60.46121774044189, -44.02970818944462},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.496, 0.1, 51.88172363063697, -50.43661519605972},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.446, 0.1, 38.10757687751484, -57.050661069489315},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.396, 0.1, 16.38954033403479, -62.00482776668501},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.346, 0.1, -11.093723011557842, -62.538583304425046},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.296, 0.1, -34.46081627137181, -58.26127432376674},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.246, 0.1, -49.63546342690267, -51.780831008367976},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.196, 0.1, -59.03624346792648, -45.251427257684895},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.146, 0.1, -65.12584608587231, -39.51438161936387},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.096, 0.1, -69.30454926593673, -34.719725498358244},
-  {0.005, 0.69, 0.005, -90, 0, 0.45, 0.046, 0.1, -72.32031902256112, -30.772985368915403},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.0, 0.1, -67.44686147308924, -26.778162078078736},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.05, 0.1, -64.31185656435267, -29.69864977995456},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.1, 0.1, -60.255118703057796, -33.13708056090696},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.15, 0.1, -54.86580694308439, -37.134031132049415},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.2, 0.1, -47.520827907710185, -41.62370825612496},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.25, 0.1, -37.34934904464055, -46.28764277426852},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.3, 0.1, -23.470993118160862, -50.3564526276553},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.35, 0.1, -6.009005957494529, -52.61297625984722},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.4, 0.1, 12.608606793366251, -52.08921551990693},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.45, 0.1, 28.9264258352536, -49.03118120542071},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.5, 0.1, 41.39872188277656, -44.62536850893026},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.55, 0.1, 50.44033203100548, -39.963071662595596},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.6, 0.1, 56.993348723586955, -35.63137987649332},
-  {0.005, 0.69, 0.005, -90, 0, 0.5, 0.65, 0.1, 61.84380855172743, -31.835752956547992},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.696, 0.1, 58.528315466372675, -27.334806325805538},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.646, 0.1, 54.192243092845814, -30.08262857287933},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.596, 0.1, 48.708428157130434, -33.158897304286235},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.546, 0.1, 41.703884027453675, -36.47185172416455},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.496, 0.1, 32.76388849058364, -39.78015740037948},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.446, 0.1, 21.605527242638463, -42.630672181906654},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.396, 0.1, 8.447527247908463, -44.40248281970131},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.346, 0.1, -5.654420822640724, -44.57522630466507},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.296, 0.1, -19.11297373367326, -43.09193922688994},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.246, 0.1, -30.712827715158845, -40.40528222812666},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.196, 0.1, -40.08343399398996, -37.14510403081672},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.146, 0.1, -47.44241531065705, -33.80762995981254},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.096, 0.1, -53.19806884601629, -30.673001601268187},
-  {0.005, 0.69, 0.005, -90, 0, 0.55, 0.046, 0.1, -57.737830703874046, -27.85685668386191},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.0, 0.1, -55.45163294398863, -24.23159226071339},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.05, 0.1, -51.428747748829856, -26.327644407013015},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.1, 0.1, -46.54815769897795, -28.62699596773861},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.15, 0.1, -40.60129464500447, -31.072519853517942},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.2, 0.1, -33.37410135669134, -33.53542538011775},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.25, 0.1, -24.71744091108342, -35.78923805742373},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.3, 0.1, -14.67639313745, -37.51545841424427},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.35, 0.1, -3.6329507394882645, -38.381192617291106},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.4, 0.1, 7.683981829733967, -38.18591072832606},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.45, 0.1, 18.434948822922006, -36.97694093889014},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.5, 0.1, 28.001634812636414, -35.02052073700414},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.55, 0.1, 36.135376611589194, -32.65877360147005},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.6, 0.1, 42.87890360333854, -30.18151785866054},
-  {0.005, 0.69, 0.005, -90, 0, 0.6, 0.65, 0.1, 48.41658819177135, -27.77818563311806},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.696, 0.1, 47.53676173815996, -24.089292728134613},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.646, 0.1, 42.83521084654648, -25.902934486681332},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.596, 0.1, 37.292514277035, -27.78277551162538},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.546, 0.1, 30.796062046485964, -29.634288946571708},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.496, 0.1, 23.290117240128755, -31.311639488769494},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.446, 0.1, 14.83690876156067, -32.62620458218105},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.396, 0.1, 5.673022139925316, -33.38520555059909},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.346, 0.1, -3.78888987788467, -33.456894396157686},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.296, 0.1, -13.050028553666849, -32.82799860124042},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.246, 0.1, -21.670447932676428, -31.61004483155003},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.196, 0.1, -29.375765418813128, -29.98925490642013},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.146, 0.1, -36.07247040807198, -28.159255175796023},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.096, 0.1, -41.79797941667782, -26.27593487597346},
-  {0.005, 0.69, 0.005, -90, 0, 0.65, 0.046, 0.1, -46.6576145951098, -24.443731807996585},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.0, 0.1, -46.11704635031856, -21.49732229745711},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.05, 0.1, -41.91518766950245, -22.91882078277171},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.1, 0.1, -37.07767834699939, -24.385080352640788},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.15, 0.1, -31.534791905188264, -25.839713081348723},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.2, 0.1, -25.248138771284736, -27.198760382669246},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.25, 0.1, -18.239400846651193, -28.35283824403137},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.3, 0.1, -10.619655276155132, -29.181179377822094},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.35, 0.1, -2.6025622024998043, -29.579060474293325},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.4, 0.1, 5.517135978988046, -29.490317295050176},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.45, 0.1, 13.421835067886201, -28.927820136687583},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.5, 0.1, 20.84091933956731, -27.96860246209042},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.55, 0.1, 27.597295868643712, -26.7269542479816},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.6, 0.1, 33.61487625744826, -25.322063809997577},
-  {0.005, 0.69, 0.005, -90, 0, 0.7, 0.65, 0.1, 38.89722034634421, -23.855058202489865},
-};
\ No newline at end of file
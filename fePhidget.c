@@ -43,6 +43,7 @@ to accommodate multiple phidgets.
 #include <string.h>
 #include <phidget21.h>
 #include <mfe.h>
+#include "TiltStream.hxx"
 
 
 
@@ -130,6 +131,12 @@ double tilt = 0;
 int etime = 0;
 int etime_us = 0;
 
+// Every sample also goes to feMove through the tilt stream (see TiltStream.hxx).
+// Rate and filter are set in frontend_init from /Equipment/Phidget0x/Settings.
+TILT_STREAM *tiltStream = NULL;
+INT dataRate = 32;              // ms between samples
+double tiltTimeConstant = 100;  // ms, low-pass filter of the streamed tilt
+
 // ---------------------------------------------------------------
 // Phidget Spatial setup routines.
 
@@ -140,7 +147,7 @@ int CCONV AttachHandler(CPhidgetHandle spatial, void *userptr)
   CPhidget_getSerialNumber(spatial, &serialNo);
   cm_msg(MINFO, "AttachHandler", "Phidget Spatial attached. Serial Number = %i", serialNo);
   //Set the data rate for the spatial events
-  CPhidgetSpatial_setDataRate((CPhidgetSpatialHandle)spatial, 320);  
+  CPhidgetSpatial_setDataRate((CPhidgetSpatialHandle)spatial, dataRate);
   
   return 0;
 }
@@ -197,6 +204,8 @@ int CCONV SpatialDataHandler(CPhidgetSpatialHandle spatial, void *userptr, CPhid
       etime = data[i]->timestamp.seconds;
       etime_us = data[i]->timestamp.microseconds;
 
+      post_tilt_sample(tiltStream, acceleration, tilt, etime * 1000. + etime_us / 1000., tiltTimeConstant);
+
     }
   
    
@@ -287,6 +296,18 @@ INT frontend_init()
   }
   printf("Connected to phidget with serial number %i \n",serial_number);
 
+  /* tilt stream for feMove */
+  sprintf(variable_name,"/Equipment/Phidget%02d/Settings/Data Rate (ms)",get_frontend_index());
+  size = sizeof(dataRate);
+  db_get_value(hDB, 0, variable_name, &dataRate, &size, TID_INT, TRUE);
+  sprintf(variable_name,"/Equipment/Phidget%02d/Settings/Tilt Filter (ms)",get_frontend_index());
+  size = sizeof(tiltTimeConstant);
+  db_get_value(hDB, 0, variable_name, &tiltTimeConstant, &size, TID_DOUBLE, TRUE);
+
+  tiltStream = open_tilt_stream(get_frontend_index(), TRUE);
+  if(!tiltStream)
+    cm_msg(MERROR,"frontend_init","Cannot open the tilt stream, feMove will only see the ODB readings");
+
 
 
   // --------------------------------- ---------------------  
@@ -333,7 +354,7 @@ INT frontend_init()
   display_properties((CPhidgetHandle)spatial);
   
   //Set the data rate for the spatial events
-  CPhidgetSpatial_setDataRate(spatial, 320);  
+  CPhidgetSpatial_setDataRate(spatial, dataRate);
 
 
 
@@ -0,0 +1,69 @@
+#include "MotorOrigins.hxx"
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+
+
+// FNV-1a of everything before the checksum
+//----------------------------------------------------------
+static uint32_t origins_checksum(const MOTOR_ORIGINS *origins) {
+//----------------------------------------------------------
+
+  const unsigned char *bytes = (const unsigned char *) origins;
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < offsetof(MOTOR_ORIGINS, Checksum); i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+
+}
+
+//----------------------------------------------------------
+bool save_motor_origins(const char *path, MOTOR_ORIGINS *origins) {
+//----------------------------------------------------------
+
+  strncpy(origins->Magic, MOTOR_ORIGINS_MAGIC, sizeof(origins->Magic));
+  origins->Version = MOTOR_ORIGINS_VERSION;
+  origins->Checksum = origins_checksum(origins);
+
+  char tmpPath[1024];
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+
+  FILE *file = fopen(tmpPath, "wb");
+  if (!file) {
+    cm_msg(MERROR, "save_motor_origins", "Cannot write motor origins %s: %s", tmpPath, strerror(errno));
+    return false;
+  }
+  bool ok = fwrite(origins, sizeof(*origins), 1, file) == 1;
+  ok = (fclose(file) == 0) && ok;
+
+  if (!ok || rename(tmpPath, path) != 0) {
+    cm_msg(MERROR, "save_motor_origins", "Cannot write motor origins %s: %s", path, strerror(errno));
+    unlink(tmpPath);
+    return false;
+  }
+  return true;
+
+}
+
+//----------------------------------------------------------
+bool load_motor_origins(const char *path, MOTOR_ORIGINS *origins) {
+//----------------------------------------------------------
+
+  FILE *file = fopen(path, "rb");
+  if (!file) return false; // never saved
+  bool ok = fread(origins, sizeof(*origins), 1, file) == 1;
+  fclose(file);
+
+  if (!ok || strncmp(origins->Magic, MOTOR_ORIGINS_MAGIC, sizeof(origins->Magic)) != 0 ||
+      origins->Version != MOTOR_ORIGINS_VERSION || origins->Checksum != origins_checksum(origins)) {
+    cm_msg(MINFO, "load_motor_origins", "Motor origins %s are damaged or from another version, not using them",
+           path);
+    return false;
+  }
+  return true;
+
+}
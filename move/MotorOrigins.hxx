@@ -0,0 +1,39 @@
+#ifndef MotorOrigins_H
+#define MotorOrigins_H
+
+#include <stdint.h>
+#include "midas.h"
+
+/* Motor origins kept across restarts of feMove
+ *
+ * initialize finds the motor counts at the origins (the limit switches) by driving every axis into its switch,
+ * which takes minutes. The counts only stay good as long as the Galil keeps counting: feMove saves the origins
+ * together with the counts the motors stopped at, and after a restart takes them again instead of homing if the
+ * motors still stand at those counts. The Galil starts counting from 0 when it is powered up, and any motion
+ * without feMove changes the counts, so either makes feMove home again.
+ *
+ * The file is written under a temporary name and renamed, so it is never found half written.
+ */
+
+#define MOTOR_ORIGINS_MAGIC "PTFORIG"
+#define MOTOR_ORIGINS_VERSION 1
+
+typedef struct {
+  char Magic[8];
+  uint32_t Version;
+  uint32_t Time;                  // ss_time() when saved
+  int32_t GantryMotors[2];        // gantry_motor_start, gantry_motor_end
+  float Scale[10];                // "Motor Scaling" and "Limit Positions" the origins were found with
+  float LimPos[10];
+  float Origin[10];               // motor counts at the origins (pInfo->mOrigin)
+  float Counts[10];               // motor counts when saved, with the motors stopped
+  uint32_t Checksum;              // of everything before it
+} MOTOR_ORIGINS;
+
+// Fills in Magic, Version and Checksum and writes the origins to path
+bool save_motor_origins(const char *path, MOTOR_ORIGINS *origins);
+
+// Reads the origins saved in path. False if there are none, or they are from another version or damaged.
+bool load_motor_origins(const char *path, MOTOR_ORIGINS *origins);
+
+#endif
@@ -0,0 +1,48 @@
+#include "MoveCompletion.hxx"
+#include "SharedBlock.hxx"
+#include <string.h>
+
+
+//----------------------------------------------------------
+MOVE_COMPLETION *open_move_completion(BOOL create) {
+//----------------------------------------------------------
+
+  return (MOVE_COMPLETION *) open_shared_block(MOVE_COMPLETION_SHM, sizeof(MOVE_COMPLETION), create);
+
+}
+
+//----------------------------------------------------------
+void post_move_completion(MOVE_COMPLETION *completion, BOOL completed, BOOL badDestination, const float *position,
+                          const MOVE_COMPLETION_TIMES *times) {
+//----------------------------------------------------------
+
+  if (!completion) return;
+
+  uint32_t sequence = begin_shared_block_write(&completion->Sequence);
+
+  completion->Completed = completed;
+  completion->BadDestination = badDestination;
+  completion->Time = ss_millitime();
+  memcpy(completion->Position, position, sizeof(completion->Position));
+  if (times) completion->Times = *times;
+  else memset(&completion->Times, 0, sizeof(completion->Times));
+
+  end_shared_block_write(&completion->Sequence, sequence);
+
+}
+
+//----------------------------------------------------------
+uint32_t move_completion_sequence(const MOVE_COMPLETION *completion) {
+//----------------------------------------------------------
+
+  return shared_block_sequence(&completion->Sequence);
+
+}
+
+//----------------------------------------------------------
+BOOL wait_move_completion(MOVE_COMPLETION *completion, uint32_t sequence, INT timeout, MOVE_COMPLETION *result) {
+//----------------------------------------------------------
+
+  return wait_shared_block(&completion->Sequence, sequence, timeout, result, sizeof(*result));
+
+}
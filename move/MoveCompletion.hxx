@@ -0,0 +1,57 @@
+#ifndef MoveCompletion_H
+#define MoveCompletion_H
+
+#include <stdint.h>
+#include "midas.h"
+
+/* Move completion notice from feMove to feScan
+ *
+ * feMove publishes the outcome of every "Start Move" in a small shared memory block as soon as it is known,
+ * together with the final positions, and wakes up whoever waits for it. feScan waits on it (a futex) instead
+ * of polling "Moving" and "Completed" in the ODB, so it goes on within a millisecond of the motors stopping.
+ * The ODB variables are still set as before, for everything else that looks at them.
+ *
+ * Sequence works as a seqlock (see SharedBlock.hxx): it is odd while feMove writes the block and goes up by 2
+ * with every notice.
+ * Both programs have to run on the same machine; if the block cannot be opened feScan polls the ODB.
+ */
+
+#define MOVE_COMPLETION_SHM "/ptf_move_completion"
+
+// Where the time of a move went (ms), summed over its waypoints (see WAYPOINT_TIMING in feMove)
+typedef struct {
+  uint32_t Planning;          // generate_path
+  uint32_t Motion;            // from commanding the motors until they were seen to stop
+  uint32_t Settle;            // from the motors stopping until their positions were checked
+} MOVE_COMPLETION_TIMES;
+
+typedef struct {
+  volatile uint32_t Sequence; // even when the block is consistent
+  uint32_t Completed;         // "Completed": the move reached its destination (or was never started)
+  uint32_t BadDestination;    // "Bad Destination": feMove refused the destination
+  uint32_t Time;              // ss_millitime() of feMove when the motors stopped
+  float Position[10];         // "Position" once the motors stopped
+  MOVE_COMPLETION_TIMES Times;
+} MOVE_COMPLETION;
+
+// feScan also tells feMove where the next moves go, so that it can plan them while the gantries are moving
+// (see prefetch_thread in feMove): the destination of the move being started and the ones after it,
+// with no -999 values. Rows after the end of the scan are all -999.
+#define UPCOMING_DESTINATIONS     8
+#define UPCOMING_DESTINATIONS_KEY "/Equipment/Move/Control/Upcoming Destinations"
+
+// Maps the block, creating it if create is set (feMove). Returns NULL if it cannot.
+MOVE_COMPLETION *open_move_completion(BOOL create);
+
+// feMove: publishes the outcome of a move and wakes up the waiters. times may be NULL.
+void post_move_completion(MOVE_COMPLETION *completion, BOOL completed, BOOL badDestination, const float *position,
+                          const MOVE_COMPLETION_TIMES *times);
+
+// feScan: the sequence to wait beyond, taken before the move is started
+uint32_t move_completion_sequence(const MOVE_COMPLETION *completion);
+
+// feScan: waits up to timeout ms for a notice after sequence, and copies it to result.
+// Returns FALSE on a timeout.
+BOOL wait_move_completion(MOVE_COMPLETION *completion, uint32_t sequence, INT timeout, MOVE_COMPLETION *result);
+
+#endif
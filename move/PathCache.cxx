@@ -0,0 +1,218 @@
+#include "PathCache.hxx"
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+//----------------------------------------------------------
+PATH_CACHE *open_path_cache(const char *path, uint32_t numSets) {
+//----------------------------------------------------------
+
+  if (numSets == 0) return NULL;
+
+  int fd = open(path, O_RDWR | O_CREAT, 0666);
+  if (fd < 0) {
+    cm_msg(MERROR, "open_path_cache", "Cannot open path cache %s: %s", path, strerror(errno));
+    return NULL;
+  }
+
+  const size_t length = sizeof(PATH_CACHE_HEADER) + (size_t) numSets * PATH_CACHE_WAYS * sizeof(PATH_CACHE_ENTRY);
+  struct stat st;
+  bool fresh = fstat(fd, &st) != 0 || (size_t) st.st_size != length;
+  if (fresh && (ftruncate(fd, 0) != 0 || ftruncate(fd, length) != 0)) {
+    cm_msg(MERROR, "open_path_cache", "Cannot size path cache %s: %s", path, strerror(errno));
+    close(fd);
+    return NULL;
+  }
+
+  void *map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    cm_msg(MERROR, "open_path_cache", "Cannot map path cache %s: %s", path, strerror(errno));
+    return NULL;
+  }
+
+  PATH_CACHE *cache = (PATH_CACHE *) calloc(1, sizeof(PATH_CACHE));
+  cache->Header = (PATH_CACHE_HEADER *) map;
+  cache->Entries = (PATH_CACHE_ENTRY *) ((char *) map + sizeof(PATH_CACHE_HEADER));
+  cache->Length = length;
+
+  PATH_CACHE_HEADER *header = cache->Header;
+  if (fresh || strncmp(header->Magic, PATH_CACHE_MAGIC, sizeof(header->Magic)) != 0 ||
+      header->Version != PATH_CACHE_VERSION || header->NumSets != numSets) {
+    memset(map, 0, length);
+    strncpy(header->Magic, PATH_CACHE_MAGIC, sizeof(header->Magic));
+    header->Version = PATH_CACHE_VERSION;
+    header->NumSets = numSets;
+  }
+
+  int numPaths = 0;
+  for (uint32_t i = 0; i < numSets * PATH_CACHE_WAYS; i++) {
+    if (cache->Entries[i].LastUsed) numPaths++;
+  }
+  cm_msg(MINFO, "open_path_cache", "Path cache %s holds %i of %i paths", path, numPaths,
+         numSets * PATH_CACHE_WAYS);
+  return cache;
+
+}
+
+//----------------------------------------------------------
+uint32_t path_cache_hash(const void *data, size_t length, uint32_t hash) {
+//----------------------------------------------------------
+
+  const unsigned char *bytes = (const unsigned char *) data;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+
+}
+
+// Empties the cache if it was filled for another scene
+//----------------------------------------------------------
+static void check_scene(PATH_CACHE *cache, uint32_t sceneHash) {
+//----------------------------------------------------------
+
+  PATH_CACHE_HEADER *header = cache->Header;
+  if (header->SceneHash == sceneHash) return;
+
+  if (header->Clock) {
+    cm_msg(MINFO, "path_cache", "Collision scene or gantry settings changed, path cache emptied");
+  }
+  memset(cache->Entries, 0, (size_t) header->NumSets * PATH_CACHE_WAYS * sizeof(PATH_CACHE_ENTRY));
+  header->SceneHash = sceneHash;
+  header->Clock = 0;
+
+}
+
+//----------------------------------------------------------
+static void make_key(float quantum, const float *start, const float *dest, int32_t *key) {
+//----------------------------------------------------------
+
+  for (int i = 0; i < 10; i++) {
+    key[i] = (int32_t) lround(start[i] / quantum);
+    key[10 + i] = (int32_t) lround(dest[i] / quantum);
+  }
+
+}
+
+// First entry of the set the key belongs to
+//----------------------------------------------------------
+static PATH_CACHE_ENTRY *find_set(PATH_CACHE *cache, const int32_t *key) {
+//----------------------------------------------------------
+
+  uint32_t set = path_cache_hash(key, 20 * sizeof(int32_t)) % cache->Header->NumSets;
+  return &cache->Entries[set * PATH_CACHE_WAYS];
+
+}
+
+//----------------------------------------------------------
+static uint32_t next_use(PATH_CACHE *cache) {
+//----------------------------------------------------------
+
+  // 0 is for empty entries; after 4 billion moves all entries just look equally old
+  if (++cache->Header->Clock == 0) cache->Header->Clock = 1;
+  return cache->Header->Clock;
+
+}
+
+// Whether axis i moves anywhere along the path of the entry
+//----------------------------------------------------------
+static bool axis_moves(const PATH_CACHE_ENTRY &entry, int i) {
+//----------------------------------------------------------
+
+  if (entry.Dest[i] != entry.Start[i]) return true;
+  for (uint32_t j = 0; j < entry.NumWaypoints; j++) {
+    if (entry.Path[j][i] != entry.Start[i]) return true;
+  }
+  return false;
+
+}
+
+// The waypoints were checked for collisions with the axes at exactly the start and destination of the entry.
+// An axis that moves has to start and end at exactly those counts again, so every waypoint is the one that was
+// checked; an axis that stays put has to stay put now, and stays where it is.
+//----------------------------------------------------------
+static bool entry_fits(const PATH_CACHE_ENTRY &entry, const float *start, const float *dest) {
+//----------------------------------------------------------
+
+  for (int i = 0; i < 10; i++) {
+    if (axis_moves(entry, i)) {
+      if (start[i] != entry.Start[i] || dest[i] != entry.Dest[i]) return false;
+    } else if (dest[i] != start[i]) {
+      return false;
+    }
+  }
+  return true;
+
+}
+
+//----------------------------------------------------------
+int find_cached_path(PATH_CACHE *cache, uint32_t sceneHash, float quantum, const float *start, const float *dest,
+                     float path[][10]) {
+//----------------------------------------------------------
+
+  if (!cache) return 0;
+  check_scene(cache, sceneHash);
+
+  int32_t key[20];
+  make_key(quantum, start, dest, key);
+  PATH_CACHE_ENTRY *set = find_set(cache, key);
+
+  for (int w = 0; w < PATH_CACHE_WAYS; w++) {
+    PATH_CACHE_ENTRY &entry = set[w];
+    if (!entry.LastUsed || memcmp(entry.Key, key, sizeof(key)) != 0) continue;
+    if (!entry_fits(entry, start, dest)) break;
+
+    const int n = entry.NumWaypoints;
+    for (int j = 0; j < n; j++) {
+      for (int i = 0; i < 10; i++) path[j][i] = axis_moves(entry, i) ? entry.Path[j][i] : start[i];
+    }
+    entry.LastUsed = next_use(cache);
+    cache->Hits++;
+    return n;
+  }
+
+  cache->Misses++;
+  return 0;
+
+}
+
+//----------------------------------------------------------
+void store_cached_path(PATH_CACHE *cache, uint32_t sceneHash, float quantum, const float *start, const float *dest,
+                       const float path[][10], int numWaypoints) {
+//----------------------------------------------------------
+
+  if (!cache || numWaypoints <= 0 || numWaypoints > PATH_CACHE_MAX_WAYPOINTS) return;
+  check_scene(cache, sceneHash);
+
+  int32_t key[20];
+  make_key(quantum, start, dest, key);
+  PATH_CACHE_ENTRY *set = find_set(cache, key);
+
+  // The same move again (it was just planned because it was not found), else an empty or the oldest entry
+  PATH_CACHE_ENTRY *entry = &set[0];
+  for (int w = 0; w < PATH_CACHE_WAYS; w++) {
+    if (set[w].LastUsed && memcmp(set[w].Key, key, sizeof(key)) == 0) {
+      entry = &set[w];
+      break;
+    }
+    if (set[w].LastUsed < entry->LastUsed) entry = &set[w];
+  }
+
+  // Marked empty while it is written, in case feMove dies half way
+  entry->LastUsed = 0;
+  memcpy(entry->Key, key, sizeof(key));
+  memcpy(entry->Start, start, sizeof(entry->Start));
+  memcpy(entry->Dest, dest, sizeof(entry->Dest));
+  entry->NumWaypoints = numWaypoints;
+  memcpy(entry->Path, path, numWaypoints * sizeof(entry->Path[0]));
+  entry->LastUsed = next_use(cache);
+
+}
@@ -0,0 +1,72 @@
+#ifndef PathCache_H
+#define PathCache_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "midas.h"
+
+/* Cache of the paths planned by feMove
+ *
+ * Scans repeat the same moves run after run (the return to base, the same transitions between rows, the
+ * same alignment points), so generate_path keeps the paths it planned in a file, mapped into memory, and uses
+ * them again instead of planning the same move twice. The file outlives feMove, so the cache also works
+ * across restarts.
+ *
+ * A path is found by its start and destination: the axis positions in counts from the origins (the limit
+ * switches), divided by a quantum and rounded. Paths are kept in counts from the origins as well, so they stay
+ * good when the motors are initialized again. The quantum only picks the entry: a path is used again only if
+ * the axes it moves are at exactly the counts it was planned for (see find_cached_path). Everything else a path
+ * depends on (collision scene, gantry dimensions, limit positions, scales, quantum) goes into the scene hash; the
+ * cache is emptied when it changes.
+ *
+ * The file has a fixed number of entries, in sets of PATH_CACHE_WAYS; a new path replaces the least recently
+ * used one of its set. Only paths of up to PATH_CACHE_MAX_WAYPOINTS waypoints are kept.
+ */
+
+#define PATH_CACHE_MAGIC "PTFPATH"
+#define PATH_CACHE_VERSION 1
+#define PATH_CACHE_WAYS 4
+#define PATH_CACHE_MAX_WAYPOINTS 32
+
+typedef struct {
+  char Magic[8];
+  uint32_t Version;
+  uint32_t NumSets;
+  uint32_t SceneHash;
+  uint32_t Clock;                 // goes up with every use of an entry
+} PATH_CACHE_HEADER;
+
+typedef struct {
+  uint32_t LastUsed;              // Clock when last used, 0 for an empty entry
+  int32_t Key[20];                // quantized start and destination
+  float Start[10];                // exact start and destination the path was planned for
+  float Dest[10];
+  uint32_t NumWaypoints;
+  float Path[PATH_CACHE_MAX_WAYPOINTS][10];
+} PATH_CACHE_ENTRY;
+
+typedef struct {
+  PATH_CACHE_HEADER *Header;
+  PATH_CACHE_ENTRY *Entries;      // NumSets * PATH_CACHE_WAYS
+  size_t Length;
+  uint32_t Hits, Misses;          // since feMove was started
+} PATH_CACHE;
+
+// Maps the cache file, creating it (or starting it again, if it has another size or version). NULL if it cannot.
+PATH_CACHE *open_path_cache(const char *path, uint32_t numSets);
+
+// FNV-1a, for building the scene hash
+uint32_t path_cache_hash(const void *data, size_t length, uint32_t hash = 2166136261u);
+
+// Looks for the path from start to dest (counts from the origins). A path is only used if every axis that moves
+// along it starts and ends at exactly the counts it was planned (and checked for collisions) with, and every
+// other axis stays put; those are kept where they are. Returns the number of waypoints written to path, 0 if
+// there is none.
+int find_cached_path(PATH_CACHE *cache, uint32_t sceneHash, float quantum, const float *start, const float *dest,
+                     float path[][10]);
+
+// Keeps a path (waypoints x axes, counts from the origins) planned from start to dest
+void store_cached_path(PATH_CACHE *cache, uint32_t sceneHash, float quantum, const float *start, const float *dest,
+                       const float path[][10], int numWaypoints);
+
+#endif
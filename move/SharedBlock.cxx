@@ -0,0 +1,93 @@
+#include "SharedBlock.hxx"
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <limits.h>
+#include <linux/futex.h>
+
+
+//----------------------------------------------------------
+void *open_shared_block(const char *name, size_t size, BOOL create) {
+//----------------------------------------------------------
+
+  int fd = shm_open(name, create ? (O_RDWR | O_CREAT) : O_RDWR, 0666);
+  if (fd < 0) return NULL;
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || ((size_t) st.st_size < size && (!create || ftruncate(fd, size) != 0))) {
+    close(fd);
+    return NULL;
+  }
+
+  void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  return map == MAP_FAILED ? NULL : map;
+
+}
+
+//----------------------------------------------------------
+uint32_t begin_shared_block_write(volatile uint32_t *sequence) {
+//----------------------------------------------------------
+
+  // A sequence left odd by a writer that died while writing is made even first
+  uint32_t next = (*sequence | 1) + 1;
+  *sequence = next - 1;
+  __sync_synchronize();
+  return next;
+
+}
+
+//----------------------------------------------------------
+void end_shared_block_write(volatile uint32_t *sequence, uint32_t next) {
+//----------------------------------------------------------
+
+  __sync_synchronize();
+  *sequence = next;
+  syscall(SYS_futex, sequence, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+
+}
+
+//----------------------------------------------------------
+uint32_t shared_block_sequence(const volatile uint32_t *sequence) {
+//----------------------------------------------------------
+
+  return *sequence & ~1u;
+
+}
+
+//----------------------------------------------------------
+BOOL wait_shared_block(volatile uint32_t *block, uint32_t sequence, INT timeout, void *result, size_t size) {
+//----------------------------------------------------------
+
+  DWORD start = ss_millitime();
+
+  for (;;) {
+    uint32_t now = *block;
+
+    if (now != sequence && (now & 1) == 0) {
+      // Copy the block, and again if the writer wrote it again meanwhile
+      __sync_synchronize();
+      memcpy(result, (const void *) block, size);
+      __sync_synchronize();
+      if (*block == now) {
+        *(uint32_t *) result = now;
+        return TRUE;
+      }
+      continue;
+    }
+
+    INT left = timeout - (INT) (ss_millitime() - start);
+    if (left <= 0) return FALSE;
+
+    // Sleeps until the writer wakes us up, unless the sequence changed in the meantime
+    struct timespec wait;
+    wait.tv_sec = left / 1000;
+    wait.tv_nsec = (left % 1000) * 1000000L;
+    syscall(SYS_futex, block, FUTEX_WAIT, now, &wait, NULL, 0);
+  }
+
+}
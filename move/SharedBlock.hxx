@@ -0,0 +1,31 @@
+#ifndef SharedBlock_H
+#define SharedBlock_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "midas.h"
+
+/* Small shared memory blocks that one program writes and others wait on (see MoveCompletion.hxx, TiltStream.hxx)
+ *
+ * A block starts with its sequence (volatile uint32_t), which works as a seqlock: it is odd while the block is
+ * written and goes up by 2 with every update. Waiters sleep on it (a futex) and are woken up by the writer.
+ */
+
+// Maps the block name of size bytes, creating it if create is set. A new block is zero: sequence 0, nothing
+// written yet. Returns NULL if it cannot.
+void *open_shared_block(const char *name, size_t size, BOOL create);
+
+// Writer: marks the block as being written. Returns the sequence to give to end_shared_block_write.
+uint32_t begin_shared_block_write(volatile uint32_t *sequence);
+
+// Writer: marks the block as consistent again, and wakes up the waiters
+void end_shared_block_write(volatile uint32_t *sequence, uint32_t next);
+
+// Waiter: the sequence to wait beyond for the next update
+uint32_t shared_block_sequence(const volatile uint32_t *sequence);
+
+// Waiter: waits up to timeout ms for an update after sequence, and copies the size bytes of the block to result,
+// with the sequence of the copy. Returns FALSE on a timeout.
+BOOL wait_shared_block(volatile uint32_t *block, uint32_t sequence, INT timeout, void *result, size_t size);
+
+#endif
@@ -0,0 +1,95 @@
+#include "TiltStream.hxx"
+#include "SharedBlock.hxx"
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+
+//----------------------------------------------------------
+TILT_STREAM *open_tilt_stream(int index, BOOL create) {
+//----------------------------------------------------------
+
+  char name[64];
+  snprintf(name, sizeof(name), TILT_STREAM_SHM, index);
+  return (TILT_STREAM *) open_shared_block(name, sizeof(TILT_STREAM), create);
+
+}
+
+//----------------------------------------------------------
+void post_tilt_sample(TILT_STREAM *stream, const double *acceleration, double tilt, double sampleTime,
+                      double timeConstant) {
+//----------------------------------------------------------
+
+  if (!stream) return;
+
+  uint32_t sequence = begin_shared_block_write(&stream->Sequence);
+
+  // First order low-pass; starts again from the sample after a gap (or a restart of the phidget clock)
+  const double dt = sampleTime - stream->SampleTime;
+  if (stream->Samples == 0 || timeConstant <= 0 || dt <= 0 || dt > 10 * timeConstant) {
+    stream->Filtered = tilt;
+  } else {
+    stream->Filtered += (tilt - stream->Filtered) * (1 - exp(-dt / timeConstant));
+  }
+
+  stream->Time = ss_millitime();
+  stream->Samples++;
+  stream->SampleTime = sampleTime;
+  memcpy(stream->Acceleration, acceleration, sizeof(stream->Acceleration));
+  stream->Tilt = tilt;
+  stream->TimeConstant = timeConstant;
+
+  end_shared_block_write(&stream->Sequence, sequence);
+
+}
+
+//----------------------------------------------------------
+uint32_t tilt_stream_sequence(const TILT_STREAM *stream) {
+//----------------------------------------------------------
+
+  return shared_block_sequence(&stream->Sequence);
+
+}
+
+//----------------------------------------------------------
+BOOL wait_tilt_sample(TILT_STREAM *stream, uint32_t sequence, INT timeout, TILT_STREAM *result) {
+//----------------------------------------------------------
+
+  return wait_shared_block(&stream->Sequence, sequence, timeout, result, sizeof(*result));
+
+}
+
+//----------------------------------------------------------
+BOOL wait_tilt_settled(TILT_STREAM *stream, DWORD since, double band, INT window, INT timeout,
+                       TILT_STREAM *result) {
+//----------------------------------------------------------
+
+  DWORD start = ss_millitime();
+  uint32_t sequence = tilt_stream_sequence(stream);
+  TILT_STREAM sample;
+  double low = 0, high = 0;
+  DWORD windowStart = 0;
+  bool inWindow = false;
+
+  memset(result, 0, sizeof(*result));
+
+  for (;;) {
+    INT left = timeout - (INT) (ss_millitime() - start);
+    if (!wait_tilt_sample(stream, sequence, left, &sample)) return FALSE;
+    sequence = sample.Sequence;
+    *result = sample;
+    if ((INT) (sample.Time - since) < 0) continue;
+
+    // The window starts again with every sample that takes the filtered tilt out of the band
+    if (!inWindow || sample.Filtered < high - band || sample.Filtered > low + band) {
+      low = high = sample.Filtered;
+      windowStart = sample.Time;
+      inWindow = true;
+    } else {
+      if (sample.Filtered < low) low = sample.Filtered;
+      if (sample.Filtered > high) high = sample.Filtered;
+    }
+    if ((INT) (sample.Time - windowStart) >= window) return TRUE;
+  }
+
+}
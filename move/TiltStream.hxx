@@ -0,0 +1,51 @@
+#ifndef TiltStream_H
+#define TiltStream_H
+
+#include <stdint.h>
+#include "midas.h"
+
+/* Tilt readings from fePhidget to feMove, sample by sample
+ *
+ * fePhidget sends its readings to the ODB (PH00, PH01) once a second, and feMove used to sleep and read them
+ * again until it trusted the tilt. fePhidget now also publishes every sample of the accelerometer in a small
+ * shared memory block per phidget, with the tilt low-pass filtered, and wakes up whoever waits for it. feMove
+ * waits on it (a futex) until the filtered tilt has settled, so it goes on as soon as the reading is stable.
+ *
+ * Sequence works as a seqlock, see SharedBlock.hxx. Both programs have to run on the same machine; if the
+ * block cannot be opened feMove reads the ODB as before.
+ */
+
+#define TILT_STREAM_SHM "/ptf_tilt_stream%02d"  // phidget (frontend) index
+
+typedef struct {
+  volatile uint32_t Sequence; // even when the block is consistent
+  uint32_t Time;              // ss_millitime() of fePhidget when the sample came in
+  uint32_t Samples;           // since the block was created
+  double SampleTime;          // ms, clock of the phidget
+  double Acceleration[3];     // g, as in PH00/PH01
+  double Tilt;                // deg, as in PH00/PH01
+  double Filtered;            // Tilt low-pass filtered with time constant TimeConstant
+  double TimeConstant;        // ms
+} TILT_STREAM;
+
+// Maps the block of the phidget, creating it if create is set (fePhidget). Returns NULL if it cannot.
+TILT_STREAM *open_tilt_stream(int index, BOOL create);
+
+// fePhidget: filters and publishes one sample, and wakes up the waiters. sampleTime is in ms.
+void post_tilt_sample(TILT_STREAM *stream, const double *acceleration, double tilt, double sampleTime,
+                      double timeConstant);
+
+// feMove: the sequence to wait beyond for the next sample
+uint32_t tilt_stream_sequence(const TILT_STREAM *stream);
+
+// feMove: waits up to timeout ms for a sample after sequence, and copies it to result.
+// Returns FALSE on a timeout.
+BOOL wait_tilt_sample(TILT_STREAM *stream, uint32_t sequence, INT timeout, TILT_STREAM *result);
+
+// feMove: waits up to timeout ms until the filtered tilt of the samples that came in after since (ss_millitime())
+// has stayed within band deg for window ms. result is the last sample seen (Samples 0 if none came).
+// Returns FALSE on a timeout.
+BOOL wait_tilt_settled(TILT_STREAM *stream, DWORD since, double band, INT window, INT timeout,
+                       TILT_STREAM *result);
+
+#endif
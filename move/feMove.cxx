@@ -10,7 +10,7 @@
                 frontend takes place in the ODB under /Equipment/Move.
   
   Debug Log:    While initalizing, the command to send the y axis to its
-                limit is not registered. It is sent with channel_rw, but
+                limit is not registered. It is sent with write_motor_channels, but
                 feMotor doesn't pick it up.
   
   Further work: 1. Add geometry structure to pInfo that includes all
@@ -49,68 +49,35 @@
 #include <math.h>
 #include <unistd.h>
 #include <string.h>
+#include <pthread.h>
+#include <memory>
 #include "TPathCalculator.hxx" //Rika: See typedef for XYPoint, XYPolygon, XYLine here.
 #include "TRotationCalculator.hxx"
 #include "TGantryConfigCalculator.hxx" //Rika (27Mar2017): Added as a class shared between feMove & TRotationCalculator.
+#include "CollisionSettings.hxx"
+#include "MoveCompletion.hxx"
+#include "PathCache.hxx"
+#include "MotorOrigins.hxx"
+#include "TiltStream.hxx"
 
 #include "mfe.h"
 
 
 /*-- Globals -------------------------------------------------------*/
-// The two function-like macros below are used in void channel_rw(INFO *pInfo, HNDLE* hKey, void *values, DWORD type, BOOL rw);
-//Note:: See the funciton channel_rw for more information about these macros
-
-//The below preprocessor macro would only work if the "function like" macro was defined on a single line. An identical version of the marco is put in the comment below below but is properly spaced to make it possible to read the code
-#define READ_VALUES(TYPE){*((TYPE*)(values + 0*size)) = *((TYPE*)(motor00_values+5*size));*((TYPE*)(values + 1*size)) = *((TYPE*)(motor00_values+6*size));*((TYPE*)(values + 2*size)) = *((TYPE*)(motor00_values+7*size));*((TYPE*)(values + 3*size)) = *((TYPE*)(motor00_values+4*size));*((TYPE*)(values + 4*size)) = *((TYPE*)(motor00_values+3*size));*((TYPE*)(values + 5*size)) = *((TYPE*)(motor01_values+6*size));*((TYPE*)(values + 6*size)) = *((TYPE*)(motor01_values+1*size));*((TYPE*)(values + 7*size)) = *((TYPE*)(motor01_values+2*size));*((TYPE*)(values + 8*size)) = *((TYPE*)(motor01_values+4*size));*((TYPE*)(values + 9*size)) = *((TYPE*)(motor01_values+5*size));}
-
-/*#define READ_VALUES(TYPE){
-  *((TYPE*)(values + 0*size)) = *((TYPE*)(motor00_values+5*size));
-  *((TYPE*)(values + 1*size)) = *((TYPE*)(motor00_values+6*size));
-  *((TYPE*)(values + 2*size)) = *((TYPE*)(motor00_values+7*size));
-  *((TYPE*)(values + 3*size)) = *((TYPE*)(motor00_values+4*size));
-  *((TYPE*)(values + 4*size)) = *((TYPE*)(motor00_values+3*size));
-  *((TYPE*)(values + 5*size)) = *((TYPE*)(motor01_values+6*size));
-  *((TYPE*)(values + 6*size)) = *((TYPE*)(motor01_values+1*size));
-  *((TYPE*)(values + 7*size)) = *((TYPE*)(motor01_values+2*size));
-  *((TYPE*)(values + 8*size)) = *((TYPE*)(motor01_values+4*size));
-  *((TYPE*)(values + 9*size)) = *((TYPE*)(motor01_values+5*size));}*/
-
-//The below preprocessor macro would only work if the function like macro was defined on a single line. An identical version of the marco is put in the comment below but is properly spaced to make it possible to read the code
-#define STORE_DATA(TYPE) {TYPE motor00_TYPE_values[8];TYPE motor01_TYPE_values[8];buff_size=sizeof(motor00_TYPE_values);size = sizeof(TYPE);motor00_TYPE_values[0]= 0;motor00_TYPE_values[1]= 0;motor00_TYPE_values[2]= 0;motor00_TYPE_values[3]=*((TYPE*)(values+4*size));motor00_TYPE_values[4]=*((TYPE*)(values+3*size));motor00_TYPE_values[5]=*((TYPE*)(values+0*size));motor00_TYPE_values[6]=*((TYPE*)(values+1*size));motor00_TYPE_values[7]=*((TYPE*)(values+2*size));motor01_TYPE_values[0]= 0;motor01_TYPE_values[1]=*((TYPE*)(values+6*size));motor01_TYPE_values[2]=*((TYPE*)(values+7*size));motor01_TYPE_values[3]=0;motor01_TYPE_values[4]=*((TYPE*)(values+8*size));motor01_TYPE_values[5]=*((TYPE*)(values+9*size));motor01_TYPE_values[6]=*((TYPE*)(values+5*size));motor01_TYPE_values[7]= 0;motor00_values = motor00_TYPE_values;motor01_values = motor01_TYPE_values;}
-
-/*
-#define STORE_DATA(TYPE) {
-  TYPE motor00_TYPE_values[8];
-  TYPE motor01_TYPE_values[8];
-
-  buff_size=sizeof(motor00_float_values);
-  size = sizeof(TYPE);
-  
-  motor00_TYPE_values[0]= 0;
-  motor00_TYPE_values[1]= 0;
-  motor00_TYPE_values[2]= 0;
-  motor00_TYPE_values[3]=*((TYPE*)(values+4*size));   // Tilt
-  motor00_TYPE_values[4]=*((TYPE*)(values+3*size));   // Rotary
-  motor00_TYPE_values[5]=*((TYPE*)(values+0*size));   // X
-  motor00_TYPE_values[6]=*((TYPE*)(values+1*size));   // Y
-  motor00_TYPE_values[7]=*((TYPE*)(values+2*size));   // Z
-        
-  motor01_TYPE_values[0]= 0;  
-  motor01_TYPE_values[1]=*((TYPE*)(values+6*size));   // Y
-  motor01_TYPE_values[2]=*((TYPE*)(values+7*size));   // Z
-  motor01_TYPE_values[3]= 0;
-  motor01_TYPE_values[4]=*((TYPE*)(values+8*size));   // Rotary
-  motor01_TYPE_values[5]=*((TYPE*)(values+9*size));   // Tilt
-  motor01_TYPE_values[6]=*((TYPE*)(values+5*size));   // X
-  motor01_TYPE_values[7]= 0;  
-  motor00_values = motor00_TYPE_values;
-  motor01_values = motor01_TYPE_values;
-}*/
+// Each axis is a channel of one of the two motor equipments (Motors00, Motors01), which keep their variables
+// as arrays of NUM_MOTOR_CHANNELS. The axes are 0-4: gantry 0 X, Y, Z, rotary, tilt, and 5-9 the same for
+// gantry 1. The other channels are not used. See read_motor_channels and write_motor_channels.
+#define NUM_MOTOR_CHANNELS 8
+const int axisMotor[10] = {0, 0, 0, 0, 0, 1, 1, 1, 1, 1};
+const int axisChannel[10] = {5, 6, 7, 4, 3, 6, 1, 2, 4, 5};
 
 /* The generate_path return flags */
 #define GENPATH_SUCCESS  0
 #define GENPATH_BAD_DEST 1
 
+/* generate_path also plans moves ahead for the path cache; only log for the move being made */
+#define PLAN_MSG(pInfo, ...) do { if (!(pInfo)->Prefetch) cm_msg(__VA_ARGS__); } while (0)
+
 /* The Abort Codes used by stop_move 	*/
 #define AC_USER_INPUT 0
 #define AC_COLLISION  1
@@ -147,12 +114,15 @@ INT gantry_motor_end = 10;   //TF TODO: get from ODB and make button on gantry_m
 
 /* Rika (20Apr2017): MOVED GLOBAL CALCULATOR OBJECTS BACK TO GENERATE_PATH() */
 // Gantry dimensions with buffer zones for collision avoidance
-double tiltMotorLength = 0.160;
-double gantryFrontHalfLength = 0.140; //Use 0.140m for safety; measured to be 0.114+/-0.001m (27Apr2017)
-double gantryBackHalfLength = 0.25; //0.22 Use 0.200m for safety; measured to be 0.114+0.07(pipelength)=0.184+/-0.002m (27Apr2017) // John (17Oct2019) 0.185 -> 0.22 for safety
-double gantryOpticalBoxWidth = 0.160; //Use 0.160m for safety; measured to be 0.135+/-0.002m for optical box 0, 0.145+/-0.001m for optical box 1 // John (17Oct2019) 0.15 -> 0.2 for safety
-double gantryTiltGearWidth = 0.060; //Use 0.070 for safety; measured to be 0.060+/-0.001m
-double gantryOpticalBoxHeight = 0.095; //Use 0.110m for safety; measured to be 0.094 +/- 0.004m (27Apr2017)
+double tiltMotorLength = GANTRY_TILT_MOTOR_LENGTH;
+double gantryFrontHalfLength = GANTRY_FRONT_HALF_LENGTH; //Use 0.140m for safety; measured to be 0.114+/-0.001m (27Apr2017)
+double gantryBackHalfLength = GANTRY_BACK_HALF_LENGTH; //0.22 Use 0.200m for safety; measured to be 0.114+0.07(pipelength)=0.184+/-0.002m (27Apr2017) // John (17Oct2019) 0.185 -> 0.22 for safety
+double gantryOpticalBoxWidth = GANTRY_OPTICAL_BOX_WIDTH; //Use 0.160m for safety; measured to be 0.135+/-0.002m for optical box 0, 0.145+/-0.001m for optical box 1 // John (17Oct2019) 0.15 -> 0.2 for safety
+double gantryTiltGearWidth = GANTRY_TILT_GEAR_WIDTH; //Use 0.070 for safety; measured to be 0.060+/-0.001m
+double gantryOpticalBoxHeight = GANTRY_OPTICAL_BOX_HEIGHT; //Use 0.110m for safety; measured to be 0.094 +/- 0.004m (27Apr2017)
+
+// Tank and PMT positions & dimensions below are the defaults for /Equipment/Move/Settings/Collision.
+// The values actually used are in the collision scene (see COLLISION_SCENE), which follows the ODB.
 
 // Tank position & dimensions:
 double xtankCentre = 0.366; // Rika (24Apr2017): Updated to estimated new position after tank moved back into coils // Kevin (22Jan2018) estimate change from (0.360, 0.345) -> (0.401, 0.288) -> (0.366, 0.361) Feb21 -> (0.366, 0.371) Feb 23)
@@ -161,17 +131,14 @@ double tankRadius = 0.61; // radius of tank ~0.61 // John (17Oct2019) reduced fr
 double tankPMTholderRadius = 0.53; // max/min from center where PMT holders sit
 
 // Rika: PMT position for collision avoidance
-std::vector <XYPolygon> pmtPoly0; // Model of PMT for collision avoidance
-std::vector <XYPolygon> pmtPoly1;
 double pmtRadius = 0.323;
 double pmtXcentre0 = 0.389; // Rika (24Apr2017): Updated to estimated new position. // Kevin (22Jan2018) changed from (0.348, 0.366) -> (0.389, 0.309) // need to change
 double pmtYcentre0 = 0.309;
 double pmtXcentre1 = 0.359; // estimate (0.418, 0.396) Feb.21.2018 // 0.366, 0.356
 double pmtYcentre1 = 0.326; // 0.331
-int numPolySides = 12;
-double pmtPolyLayerHeight = 0.01; // 1cm thick polygons
-int numPolyLayers = 0.38 /
-                    pmtPolyLayerHeight; // Rika (27Apr2017): Inserted enough layers to cover the lowest position that the tip of the optical box can go to
+double pmtLayerHeight = PMT_LAYER_HEIGHT; // 1cm thick layers
+int numPMTLayers = PMT_MODEL_DEPTH /
+                   pmtLayerHeight; // Rika (27Apr2017): Inserted enough layers to cover the lowest position that the tip of the optical box can go to
 // i.e. if the optical box is tilted -40 degrees, the distance from the gantry z position to the tip of the optical box is 0.178m,
 //      so if the gantry goes down to its maximum z height (0.534m), the tip of the optical box will be at 0.178+0.534=0.712,
 //      which is 0.712-0.390=0.372m lower than the position of the top of the PMT (so make it 0.38m to play it safe).
@@ -190,8 +157,6 @@ TGantryConfigCalculator gantryConfigCalc(tiltMotorLength, gantryFrontHalfLength,
 
 // Create path calculator object
 TPathCalculator pathCalc_checkDestination(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
-TPathCalculator pathCalc00(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
-TPathCalculator pathCalc01(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
 TPathCalculator pathCalc1a(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
 TPathCalculator pathCalc1b(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
 TPathCalculator pathCalc2a(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
@@ -208,9 +173,173 @@ TPathCalculator pathCalc7a(xtankCentre, ytankCentre, tankRadius, tankPMTholderRa
 TPathCalculator pathCalc7b(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
 TPathCalculator pathCalc8a(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
 TPathCalculator pathCalc8b(xtankCentre, ytankCentre, tankRadius, tankPMTholderRadius);
-TRotationCalculator pathCalc_rot_tilt(tiltMotorLength, gantryFrontHalfLength, gantryBackHalfLength,
-                                      gantryOpticalBoxWidth, gantryTiltGearWidth, gantryOpticalBoxHeight, xtankCentre,
-                                      ytankCentre, tankRadius, tankPMTholderRadius);
+
+// All of the path calculators, for updating their tank and PMT models together
+TPathCalculator *pathCalcs[] = {
+  &pathCalc_checkDestination,
+  &pathCalc1a, &pathCalc1b, &pathCalc2a, &pathCalc2b, &pathCalc3a, &pathCalc3b, &pathCalc4a, &pathCalc4b,
+  &pathCalc5a, &pathCalc5b, &pathCalc6a, &pathCalc6b, &pathCalc7a, &pathCalc7b, &pathCalc8a, &pathCalc8b
+};
+const int numPathCalcs = sizeof(pathCalcs) / sizeof(pathCalcs[0]);
+
+// Rotation & tilt checks made by generate_path, named after the strategies using them
+enum {
+  ROT_TILT_ROTFIRST_TILTFIRST,     // rotation & tilt together at the start position
+  TILT_ROTSECOND_TILTFIRST,        // tilt at the start position
+  ROTATION_ROTSECOND_TILTFIRST,    // rotation at the end position, after tilting
+  ROTATION_ROTFIRST_TILTSECOND,    // rotation at the start position
+  TILT_ROTFIRST_TILTSECOND,        // tilt at the end position, after rotating
+  ROT_TILT_ROTSECOND_TILTSECOND,   // rotation & tilt together at the end position
+  ROT_TILT_ENDCHECK,               // final rotation & tilt at the end position
+  NUM_ROT_TILT_CHECKS
+};
+
+// One rotation calculator per check, so that the checks can run at the same time.
+// Created in frontend_init.
+TRotationCalculator *pathCalcs_rot_tilt[NUM_ROT_TILT_CHECKS];
+
+// The checks generate_path makes for its strategies. Each one has its own calculator and its own result,
+// so they share nothing and run_path_checks can run them on several threads at once.
+typedef struct {
+  TPathCalculator *Calc;
+  XYPoint Start, End;                 // of the gantry moving in X & Y
+  std::pair<bool, bool> TankStart, TankEnd;
+  std::vector<XYPoint> Path;          // result: steps from Start to End
+  bool Good;                          // result
+} XY_PATH_CHECK;
+
+typedef struct {
+  TRotationCalculator *Calc;
+  XYPoint Pos0, Pos1;                 // X & Y of the gantries while they rotate & tilt
+  std::pair<double, double> Rot0, Rot1, Tilt0, Tilt1;  // start & end angles (degrees)
+  double Z0, Z1;
+  std::pair<bool, bool> TankStart, TankEnd;
+  bool Good;                          // result
+} ROT_TILT_CHECK;
+
+typedef struct {
+  XY_PATH_CHECK *XY;
+  int NumXY;
+  ROT_TILT_CHECK *RotTilt;
+  int NumRotTilt;
+  int Next;                           // next check to be taken by a thread
+} PATH_CHECKS;
+
+/*-- Collision scene -----------------------------------------------*/
+// Geometry of the tank and PMT, read from /Equipment/Move/Settings/Collision.
+// The settings are hotlinked so they can be tweaked while feMove is running. Every change builds a new
+// scene and swaps it in as a whole.
+// generate_path keeps the scene it started with until it returns, so a change never affects a path
+// that is being calculated; it takes effect from the next move.
+
+// COLLISION_SETTINGS is in CollisionSettings.hxx, as feScan checks scans against the same model.
+
+typedef struct {
+  DWORD Version;                  // incremented every time the scene changes
+  COLLISION_SETTINGS Settings;
+  std::vector<double> PMTLayerRadius; // radius of the PMT in each layer, from the top down; see pmt_layer_radius
+} COLLISION_SCENE;
+
+// What changed between two scenes
+#define SCENE_TANK      0x1
+#define SCENE_PMT0      0x2  // PMT model for gantry 0
+#define SCENE_PMT1      0x4  // PMT model for gantry 1
+#define SCENE_PMT_SHAPE 0x8  // PMT size or height; both models change
+
+std::shared_ptr<const COLLISION_SCENE> collisionScene;  // latest scene, guarded by collisionSceneMutex
+pthread_mutex_t collisionSceneMutex = PTHREAD_MUTEX_INITIALIZER;
+std::shared_ptr<const COLLISION_SCENE> appliedScene;    // scene loaded into the path calculators
+
+// Where feScan is told that a move is over, see MoveCompletion.hxx
+MOVE_COMPLETION *moveCompletion = NULL;
+
+// Paths planned before, see PathCache.hxx. Set up in frontend_init from /Equipment/Move/Settings/Path Cache;
+// NULL if disabled.
+PATH_CACHE *pathCache = NULL;
+float pathCacheQuantum = 20;  // counts; monitor already takes a waypoint within 20 counts as reached
+
+// Origins saved for the next start of feMove, see MotorOrigins.hxx. Set up in frontend_init from
+// /Equipment/Move/Settings/Fast Restart; empty if disabled.
+char originsFile[256] = "";
+float originsTolerance = 10;  // counts the motors may be off from where they were saved
+
+// Tilt samples from fePhidget, see TiltStream.hxx. Opened by get_tilt_stream once fePhidget has created them.
+TILT_STREAM *tiltStream[2] = {NULL, NULL};
+#define TILT_SETTLED_BAND   0.05  // deg the filtered tilt may wander and still count as settled
+#define TILT_SETTLED_WINDOW 300   // ms it has to stay within TILT_SETTLED_BAND
+#define TILT_SETTLE_TIMEOUT 5000  // ms to wait for that before taking the last reading
+#define TILT_SAMPLE_TIMEOUT 1000  // ms without a sample before a phidget counts as not responding
+
+// generate_path uses the path calculators and the path cache, which it shares with the prefetch thread
+pthread_mutex_t plannerMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Destinations to plan ahead, from UPCOMING_DESTINATIONS_KEY. The hotlink puts a new list here and
+// wakes up prefetch_thread, which plans the moves between them into the path cache.
+typedef struct {
+  pthread_mutex_t Mutex;
+  pthread_cond_t Changed;
+  DWORD Version;                                  // goes up with every new list
+  float Points[UPCOMING_DESTINATIONS][10];
+} PREFETCH;
+
+PREFETCH prefetch = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, {{0}}};
+float upcomingDestinations[UPCOMING_DESTINATIONS][10];  // hotlinked
+
+/*-- Move timing ---------------------------------------------------*/
+// When each waypoint of a move reached each stage, to see where the time of a scan goes.
+// The waypoints finished since the last event are sent in the "MTIM" bank of the Move equipment;
+// rolling histograms of the stages are kept in /Equipment/Move/Timing.
+
+// Times are ss_millitime(), 0 if the waypoint never got there
+typedef struct {
+  DWORD Move;             // number of the "Start Move" since feMove was started
+  DWORD Waypoint;         // path index
+  DWORD PlanningStart;    // generate_path, the same for all waypoints of a move
+  DWORD PlanningEnd;
+  DWORD CommandSent;      // first "Move" written to the motors
+  DWORD MotionDetected;   // a motor left its start position
+  DWORD MotionStopped;    // monitor saw all the axes stop
+  DWORD Verified;         // the positions matched the waypoint (0 if the move failed)
+} WAYPOINT_TIMING;
+
+#define WAYPOINT_TIMING_WORDS (sizeof(WAYPOINT_TIMING) / sizeof(DWORD))
+
+// Waypoints kept for the next MTIM bank; the oldest are dropped if the equipment is not read in time
+#define TIMING_QUEUE_SIZE 64
+
+// Histogram bin 0 is below 1 ms, bin i from 2^(i-1) to 2^i ms, the last one everything above
+#define NUM_TIMING_BINS   18
+// Number of the latest durations in each histogram
+#define TIMING_HISTORY    500
+
+enum {
+  TIMING_PLANNING,        // PlanningStart to PlanningEnd, once per move
+  TIMING_START,           // CommandSent to MotionDetected
+  TIMING_MOTION,          // MotionDetected to MotionStopped
+  TIMING_SETTLE,          // MotionStopped to Verified
+  NUM_TIMING_STAGES
+};
+
+const char *timingStageNames[NUM_TIMING_STAGES] = {"Planning", "Start", "Motion", "Settle"};
+
+typedef struct {
+  INT Counts[NUM_TIMING_BINS];
+  signed char Recent[TIMING_HISTORY]; // bins of the durations counted, oldest at Next once full
+  int Next, Size;
+} TIMING_HISTOGRAM;
+
+typedef struct {
+  DWORD Move;
+  DWORD PlanningStart, PlanningEnd;
+  WAYPOINT_TIMING Current;            // waypoint in progress
+  MOVE_COMPLETION_TIMES Totals;       // of the move in progress, for feScan
+  WAYPOINT_TIMING Queue[TIMING_QUEUE_SIZE];
+  int QueueStart, NumQueued;
+  TIMING_HISTOGRAM Histograms[NUM_TIMING_STAGES];
+} MOVE_TIMING;
+
+// Only used by the hotlinks and the equipment readout, which all run in the main thread
+MOVE_TIMING moveTiming;
 
 /*-- Info structure declaration ------------------------------------*/
 
@@ -228,6 +357,9 @@ typedef struct {
 
   HNDLE hKeyPhidget[2];
 
+  HNDLE hKeyCollision;  // Settings/Collision
+  HNDLE hKeySceneVersion;
+
   // "Control" ODB variables
   float *Destination;   // Gantry 1 and 2 axis destinations (physical units)
   BOOL Start;           // Start the motors towards the destination
@@ -259,6 +391,8 @@ typedef struct {
   int PathSize;         // Number of waypoints in the path
   int PathIndex;        // Index of the path section currently in progress
   int AbortCode;        // Variable in which to store the reason for aborting a move (AC_*)
+  BOOL Prefetch;        // Only planning ahead, for the path cache (see prefetch_thread)
+  BOOL Rehome;          // ReInitialize was set: home the gantries even if the saved origins are good
 
   // Phidget Tilt variables
   double Phidget[10];      // Equipment/Phidget0x in ODB
@@ -275,8 +409,23 @@ typedef struct {
   BOOL Motor00Rot;
   BOOL Motor00Tilt;
 
+  // "Variables" as last written by set_variable
+  BOOL PublishedMoving;
+  BOOL PublishedAxisMoving[10];
+  float PublishedPosition[10];
+  BOOL PublishedLimitNeg[10];
+  BOOL PublishedLimitPos[10];
+
 } INFO;
 
+// One reading of the motor variables, in axis order
+typedef struct {
+  BOOL Moving[10];
+  float Position[10];   // counts
+  BOOL LimitNeg[10];
+  BOOL LimitPos[10];
+} MOTOR_STATE;
+
 
 /*-- Function declarations -----------------------------------------*/
 
@@ -307,8 +456,34 @@ INT read_scaler_event(char *pevent, INT off);
 // Added functions
 void move_init(HNDLE hDB, HNDLE hKey, void *data);
 
+void move_not_started(INFO *pInfo);
+
 int generate_path(INFO *pInfo);
 
+void compact_path(INFO *pInfo);
+
+void alloc_move_path(INFO *pInfo, int size);
+
+uint32_t path_scene_hash(INFO *pInfo, const COLLISION_SETTINGS &settings);
+
+void upcoming_destinations(HNDLE hDB, HNDLE hKey, void *data);
+
+void *prefetch_thread(void *data);
+
+BOOL prefetch_path(INFO *pInfo, const float *from, const float *to);
+
+void start_waypoint_timing(INFO *pInfo);
+
+void record_waypoint_timing(INFO *pInfo);
+
+void add_timing(int stage, DWORD from, DWORD to);
+
+void write_timing_histograms(HNDLE hDB);
+
+void *path_check_thread(void *data);
+
+void run_path_checks(PATH_CHECKS *checks);
+
 void monitor(HNDLE hDB, HNDLE hKey, void *data);
 
 void move(INFO *pInfo);
@@ -317,13 +492,42 @@ void stop_move(HNDLE hDB, HNDLE hKey, void *data);
 
 void initialize(INFO *pInfo);
 
+int home_gantries(INFO *pInfo, const BOOL *enabled);
+
+bool restore_origins(INFO *pInfo);
+
+TILT_STREAM *get_tilt_stream(int i);
+
+BOOL read_tilt(INFO *pInfo, int i, DWORD since);
+
+void save_origins(INFO *pInfo);
+
 void reinitialize(HNDLE hDB, HNDLE hKey, void *data);
 
-void channel_rw(INFO *pInfo, HNDLE *hKey, void *values, DWORD type, BOOL rw);
+template<typename T>
+void read_motor_channels(INFO *pInfo, const HNDLE *hKey, T *values, DWORD type);
+
+template<typename T>
+void write_motor_channels(INFO *pInfo, const HNDLE *hKey, const T *values, DWORD type);
+
+void read_motor_state(INFO *pInfo, MOTOR_STATE *state);
+
+void set_variable(HNDLE hDB, HNDLE hKey, const void *values, void *published, INT size, INT num, DWORD type);
+
+void get_collision_settings(HNDLE hDB, COLLISION_SETTINGS *settings);
+
+int collision_scene_changes(const COLLISION_SETTINGS &l, const COLLISION_SETTINGS &r);
+
+std::shared_ptr<const COLLISION_SCENE> build_collision_scene(const COLLISION_SETTINGS &settings,
+                                                             const COLLISION_SCENE *previous);
 
-void
-getPMTpolygon(XYPolygon &poly, double pmtRadius, int polyNum, double pmtXcentre, double pmtYcentre, int numPolySides,
-              double polyHeight);
+std::shared_ptr<const COLLISION_SCENE> current_collision_scene();
+
+void set_collision_scene(INFO *pInfo, const std::shared_ptr<const COLLISION_SCENE> &scene);
+
+void apply_collision_scene(const std::shared_ptr<const COLLISION_SCENE> &scene);
+
+void reload_collision_scene(HNDLE hDB, HNDLE hKey, void *data);
 
 /*-- Equipment list ------------------------------------------------*/
 
@@ -433,8 +637,22 @@ INT interrupt_configure(INT cmd, INT source, POINTER_T adr)
 
 
 /*-- Event readout -------------------------------------------------*/
+// Sends the timing of the waypoints finished since the last event, if there are any (see MOVE_TIMING)
 INT read_trigger_event(char *pevent, INT off) {
-  return 0;
+  if (moveTiming.NumQueued == 0) return 0;
+
+  bk_init(pevent);
+  DWORD *pdata;
+  bk_create(pevent, "MTIM", TID_DWORD, (void **) &pdata);
+  for (int i = 0; i < moveTiming.NumQueued; i++) {
+    memcpy(pdata, &moveTiming.Queue[(moveTiming.QueueStart + i) % TIMING_QUEUE_SIZE], sizeof(WAYPOINT_TIMING));
+    pdata += WAYPOINT_TIMING_WORDS;
+  }
+  bk_close(pevent, pdata);
+
+  moveTiming.QueueStart = 0;
+  moveTiming.NumQueued = 0;
+  return bk_size(pevent);
 }
 
 /*-- Scaler event --------------------------------------------------*/
@@ -494,6 +712,13 @@ INT frontend_init() {
   pInfo->PathIndex = 0;
   pInfo->AbortCode = AC_USER_INPUT;
 
+  for (i = 0; i < NUM_ROT_TILT_CHECKS; i++) {
+    pathCalcs_rot_tilt[i] = new TRotationCalculator(tiltMotorLength, gantryFrontHalfLength, gantryBackHalfLength,
+                                                    gantryOpticalBoxWidth, gantryTiltGearWidth,
+                                                    gantryOpticalBoxHeight, xtankCentre, ytankCentre, tankRadius,
+                                                    tankPMTholderRadius);
+  }
+
   /* Initialize "Control" ODB variables */
 
   // "Destination"
@@ -541,6 +766,12 @@ INT frontend_init() {
   db_merge_data(hDB, 0, "/Equipment/Move/Settings/Limit Positions", pInfo->LimPos, 10 * sizeof(float), 10, TID_FLOAT);
   db_find_key(hDB, 0, "/Equipment/Move/Settings/Limit Positions", &pInfo->hKeyLimPos);
 
+  // "Collision"
+  // Unlike the settings above, the tank and PMT geometry can be changed while feMove is running.
+  COLLISION_SETTINGS collision;
+  get_collision_settings(hDB, &collision);
+  db_find_key(hDB, 0, "/Equipment/Move/Settings/Collision", &pInfo->hKeyCollision);
+
   /* Initialize "Variables" ODB variables */
   // "Position(X,Y,Z,Theta,Phi)"
   db_find_key(hDB, 0, "/Equipment/Move/Variables/Position", &pInfo->hKeyPos);
@@ -561,12 +792,25 @@ INT frontend_init() {
   pInfo->Completed = 1;
   db_set_data(hDB, pInfo->hKeyCompleted, &pInfo->Completed, sizeof(BOOL), 1, TID_BOOL);
 
+  // Move completion notices for feScan
+  moveCompletion = open_move_completion(TRUE);
+  if (!moveCompletion) {
+    cm_msg(MERROR, "frontend_init", "Cannot open %s, feScan will poll the ODB for completed moves",
+           MOVE_COMPLETION_SHM);
+  }
+
   // "Moving"
   db_find_key(hDB, 0, "/Equipment/Move/Variables/Moving", &pInfo->hKeyMoving);
 
   // "Initializing"
   db_find_key(hDB, 0, "/Equipment/Move/Variables/Initializing", &pInfo->hKeyInitializing);
 
+  // "Collision Scene Version"
+  DWORD sceneVersion = 0;
+  db_merge_data(hDB, 0, "/Equipment/Move/Variables/Collision Scene Version", &sceneVersion, sizeof(DWORD), 1, TID_DWORD);
+  db_find_key(hDB, 0, "/Equipment/Move/Variables/Collision Scene Version", &pInfo->hKeySceneVersion);
+  set_collision_scene(pInfo, build_collision_scene(collision, NULL));
+
   // "Axis Moving"
   db_find_key(hDB, 0, "/Equipment/Move/Variables/Axis Moving", &pInfo->hKeyAxMoving);
   db_set_data(hDB, pInfo->hKeyAxMoving, pInfo->AxisMoving, 10 * sizeof(BOOL), 10, TID_BOOL);
@@ -579,6 +823,13 @@ INT frontend_init() {
   db_find_key(hDB, 0, "/Equipment/Move/Variables/Positive Axis Limit", &pInfo->hKeyAxLimitPos);
   db_set_data(hDB, pInfo->hKeyAxLimitPos, pInfo->pos_AxisLimit, 10 * sizeof(BOOL), 10, TID_BOOL);
 
+  // What the "Variables" hold now, for set_variable. "Moving" has not been written yet.
+  memcpy(pInfo->PublishedPosition, pInfo->Position, sizeof(pInfo->PublishedPosition));
+  memcpy(pInfo->PublishedAxisMoving, pInfo->AxisMoving, sizeof(pInfo->PublishedAxisMoving));
+  memcpy(pInfo->PublishedLimitNeg, pInfo->neg_AxisLimit, sizeof(pInfo->PublishedLimitNeg));
+  memcpy(pInfo->PublishedLimitPos, pInfo->pos_AxisLimit, sizeof(pInfo->PublishedLimitPos));
+  pInfo->PublishedMoving = -1;
+
   /* Get handles for the "Motor" ODB variables */
   // "Destination"
   db_find_key(hDB, 0, "/Equipment/Motors00/Settings/Destination", &pInfo->hKeyMDest[0]);
@@ -620,6 +871,56 @@ INT frontend_init() {
   db_find_key(hDB, 0, "/Equipment/Phidget00/Variables", &pInfo->hKeyPhidget[0]);
   db_find_key(hDB, 0, "/Equipment/Phidget01/Variables", &pInfo->hKeyPhidget[1]);
 
+  /* Path cache */
+  BOOL pathCacheEnabled = TRUE;
+  char pathCacheFile[256] = "feMove_paths.cache";
+  INT pathCacheSets = 256;
+  INT size = sizeof(pathCacheEnabled);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Path Cache/Enabled", &pathCacheEnabled, &size, TID_BOOL, TRUE);
+  size = sizeof(pathCacheFile);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Path Cache/File", pathCacheFile, &size, TID_STRING, TRUE);
+  size = sizeof(pathCacheSets);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Path Cache/Sets", &pathCacheSets, &size, TID_INT, TRUE);
+  size = sizeof(pathCacheQuantum);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Path Cache/Quantum (counts)", &pathCacheQuantum, &size, TID_FLOAT,
+               TRUE);
+  if (pathCacheEnabled && pathCacheSets > 0 && pathCacheQuantum > 0) {
+    pathCache = open_path_cache(pathCacheFile, pathCacheSets);
+  }
+
+  /* Origins kept across restarts */
+  BOOL fastRestart = TRUE;
+  char fastRestartFile[256] = "feMove_origins.dat";
+  size = sizeof(fastRestart);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Fast Restart/Enabled", &fastRestart, &size, TID_BOOL, TRUE);
+  size = sizeof(fastRestartFile);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Fast Restart/File", fastRestartFile, &size, TID_STRING, TRUE);
+  size = sizeof(originsTolerance);
+  db_get_value(hDB, 0, "/Equipment/Move/Settings/Fast Restart/Tolerance (counts)", &originsTolerance, &size,
+               TID_FLOAT, TRUE);
+  if (fastRestart) snprintf(originsFile, sizeof(originsFile), "%s", fastRestartFile);
+
+  // Planning ahead for feScan; only of use with the path cache
+  for (i = 0; i < UPCOMING_DESTINATIONS * 10; i++) upcomingDestinations[i / 10][i % 10] = -999;
+  db_set_value(hDB, 0, UPCOMING_DESTINATIONS_KEY, upcomingDestinations, sizeof(upcomingDestinations),
+               UPCOMING_DESTINATIONS * 10, TID_FLOAT);
+  if (pathCache) {
+    HNDLE hKeyUpcoming;
+    pthread_t prefetchThread;
+    db_find_key(hDB, 0, UPCOMING_DESTINATIONS_KEY, &hKeyUpcoming);
+    db_open_record(hDB, hKeyUpcoming, upcomingDestinations, sizeof(upcomingDestinations), MODE_READ,
+                   upcoming_destinations, pInfo);
+    if (pthread_create(&prefetchThread, NULL, prefetch_thread, pInfo) == 0) pthread_detach(prefetchThread);
+    else cm_msg(MERROR, "frontend_init", "Cannot start the prefetch thread, moves will be planned when started");
+  }
+
+  /* Move timing histograms, empty until the first move */
+  INT binEdges[NUM_TIMING_BINS];
+  for (i = 0; i < NUM_TIMING_BINS; i++) binEdges[i] = i == 0 ? 0 : 1 << (i - 1);
+  db_set_value(hDB, 0, "/Equipment/Move/Timing/Bin Low Edge (ms)", binEdges, sizeof(binEdges), NUM_TIMING_BINS,
+               TID_INT);
+  write_timing_histograms(hDB);
+
   /* Set up hotlinks */
   // move_init() hotlink
   db_open_record(hDB, pInfo->hKeyStart, &pInfo->Start, sizeof(BOOL), MODE_READ, move_init, pInfo);
@@ -636,14 +937,19 @@ INT frontend_init() {
   // Note: The variable hotlinked to monitor() is somewhat arbitrary, all that is 
   //	   really needed is a variable that gets periodically updated in feMove.
 
+  // reload_collision_scene() hotlink, on the whole Settings/Collision directory
+  INT collisionSize = 0;
+  db_get_record_size(hDB, pInfo->hKeyCollision, 0, &collisionSize);
+  db_open_record(hDB, pInfo->hKeyCollision, NULL, collisionSize, MODE_READ, reload_collision_scene, pInfo);
+
   /* Set motor velocities and accelerations to in feMotor */
   for (i = gantry_motor_start; i < gantry_motor_end; i++) {
     tempV[i] = pInfo->Velocity[i] * fabs(pInfo->mScale[i]);
     tempA[i] = pInfo->Acceleration[i] * fabs(pInfo->mScale[i]);
   }
 
-  channel_rw(pInfo, pInfo->hKeyMVel, (void *) tempV, TID_FLOAT, 1);
-  channel_rw(pInfo, pInfo->hKeyMAcc, (void *) tempA, TID_FLOAT, 1);
+  write_motor_channels(pInfo, pInfo->hKeyMVel, tempV, TID_FLOAT);
+  write_motor_channels(pInfo, pInfo->hKeyMAcc, tempA, TID_FLOAT);
   return CM_SUCCESS;
 }
 
@@ -668,6 +974,8 @@ INT frontend_exit() {
 		  (in a guaranteed collision free manner) and determines
 		  the motor coordinates (in steps) at the origin. This
 		  value is placed in the variable pInfo->mOrigin.
+		  Origins saved by a previous feMove are taken instead
+		  if the motors have not moved since (restore_origins).
 
  reinitialize:	  This function calls initialize (initializes the gantry
                   and then starts 
@@ -692,21 +1000,40 @@ INT frontend_exit() {
                   next path section, sets completed to 1, or sets 
                   completed to 0 (error).
                   
-  channel_rw:     This function handles all communication with feMotor.
-                  Only here do we read and write to specific motor 
+  read_motor_channels, write_motor_channels:
+                  These functions handle all communication with feMotor.
+                  Only here do we read and write to specific motor
                   channels.
 \********************************************************************/
 
 /*=====================Phidget Check=================================*/
 // Check to see if phidgets are responsive
 INT phidget_responding(HNDLE hDB) {
-  double tilt_min = -105, tilt_max = 15;
+  double tilt_min = GANTRY_TILT_MIN, tilt_max = GANTRY_TILT_MAX;
   HNDLE hPhidgetVars0 = 0, hPhidgetVars1 = 0;
   double phidget_Values_Old[10];
   double phidget_Values_Now[10];
   int size_of_array = sizeof(phidget_Values_Old);
   DWORD time_at_start_of_check;
 
+  // With the tilt streams, a phidget is working if a new sample comes in time
+  if (get_tilt_stream(0) && get_tilt_stream(1)) {
+    for (int i = 0; i < 2; i++) {
+      TILT_STREAM sample;
+      if (!wait_tilt_sample(tiltStream[i], tilt_stream_sequence(tiltStream[i]), TILT_SAMPLE_TIMEOUT, &sample)) {
+        cm_msg(MERROR, "phidget_responding", "No tilt samples from Phidget%i for %i ms, assuming it is not working",
+               i, TILT_SAMPLE_TIMEOUT);
+        return 0;
+      }
+      if (sample.Tilt > tilt_max || sample.Tilt < tilt_min) {
+        cm_msg(MERROR, "phidget_responding", "gantry%02i exceeded tilt limits while initializing. Currently at: %f", i,
+               sample.Tilt);
+        return 0;
+      }
+    }
+    return 1;
+  }
+
   //cm_msg(MINFO, "move_init", "Checking Phidget Response");
   size_of_array = sizeof(phidget_Values_Old);
   db_get_value(hDB, hPhidgetVars0, "PH00", &phidget_Values_Old, &size_of_array, TID_DOUBLE, FALSE);
@@ -771,6 +1098,45 @@ INT phidget_responding(HNDLE hDB) {
   return 1;
 }
 
+/*-- Tilt stream ---------------------------------------------------*/
+// The tilt stream of phidget i, opened once fePhidget has created it.
+// NULL until then.
+TILT_STREAM *get_tilt_stream(int i) {
+  if (!tiltStream[i]) tiltStream[i] = open_tilt_stream(i, FALSE);
+  return tiltStream[i];
+}
+
+// Read phidget i into pInfo->Phidget. With the tilt stream, wait until the
+// filtered tilt of the samples after since (ss_millitime()) has settled and
+// take that as the tilt; otherwise read the ODB as it is. Returns FALSE
+// (and a NaN tilt) if there was no reading.
+BOOL read_tilt(INFO *pInfo, int i, DWORD since) {
+  TILT_STREAM *stream = get_tilt_stream(i);
+  TILT_STREAM sample;
+  INT size = sizeof(pInfo->Phidget);
+
+  if (!stream) {
+    return db_get_value(pInfo->hDB, pInfo->hKeyPhidget[i], i == 0 ? "PH00" : "PH01", &pInfo->Phidget, &size,
+                        TID_DOUBLE, FALSE) == DB_SUCCESS;
+  }
+
+  if (wait_tilt_settled(stream, since, TILT_SETTLED_BAND, TILT_SETTLED_WINDOW, TILT_SETTLE_TIMEOUT, &sample)) {
+    cm_msg(MDEBUG, "read_tilt", "Tilt %i settled at %f after %i ms", i, sample.Filtered,
+           (INT) (ss_millitime() - since));
+  } else if (sample.Samples) {
+    cm_msg(MINFO, "read_tilt", "Tilt %i did not settle within %i ms, taking %f", i, TILT_SETTLE_TIMEOUT,
+           sample.Filtered);
+  } else {
+    cm_msg(MERROR, "read_tilt", "No tilt samples from Phidget%i for %i ms", i, TILT_SETTLE_TIMEOUT);
+    pInfo->Phidget[7] = NAN;
+    return FALSE;
+  }
+
+  memcpy(pInfo->Phidget, sample.Acceleration, sizeof(sample.Acceleration));
+  pInfo->Phidget[7] = sample.Filtered;
+  return TRUE;
+}
+
 /*-- Move Init -----------------------------------------------------*/
 // Call generate path and start the first move
 void move_init(HNDLE hDB, HNDLE hKey, void *data) {
@@ -797,8 +1163,14 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
     return;
   }
 
+  // Timing of this move (see MOVE_TIMING)
+  moveTiming.Move++;
+  moveTiming.PlanningStart = moveTiming.PlanningEnd = 0;
+  memset(&moveTiming.Totals, 0, sizeof(moveTiming.Totals));
+
   cm_msg(MDEBUG, "move_init", "Checking phidget response...");
   if (!phidget_responding(hDB)) {
+    move_not_started(pInfo);
     return;
   }
 
@@ -813,6 +1185,7 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
   // If initialization fails, return with error
   if (pInfo->Initialized == 0) {
     cm_msg(MERROR, "move_init", "Error: Can't start move. Initialization failed.");
+    move_not_started(pInfo);
     return;
   }
   // Check if phidget tilt readings match the ODB variables before proceeding
@@ -821,7 +1194,7 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
   //               if they disagree --> try to move it to desired location first
   //               if they still dont match exit
   double tilt_tolerance = 3.0;
-  double tilt_min = -105, tilt_max = 15;
+  double tilt_min = GANTRY_TILT_MIN, tilt_max = GANTRY_TILT_MAX;
   size = sizeof(pInfo->Phidget);
   int tilt_start = 0, tilt_end = 2; //these are the number of gantries we have to correct
   for (int i = tilt_start; i < tilt_end; i++) {
@@ -838,6 +1211,7 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
       cm_msg(MERROR, "move_init", "Phidget0%i tilt: %f ODB tilt: %f", i, pInfo->Phidget[7], pInfo->Position[axis]);
       cm_msg(MERROR, "move_init", "ERROR: can't start move. Phidget0%i tilt and ODB tilt do not agree within tolerance",
              i);
+      move_not_started(pInfo);
       return;
     }
 
@@ -845,6 +1219,7 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
     if (pInfo->Phidget[7] < tilt_min || pInfo->Phidget[7] > tilt_max) {
       cm_msg(MERROR, "move_init", "ERROR: can't start move. Phidget0%i tilt: %f is in illegal range", i,
              pInfo->Phidget[7]);
+      move_not_started(pInfo);
       return;
     }
   }
@@ -855,7 +1230,14 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
 
   // Generate collision free path to pInfo->Destination
   cm_msg(MINFO, "move_init", "Generating Path");
+  moveTiming.PlanningStart = ss_millitime();
+  pthread_mutex_lock(&plannerMutex);
   int Status = generate_path(pInfo);
+  pthread_mutex_unlock(&plannerMutex);
+  moveTiming.PlanningEnd = ss_millitime();
+  moveTiming.Totals.Planning = moveTiming.PlanningEnd - moveTiming.PlanningStart;
+  add_timing(TIMING_PLANNING, moveTiming.PlanningStart, moveTiming.PlanningEnd);
+  write_timing_histograms(hDB);
 
   // Check for unsuccesful path generation
   switch (Status) {
@@ -867,6 +1249,7 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
       cm_msg(MERROR, "move_init", " Bad destination entered in Move");
       pInfo->BadDest = 1;
       db_set_data(hDB, pInfo->hKeyBadDest, &pInfo->BadDest, sizeof(BOOL), 1, TID_BOOL);
+      move_not_started(pInfo);
       return;
   }
   cm_msg(MINFO, "move_init", "Path succesfully generated");
@@ -885,6 +1268,12 @@ void move_init(HNDLE hDB, HNDLE hKey, void *data) {
   db_set_data(hDB, pInfo->hKeyStart, &pInfo->Start, sizeof(BOOL), 1, TID_BOOL);
 }
 
+// A "Start Move" that did not start a move: tell feScan straight away, with the variables as they are
+// (as before, it finds "Completed" set and "Moving" not).
+void move_not_started(INFO *pInfo) {
+  post_move_completion(moveCompletion, pInfo->Completed, pInfo->BadDest, pInfo->Position, &moveTiming.Totals);
+}
+
 /*-- Initialize tilt ----------------------------------------------------*/
 // We initialize the tilt motor by using the tilt measurement from the 1044 Phidget
 // accelerometer.
@@ -926,34 +1315,41 @@ int initialize_tilt(INFO *pInfo) {
     //if (axis == 9)
     //  continue;
 
-    //Get readings of phidget. 
-    int status = db_get_value(pInfo->hDB, pInfo->hKeyPhidget[0], "PH00", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
-    if (i == 1) {
-      status = db_get_value(pInfo->hDB, pInfo->hKeyPhidget[1], "PH01", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
-    }
-    if (status != DB_SUCCESS) {
-      cm_msg(MERROR, "initialize_tilt", "Cannot get value for Phidget %i Reading", i);
-      return DB_NO_ACCESS;
-    }
+    //Get readings of phidget. With the tilt stream, as soon as the tilt has settled
+    if (get_tilt_stream(i)) {
+      if (!read_tilt(pInfo, i, ss_millitime())) {
+        cm_msg(MERROR, "initialize_tilt", "Cannot get value for Phidget %i Reading", i);
+        return DB_NO_ACCESS;
+      }
+    } else {
+      int status = db_get_value(pInfo->hDB, pInfo->hKeyPhidget[0], "PH00", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
+      if (i == 1) {
+        status = db_get_value(pInfo->hDB, pInfo->hKeyPhidget[1], "PH01", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
+      }
+      if (status != DB_SUCCESS) {
+        cm_msg(MERROR, "initialize_tilt", "Cannot get value for Phidget %i Reading", i);
+        return DB_NO_ACCESS;
+      }
 
-    //Check that the phidget is connected by checking that its internal clock is changing   
-    int time_s = pInfo->Phidget[8];
-    int time_us = pInfo->Phidget[9];
+      //Check that the phidget is connected by checking that its internal clock is changing   
+      int time_s = pInfo->Phidget[8];
+      int time_us = pInfo->Phidget[9];
 
-    // Make sure phidget readings change from previous value:
-    sleep(2000); //2sec
-    if (i == 0) db_get_value(pInfo->hDB, pInfo->hKeyPhidget[0], "PH00", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
-    else db_get_value(pInfo->hDB, pInfo->hKeyPhidget[1], "PH01", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
+      // Make sure phidget readings change from previous value:
+      ss_sleep(2000); //2sec
+      if (i == 0) db_get_value(pInfo->hDB, pInfo->hKeyPhidget[0], "PH00", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
+      else db_get_value(pInfo->hDB, pInfo->hKeyPhidget[1], "PH01", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
 
 
-    //TF note: this is not 100% reliable...even with a big sleep : 
-    // DEBUG!!!! TODO
-    if (time_s == pInfo->Phidget[8] && time_us == pInfo->Phidget[9]) {
-      printf("Time not updated; fePhidget not running; can't initialize tilt\n");
-      printf("%i %f %i %f\n", time_s, pInfo->Phidget[8], time_us, pInfo->Phidget[9]);
-      //return 0; //TF: uncomment for Tilt tests...
-      //TF: for running tilt without phidgets:
-      //pInfo->Phidget[7] = -10;
+      //TF note: this is not 100% reliable...even with a big sleep : 
+      // DEBUG!!!! TODO
+      if (time_s == pInfo->Phidget[8] && time_us == pInfo->Phidget[9]) {
+        printf("Time not updated; fePhidget not running; can't initialize tilt\n");
+        printf("%i %f %i %f\n", time_s, pInfo->Phidget[8], time_us, pInfo->Phidget[9]);
+        //return 0; //TF: uncomment for Tilt tests...
+        //TF: for running tilt without phidgets:
+        //pInfo->Phidget[7] = -10;
+      }
     }
 
     if (i == 0)
@@ -973,13 +1369,13 @@ int initialize_tilt(INFO *pInfo) {
   printf("Destinations: Dest[4] = %f, dest[9] = %f\n", dest[4], dest[9]);
 
   // Write the destinations to the motors
-  // Note: channel_rw works for both motors, ie. write both tilt destinations at once and initialize
+  // Note: write_motor_channels works for both motors, ie. write both tilt destinations at once and initialize
   // together
-  channel_rw(pInfo, pInfo->hKeyMDest, dest, TID_FLOAT, 1);
+  write_motor_channels(pInfo, pInfo->hKeyMDest, dest, TID_FLOAT);
 
   // Start the move
-  channel_rw(pInfo, pInfo->hKeyMStart, (void *) start, TID_BOOL, 1);
-  sleep(600); // TF and BK: is this to wait for galil_read to update ODB for AxisMoving??
+  write_motor_channels(pInfo, pInfo->hKeyMStart, start, TID_BOOL);
+  ss_sleep(600); // TF and BK: is this to wait for galil_read to update ODB for AxisMoving??
 
 
   // Monitor the motion until we are finished moving.
@@ -991,7 +1387,7 @@ int initialize_tilt(INFO *pInfo) {
     pInfo->Moving = 0;
 
     //TF note: this only checks whether the motors are moving!!
-    channel_rw(pInfo, pInfo->hKeyMMoving, (void *) pInfo->AxisMoving, TID_BOOL, 0);
+    read_motor_channels(pInfo, pInfo->hKeyMMoving, pInfo->AxisMoving, TID_BOOL);
     pInfo->Moving = pInfo->Moving || pInfo->AxisMoving[4];
     pInfo->Moving = pInfo->Moving || pInfo->AxisMoving[9];
     if (pInfo->Moving && !startedMoving)
@@ -1002,14 +1398,14 @@ int initialize_tilt(INFO *pInfo) {
     }
   }
 
+  DWORD stopped = ss_millitime();
   cm_msg(MINFO, "initialize_tilt", "Move complete.");
   tilt_ini_attempts++;
   for (i = tilt_start; i < tilt_end; i++) {
     int axis = (i == 0 ? 4 : 9);
 
-    // Check that the final tilt is within the required tolerance
-    if (i == 0) db_get_value(pInfo->hDB, pInfo->hKeyPhidget[0], "PH00", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
-    else db_get_value(pInfo->hDB, pInfo->hKeyPhidget[1], "PH01", &pInfo->Phidget, &size, TID_DOUBLE, FALSE);
+    // Check that the final tilt is within the required tolerance, once it has settled after the move
+    read_tilt(pInfo, i, stopped);
 
     //NaN check:
     if (pInfo->Phidget[7] != pInfo->Phidget[7]) {
@@ -1039,7 +1435,7 @@ int initialize_tilt(INFO *pInfo) {
     }
 
     // Reset origin position.
-    channel_rw(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT, 0);
+    read_motor_channels(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT);
     pInfo->mOrigin[axis] = pInfo->CountPos[axis] - pInfo->LimPos[axis] * pInfo->mScale[axis];
     pInfo->Position[axis] = pInfo->LimPos[axis];
 
@@ -1057,211 +1453,109 @@ int initialize_tilt(INFO *pInfo) {
 // position to determine the motor coordinates at the origin. If the
 // negative limit switch is disabled, the current position is set as the
 // origin for that axis.
+// If the origins saved by the last feMove are still good (see restore_origins),
+// they are taken instead and the motors are not moved, unless ReInitialize asked for this.
 void initialize(INFO *pInfo) {
   int i;
-  BOOL *tempStart = (BOOL *) calloc(10, sizeof(BOOL));
   BOOL *tempNegLimitEnabled = (BOOL *) calloc(10, sizeof(BOOL));
   float *tempPos = (float *) calloc(10, sizeof(float));
-  BOOL tempStop[10] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
   BOOL exitFlag = 0;
-  float lastCountPosArm1;
-  float lastCountPosArm2;
+  int exitFlagTilt = 0;
 
 
   cm_msg(MINFO, "initialize", "Initializing motors");
   BOOL initing = 1;
   db_set_data(pInfo->hDB, pInfo->hKeyInitializing, &initing, sizeof(BOOL), 1, TID_BOOL);
 
-  // Set motors to move into their negative limit switches, if they are enabled 
-  //(disabled is LimPos = 9999)
-  // Motors 4 and 9 are the tilt motors.  These are initialized separately, using 
-  // the tilt measurement from the phidget.
-  //for(i=0;i<10;i++){
-  for (i = gantry_motor_start; i < gantry_motor_end; i++) {
-    if (i == 4 || i == 9) {
-      //Do nothing, tilt should already be initialized
-      tempPos[i] = 0;
-      tempNegLimitEnabled[i] = 0;
-      cm_msg(MINFO, "initialize", "Axis %i for tilt motor will be initialized separately.", i);
-    } else if (pInfo->LimPos[i] == 9999) {
-      tempPos[i] = 0;
-      tempNegLimitEnabled[i] = 0;
-      cm_msg(MINFO, "initialize", "Negative limit switch for axis %i disabled. Axis will not be initialized.", i);
-    } else {
-      tempPos[i] = 500 * fabs(pInfo->mScale[i]);
-      tempNegLimitEnabled[i] = 1;
-      cm_msg(MINFO, "initialize",
-             "Negative limit switch for axis %i enabled. Axis will be initialized; use position %f.", i, tempPos[i]);
+  BOOL rehome = pInfo->Rehome;
+  pInfo->Rehome = 0;
+  if (rehome || !restore_origins(pInfo)) {
+    // Set motors to move into their negative limit switches, if they are enabled
+    //(disabled is LimPos = 9999)
+    // Motors 4 and 9 are the tilt motors.  These are initialized separately, using
+    // the tilt measurement from the phidget.
+    //for(i=0;i<10;i++){
+    for (i = gantry_motor_start; i < gantry_motor_end; i++) {
+      if (i == 4 || i == 9) {
+        //Do nothing, tilt should already be initialized
+        tempPos[i] = 0;
+        tempNegLimitEnabled[i] = 0;
+        cm_msg(MINFO, "initialize", "Axis %i for tilt motor will be initialized separately.", i);
+      } else if (pInfo->LimPos[i] == 9999) {
+        tempPos[i] = 0;
+        tempNegLimitEnabled[i] = 0;
+        cm_msg(MINFO, "initialize", "Negative limit switch for axis %i disabled. Axis will not be initialized.", i);
+      } else {
+        tempPos[i] = 500 * fabs(pInfo->mScale[i]);
+        tempNegLimitEnabled[i] = 1;
+        cm_msg(MINFO, "initialize",
+               "Negative limit switch for axis %i enabled. Axis will be initialized; use position %f.", i, tempPos[i]);
+      }
     }
-  }
 
-  channel_rw(pInfo, pInfo->hKeyMDest, (void *) tempPos, TID_FLOAT, 1);
+    write_motor_channels(pInfo, pInfo->hKeyMDest, tempPos, TID_FLOAT);
 
-  // Cycle through each pair of motors corresponding to the same axis on each arm.
-  // We want to make sure that we initialize the Z-axis first, so that the laser box is
-  // fully out of the tank before we move in X and Y.
-  int order[4] = {2, 0, 1, 3};
-  int itmp;
-  for (itmp = 0; itmp < 4; itmp++) {
-    i = order[itmp];
+    exitFlag = home_gantries(pInfo, tempNegLimitEnabled);
 
-    if ((tempNegLimitEnabled[i] == 1) || (tempNegLimitEnabled[i + 5] == 1)) {
-      cm_msg(MINFO, "initialize", "Initializing axes %i and %i (enabled = %i %i)", i, i + 5, tempNegLimitEnabled[i],
-             tempNegLimitEnabled[i + 5]);
-      //printf("Going to destination %f %f\n",tempPos[i],tempPos[i+5]);
+    // Wait for all the motors to stop moving (sometimes this
+    // occurs slightly after the limit switches are triggered)
+    pInfo->Moving = 1;
+    while (pInfo->Moving) {
+      pInfo->Moving = 0;
+      read_motor_channels(pInfo, pInfo->hKeyMMoving, pInfo->AxisMoving, TID_BOOL);
+      for (i = gantry_motor_start; i < gantry_motor_end; i++) pInfo->Moving = pInfo->Moving || pInfo->AxisMoving[i];
     }
-    tempStart[i] = tempNegLimitEnabled[i];
-    tempStart[i + 5] = tempNegLimitEnabled[i + 5];
-
-    channel_rw(pInfo, pInfo->hKeyMStart, (void *) tempStart, TID_BOOL, 1);
-
-    // Wait for axes with enabled limit switches to hit their limits
-    while (1) {
-      channel_rw(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT, 0);
-      lastCountPosArm1 = pInfo->CountPos[i];
-      lastCountPosArm2 = pInfo->CountPos[i + 5];
-      sleep(600); // Approx. polling period
-      if ((tempNegLimitEnabled[i] == 1) && (tempNegLimitEnabled[i + 5] == 1)) {// If both gantry axes are enabled.
-        cm_msg(MDEBUG, "initialize", "Polling axes %i and %i.", i, i+5);
-        channel_rw(pInfo, pInfo->hKeyMLimitNeg, (void *) pInfo->neg_AxisLimit, TID_BOOL, 0);
-        if (pInfo->neg_AxisLimit[i] && pInfo->neg_AxisLimit[i + 5]) break;
-        else {
-          channel_rw(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT, 0);
-          if (pInfo->CountPos[i] == lastCountPosArm1 && !pInfo->neg_AxisLimit[i]) {
-            cm_msg(MERROR, "initialize",
-                   "Axis %i not moving. Stopping initialization since limit switch must be broken.", i);
-            channel_rw(pInfo, pInfo->hKeyMStop, (void *) tempStop, TID_BOOL, 1);
-            exitFlag = 1;
-            break;
-          }
-          if (pInfo->CountPos[i + 5] == lastCountPosArm2 && !pInfo->neg_AxisLimit[i + 5]) {
-            cm_msg(MERROR, "initialize",
-                   "Axis %i not moving. Stopping initialization since limit switch must be broken.", i + 5);
-            channel_rw(pInfo, pInfo->hKeyMStop, (void *) tempStop, TID_BOOL, 1);
-            exitFlag = 1;
-            break;
-          }
-        }
-      } else if ((tempNegLimitEnabled[i] == 0) && (tempNegLimitEnabled[i + 5] == 0)) {
-        break;
-      } else if (tempNegLimitEnabled[i] == 0) {  // If only second gantry axis is enabled.
-        cm_msg(MDEBUG, "initialize", "Polling axis %i.", i + 5);
-        channel_rw(pInfo, pInfo->hKeyMLimitNeg, (void *) pInfo->neg_AxisLimit, TID_BOOL, 0);
-        if (pInfo->neg_AxisLimit[i + 5]) {
-          break;
+
+    if (exitFlag == 0) {
+      // Determine the motor positions at the origin and put the results in
+      // pInfo->mOrigin
+      read_motor_channels(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT);
+      for (i = 0; i < 10; i++) {
+        //for(i = gantry_motor_start; i < gantry_motor_end ; i++){
+        // only exception in flexible for loop: even if other motor is off, still initialize to LimPos...TF: safe??
+        if (tempNegLimitEnabled[i] == 1 || (i >= gantry_motor_end || i < gantry_motor_start)) {
+          // The motor origin should always be at the limit switches, since this is
+          // a local variable
+          // MARK
+          pInfo->mOrigin[i] = pInfo->CountPos[i];// - pInfo->LimPos[i]*pInfo->mScale[i];
+          pInfo->Position[i] = pInfo->LimPos[i];
+          cm_msg(MINFO, "initialize", "Finished initializing axis %i; Origin = %5.2f counts, Position = %5.2f m.", i,
+                 pInfo->mOrigin[i], pInfo->Position[i]);
         } else {
-          channel_rw(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT, 0);
-          if (pInfo->CountPos[i + 5] == lastCountPosArm2) {
-            cm_msg(MERROR, "initialize",
-                   "Axis %i not moving. Stopping initialization since limit switch must be broken.", i + 5);
-            channel_rw(pInfo, pInfo->hKeyMStop, (void *) tempStop, TID_BOOL, 1);
-            exitFlag = 1;
-            break;
-          }
-        }
-      } else {// If only first gantry axis is enabled.
-        cm_msg(MDEBUG, "initialize", "Polling axis %i.", i);
-        channel_rw(pInfo, pInfo->hKeyMLimitNeg, (void *) pInfo->neg_AxisLimit, TID_BOOL, 0);
-        if (pInfo->neg_AxisLimit[i]) {
-          break;
-        } else {
-          channel_rw(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT, 0);
-          if (pInfo->CountPos[i] == lastCountPosArm1) {
-            cm_msg(MERROR, "initialize",
-                   "Axis %i not moving. Stopping initialization since limit switch must be broken.", i);
-            channel_rw(pInfo, pInfo->hKeyMStop, (void *) tempStop, TID_BOOL, 1);
-            exitFlag = 1;
-            break;
-          }
+          pInfo->mOrigin[i] = 0;
+          pInfo->Position[i] = 0;
         }
       }
+      set_variable(pInfo->hDB, pInfo->hKeyPos, pInfo->Position, pInfo->PublishedPosition, 10 * sizeof(float), 10,
+                   TID_FLOAT);
     }
-    tempStart[i] = 0;
-    tempStart[i + 5] = 0;
-    if (exitFlag == 1) break;
-  }
 
-  // Wait for all the motors to stop moving (sometimes this 
-  // occurs slightly after the limit switches are triggered)
-  pInfo->Moving = 1;
-  while (pInfo->Moving) {
-    pInfo->Moving = 0;
-    channel_rw(pInfo, pInfo->hKeyMMoving, (void *) pInfo->AxisMoving, TID_BOOL, 0);
-    for (i = gantry_motor_start; i < gantry_motor_end; i++) pInfo->Moving = pInfo->Moving || pInfo->AxisMoving[i];
-  }
-
-  if (exitFlag == 0) {
-    // Determine the motor positions at the origin and put the results in
-    // pInfo->mOrigin
-    channel_rw(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT, 0);
-    for (i = 0; i < 10; i++) {
-      //for(i = gantry_motor_start; i < gantry_motor_end ; i++){
-      // only exception in flexible for loop: even if other motor is off, still initialize to LimPos...TF: safe??
-      if (tempNegLimitEnabled[i] == 1 || (i >= gantry_motor_end || i < gantry_motor_start)) {
-        // The motor origin should always be at the limit switches, since this is 
-        // a local variable
-        // MARK 
-        pInfo->mOrigin[i] = pInfo->CountPos[i];// - pInfo->LimPos[i]*pInfo->mScale[i];
-        pInfo->Position[i] = pInfo->LimPos[i];
-        cm_msg(MINFO, "initialize", "Finished initializing axis %i; Origin = %5.2f counts, Position = %5.2f m.", i,
-               pInfo->mOrigin[i], pInfo->Position[i]);
-      } else {
-        pInfo->mOrigin[i] = 0;
-        pInfo->Position[i] = 0;
-      }
-    }
-    db_set_data(pInfo->hDB, pInfo->hKeyPos, &pInfo->Position, 10 * sizeof(float), 10, TID_FLOAT);
+    exitFlagTilt = initialize_tilt(pInfo);
   }
 
-  int exitFlagTilt = initialize_tilt(pInfo);
-
-
   if (exitFlag == 0 && exitFlagTilt == 0) {
-    // Set Initialized to 1 and exit    
+    // Set Initialized to 1 and exit; prefetch_path only reads the origins once this is set
+    pthread_mutex_lock(&plannerMutex);
     pInfo->Initialized = 1;
+    pthread_mutex_unlock(&plannerMutex);
     db_set_data(pInfo->hDB, pInfo->hKeyInit, &pInfo->Initialized, sizeof(BOOL), 1, TID_BOOL);
+    save_origins(pInfo);
   }
 
   initing = 0;
   db_set_data(pInfo->hDB, pInfo->hKeyInitializing, &initing, sizeof(BOOL), 1, TID_BOOL);
+  free(tempNegLimitEnabled);
+  free(tempPos);
 
-  sleep(100);
+  ss_sleep(100);
   cm_msg(MINFO, "move_init", "Initialization of Gantries is Complete");
 
   /* Rika (20Apr2017): Moved initialization of PMT to initialize() method */
   // PMT position: to be used in generate_path for PMT collision avoidance.
-  pmtPoly0.clear();
-  pmtPoly1.clear();
-  XYPolygon poly0, poly1;
-  for (int polyNum = 1; polyNum <= numPolyLayers; ++polyNum) {
-    poly0.clear();
-    poly1.clear();
-    //cm_msg(MINFO, "generate_path", " PMT polygon 0, layer %i:", polyNum);
-    getPMTpolygon(poly0, pmtRadius, polyNum, pmtXcentre0, pmtYcentre0, numPolySides, pmtPolyLayerHeight);
-    //cm_msg(MINFO, "generate_path", " PMT polygon 1, layer %i:", polyNum);
-    getPMTpolygon(poly1, pmtRadius, polyNum, pmtXcentre1, pmtYcentre1, numPolySides, pmtPolyLayerHeight);
-    pmtPoly0.push_back(poly0);
-    pmtPoly1.push_back(poly1);
-  }
-  pathCalc00.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc01.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc1a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc1b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc2a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc2b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc3a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc3b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc4a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc4b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc5a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc5b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc6a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc6b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc7a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc7b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc8a.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc8b.InitialisePMT(pmtPoly0, pmtPoly1);
-  pathCalc_rot_tilt.InitialisePMT(pmtPoly0, pmtPoly1, pmtHeight, pmtPolyLayerHeight);
+  // The models are built with the collision scene, this loads them into the path calculators.
+  pthread_mutex_lock(&plannerMutex);
+  apply_collision_scene(current_collision_scene());
+  pthread_mutex_unlock(&plannerMutex);
   cm_msg(MINFO, "move_init", "Initialization of PMT position is Complete");
 
   return;
@@ -1269,6 +1563,154 @@ void initialize(INFO *pInfo) {
 
 }
 
+// Axes that go to their limit switches together, on both gantries. Z comes first, so that the
+// laser boxes are fully out of the tank before we move in X and Y. X and Y can then go together:
+// each gantry heads for its own corner, away from the other one. Rotation last, as before.
+#define NUM_HOMING_STAGES 3
+const int homingStages[NUM_HOMING_STAGES][4] = {{2, 7, -1, -1}, {0, 1, 5, 6}, {3, 8, -1, -1}};
+
+// An axis that has not reached its limit switch and has not moved for this long (ms) is stuck
+#define HOMING_STALL_TIME 5000
+
+/*-- Home gantries -------------------------------------------------*/
+// Start the axes with enabled negative limit switches (destinations already
+// set by initialize), stage by stage, and wait for each stage to reach its
+// limit switches. Returns 1 and stops all motors if an axis gets stuck.
+int home_gantries(INFO *pInfo, const BOOL *enabled) {
+  BOOL tempStop[10] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+  BOOL tempStart[10];
+  float lastCountPos[10];
+  DWORD lastMoved[10];
+
+  for (int s = 0; s < NUM_HOMING_STAGES; s++) {
+    char axes[64] = "";
+    memset(tempStart, 0, sizeof(tempStart));
+    for (int j = 0; j < 4; j++) {
+      int i = homingStages[s][j];
+      if (i < 0 || !enabled[i]) continue;
+      tempStart[i] = 1;
+      snprintf(axes + strlen(axes), sizeof(axes) - strlen(axes), " %i", i);
+    }
+    if (!axes[0]) continue;
+
+    cm_msg(MINFO, "initialize", "Initializing axes%s", axes);
+    read_motor_channels(pInfo, pInfo->hKeyMPos, lastCountPos, TID_FLOAT);
+    for (int i = 0; i < 10; i++) lastMoved[i] = ss_millitime();
+    write_motor_channels(pInfo, pInfo->hKeyMStart, tempStart, TID_BOOL);
+
+    // Wait for the axes to hit their limits
+    bool done = false;
+    while (!done) {
+      ss_sleep(600); // Approx. polling period
+      cm_msg(MDEBUG, "initialize", "Polling axes%s.", axes);
+      read_motor_channels(pInfo, pInfo->hKeyMLimitNeg, pInfo->neg_AxisLimit, TID_BOOL);
+      read_motor_channels(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT);
+
+      done = true;
+      for (int i = 0; i < 10; i++) {
+        if (!tempStart[i] || pInfo->neg_AxisLimit[i]) continue;
+        done = false;
+        if (pInfo->CountPos[i] != lastCountPos[i]) {
+          lastCountPos[i] = pInfo->CountPos[i];
+          lastMoved[i] = ss_millitime();
+        } else if (ss_millitime() - lastMoved[i] > HOMING_STALL_TIME) {
+          cm_msg(MERROR, "initialize",
+                 "Axis %i not moving. Stopping initialization since limit switch must be broken.", i);
+          write_motor_channels(pInfo, pInfo->hKeyMStop, tempStop, TID_BOOL);
+          return 1;
+        }
+      }
+    }
+  }
+
+  return 0;
+}
+
+/*-- Restore origins -----------------------------------------------*/
+// Take the origins saved by the last feMove (see MotorOrigins.hxx), if
+// - they were found with the current scaling, limit positions and gantries,
+// - feMotor is running, so the motor variables are read from the Galil,
+// - the motors stand still at the counts they were saved with, to within
+//   originsTolerance (the Galil has not been powered off, nothing moved them),
+// - the negative limit switches agree: one that is triggered has to be at
+//   its origin.
+// Otherwise the motors have to be homed. The tilt is checked against the
+// phidgets in move_init before every move anyway.
+bool restore_origins(INFO *pInfo) {
+  MOTOR_ORIGINS origins;
+  MOTOR_STATE state;
+  int i;
+
+  if (!originsFile[0] || !load_motor_origins(originsFile, &origins)) return false;
+
+  const char *problem = NULL;
+  if (origins.GantryMotors[0] != gantry_motor_start || origins.GantryMotors[1] != gantry_motor_end ||
+      memcmp(origins.Scale, pInfo->mScale, sizeof(origins.Scale)) != 0 ||
+      memcmp(origins.LimPos, pInfo->LimPos, sizeof(origins.LimPos)) != 0) {
+    problem = "were found with other motor settings";
+  } else if (cm_exist("feMotor", FALSE) != CM_SUCCESS) {
+    problem = "cannot be checked, feMotor is not running";
+  }
+
+  if (!problem) {
+    read_motor_state(pInfo, &state);
+    for (i = gantry_motor_start; i < gantry_motor_end && !problem; i++) {
+      if (state.Moving[i]) {
+        problem = "cannot be checked, the motors are moving";
+      } else if (fabs(state.Position[i] - origins.Counts[i]) > originsTolerance) {
+        cm_msg(MINFO, "restore_origins", "Axis %i is at %.0f counts, it was saved at %.0f", i, state.Position[i],
+               origins.Counts[i]);
+        problem = "are lost, the motors have moved or the Galil has been restarted";
+      } else if (state.LimitNeg[i] && i != 4 && i != 9 && pInfo->LimPos[i] != 9999 &&
+                 fabs(state.Position[i] - origins.Origin[i]) > originsTolerance) {
+        cm_msg(MINFO, "restore_origins", "Axis %i is on its limit switch %.0f counts away from its origin", i,
+               state.Position[i] - origins.Origin[i]);
+        problem = "do not agree with the limit switches";
+      }
+    }
+  }
+
+  if (problem) {
+    cm_msg(MINFO, "restore_origins", "Motor origins saved in %s %s; homing the gantries", originsFile, problem);
+    return false;
+  }
+
+  memcpy(pInfo->mOrigin, origins.Origin, sizeof(origins.Origin));
+  memcpy(pInfo->CountPos, state.Position, sizeof(state.Position));
+  for (i = 0; i < 10; i++) {
+    if (i >= gantry_motor_start && i < gantry_motor_end) {
+      pInfo->Position[i] = (pInfo->CountPos[i] - pInfo->mOrigin[i]) / pInfo->mScale[i] + pInfo->LimPos[i];
+    } else {
+      pInfo->Position[i] = pInfo->LimPos[i];
+    }
+  }
+  set_variable(pInfo->hDB, pInfo->hKeyPos, pInfo->Position, pInfo->PublishedPosition, 10 * sizeof(float), 10,
+               TID_FLOAT);
+
+  cm_msg(MINFO, "restore_origins", "Motors have not moved since %s was saved %u s ago; not homing the gantries",
+         originsFile, ss_time() - origins.Time);
+  return true;
+}
+
+/*-- Save origins --------------------------------------------------*/
+// Save the origins and the current motor counts for the next start of
+// feMove. Only called when the motors have stopped.
+void save_origins(INFO *pInfo) {
+  MOTOR_ORIGINS origins;
+
+  if (!originsFile[0] || !pInfo->Initialized) return;
+
+  memset(&origins, 0, sizeof(origins));
+  origins.Time = ss_time();
+  origins.GantryMotors[0] = gantry_motor_start;
+  origins.GantryMotors[1] = gantry_motor_end;
+  memcpy(origins.Scale, pInfo->mScale, sizeof(origins.Scale));
+  memcpy(origins.LimPos, pInfo->LimPos, sizeof(origins.LimPos));
+  memcpy(origins.Origin, pInfo->mOrigin, sizeof(origins.Origin));
+  memcpy(origins.Counts, pInfo->CountPos, sizeof(origins.Counts));
+  save_motor_origins(originsFile, &origins);
+}
+
 /*-- Re-Initialize -------------------------------------------------*/
 // Set initialized to 0, then start the move
 void reinitialize(HNDLE hDB, HNDLE hKey, void *data) {
@@ -1279,9 +1721,14 @@ void reinitialize(HNDLE hDB, HNDLE hKey, void *data) {
   db_get_data(hDB, pInfo->hKeyReInit, &pInfo->ReInitialize, &size, TID_BOOL);
   if (!pInfo->ReInitialize) return;
 
+  pthread_mutex_lock(&plannerMutex);
   pInfo->Initialized = 0;
+  pthread_mutex_unlock(&plannerMutex);
   db_set_data(hDB, pInfo->hKeyInit, &pInfo->Initialized, sizeof(BOOL), 1, TID_BOOL);
 
+  // Asked for explicitly, so the saved origins are not taken
+  pInfo->Rehome = 1;
+
   pInfo->Start = 1;
   db_set_data(hDB, pInfo->hKeyStart, &pInfo->Start, sizeof(BOOL), 1, TID_BOOL);
 
@@ -1336,20 +1783,27 @@ void reinitialize(HNDLE hDB, HNDLE hKey, void *data) {
 //		-to ensure intermediate roation positions will not collide with other gantry or water tank (in case where initial and final rotation is good but intermediate value is not) TRotationCalculator is constructed
 int generate_path(INFO *pInfo) {
 
+  // Hold on to the current collision scene until the path is done, even if it is reloaded meanwhile
+  const std::shared_ptr<const COLLISION_SCENE> scene = current_collision_scene();
+  apply_collision_scene(scene);
+  for (int i = 0; i < numPathCalcs; i++) pathCalcs[i]->SetVerbose(!pInfo->Prefetch);
+  for (int i = 0; i < NUM_ROT_TILT_CHECKS; i++) pathCalcs_rot_tilt[i]->SetVerbose(!pInfo->Prefetch);
+  const double pmtHeight = scene->Settings.PMTHeight;
+
   // Check for illegal destinations.  Currently just check:
   // rot_min < rotary angle < rot_max
-  double rot_min = -100, rot_max = 120; //Rotation limited to values equal to or greater than -100 degrees
+  double rot_min = GANTRY_ROT_MIN, rot_max = GANTRY_ROT_MAX; //Rotation limited to values equal to or greater than -100 degrees
   //to avoid triggering limit switch during scan; updated Feb 28, 2017
   // tilt_min < tilt angle < tilt_max
-  double tilt_min = -105, tilt_max = 15;
+  double tilt_min = GANTRY_TILT_MIN, tilt_max = GANTRY_TILT_MAX;
 
-  double z_max_value = 0.535; // Rika (23Mar2017): gantry positive z limit switch at z = 0.534m.
+  double z_max_value = GANTRY_Z_MAX; // Rika (23Mar2017): gantry positive z limit switch at z = 0.534m.
   // John (16Oct2019): Reducing z_max from 0.535 to 0.22 for PMT scans because getting too close to acrylic
 
   // double safeZheight = 0.260; // Rika (4Apr2017): z height at which any movement (rot & tilt) is PMT collision free.
   // (24Apr2017) updated safeZheight for new PMT position (previously 0.46m)
 
-  double tankHeight = 0.05; //actually 0.08 but play safe.
+  double tankHeight = TANK_HEIGHT; //actually 0.08 but play safe.
 
   bool move_second_gantry_first = false;
   bool move_z1_first = false;
@@ -1396,7 +1850,7 @@ int generate_path(INFO *pInfo) {
   std::pair<double, double> opticalBox0_height[2];
   std::pair<double, double> opticalBox1_height[2];
   // Stores z-heights relative to the PMT polygon layers
-  //i.e ((gantryZ + opticalBox_height) - (pmtHeight))/pmtPolyLayerHeight
+  //i.e ((gantryZ + opticalBox_height) - (pmtHeight))/pmtLayerHeight
   int opticalBox0_lo_Z[2];
   int opticalBox0_up_Z[2];
   int opticalBox1_lo_Z[2];
@@ -1556,27 +2010,27 @@ int generate_path(INFO *pInfo) {
   // Path calculator checks if destination is inside the other gantry or outside the tank, but doesn't check rotation
   // Leave this check here for now
   if (pInfo->Destination[3] < rot_min || pInfo->Destination[3] > rot_max) {
-    cm_msg(MERROR, "generate_path", "Illegal value for 1st rotary angle of %5.2f: not between %5.2f and %5.2f",
-           pInfo->Destination[3], rot_min, rot_max);
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for 1st rotary angle of %5.2f: not between %5.2f and %5.2f",
+                    pInfo->Destination[3], rot_min, rot_max);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[8] < rot_min || pInfo->Destination[8] > rot_max) {
-    cm_msg(MERROR, "generate_path", "Illegal value for 2nd rotary angle of %5.2f: not between %5.2f and %5.2f",
-           pInfo->Destination[8], rot_min, rot_max);
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for 2nd rotary angle of %5.2f: not between %5.2f and %5.2f",
+                    pInfo->Destination[8], rot_min, rot_max);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[4] < tilt_min || pInfo->Destination[4] > tilt_max) {
-    cm_msg(MERROR, "generate_path", "Illegal value for 1st tilt angle of %5.2f: not between %5.2f and %5.2f",
-           pInfo->Destination[4], tilt_min, tilt_max);
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for 1st tilt angle of %5.2f: not between %5.2f and %5.2f",
+                    pInfo->Destination[4], tilt_min, tilt_max);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[9] < tilt_min || pInfo->Destination[9] > tilt_max) {
-    cm_msg(MERROR, "generate_path", "Illegal value for 2nd tilt angle of %5.2f: not between %5.2f and %5.2f",
-           pInfo->Destination[9], tilt_min, tilt_max);
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for 2nd tilt angle of %5.2f: not between %5.2f and %5.2f",
+                    pInfo->Destination[9], tilt_min, tilt_max);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[2] > z_max_value || pInfo->Destination[7] > z_max_value) {
-    cm_msg(MERROR, "generate_path", "Illegal value for Z position: should be smaller than %5.2f", z_max_value);
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for Z position: should be smaller than %5.2f", z_max_value);
     return GENPATH_BAD_DEST;
   }
 
@@ -1584,27 +2038,27 @@ int generate_path(INFO *pInfo) {
   // otherwise the collision avoidance code will assume that the gantry can get to that location safely,
   // when it might in fact get stuck at a limit switch in a collision zone.
   if (pInfo->Destination[0] < pInfo->LimPos[0] || pInfo->Destination[0] > pInfo->LimPos[5]) {
-    cm_msg(MERROR, "generate_path",
-           "Gantry 0 X destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
-           pInfo->Destination[0], pInfo->LimPos[0], pInfo->LimPos[5]);
+    PLAN_MSG(pInfo, MERROR, "generate_path",
+                    "Gantry 0 X destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
+                    pInfo->Destination[0], pInfo->LimPos[0], pInfo->LimPos[5]);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[5] < pInfo->LimPos[0] || pInfo->Destination[5] > pInfo->LimPos[5]) {
-    cm_msg(MERROR, "generate_path",
-           "Gantry 1 X destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
-           pInfo->Destination[5], pInfo->LimPos[0], pInfo->LimPos[5]);
+    PLAN_MSG(pInfo, MERROR, "generate_path",
+                    "Gantry 1 X destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
+                    pInfo->Destination[5], pInfo->LimPos[0], pInfo->LimPos[5]);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[1] < pInfo->LimPos[1] || pInfo->Destination[1] > pInfo->LimPos[6]) {
-    cm_msg(MERROR, "generate_path",
-           "Gantry 0 Y destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
-           pInfo->Destination[1], pInfo->LimPos[1], pInfo->LimPos[6]);
+    PLAN_MSG(pInfo, MERROR, "generate_path",
+                    "Gantry 0 Y destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
+                    pInfo->Destination[1], pInfo->LimPos[1], pInfo->LimPos[6]);
     return GENPATH_BAD_DEST;
   }
   if (pInfo->Destination[6] < pInfo->LimPos[1] || pInfo->Destination[6] > pInfo->LimPos[6]) {
-    cm_msg(MERROR, "generate_path",
-           "Gantry 1 Y destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
-           pInfo->Destination[6], pInfo->LimPos[1], pInfo->LimPos[6]);
+    PLAN_MSG(pInfo, MERROR, "generate_path",
+                    "Gantry 1 Y destination at %5.3f is outside gantry limits: not between %5.3f and %5.3f",
+                    pInfo->Destination[6], pInfo->LimPos[1], pInfo->LimPos[6]);
     return GENPATH_BAD_DEST;
   }
 
@@ -1612,12 +2066,12 @@ int generate_path(INFO *pInfo) {
   if (tankheight_gantend1) move_z1_first = true;
   if (tankheight_gantend2) move_z2_first = true;
 
-  std::cout << "Move z first:  " << move_z1_first << "  " << move_z2_first << std::endl;
+  PLAN_MSG(pInfo, MDEBUG, "generate_path", "Move z first:  %i  %i", move_z1_first, move_z2_first);
 
   // First check: beams should never cross each other
-  if(pInfo->Destination[0] + 0.05 >= pInfo->Destination[5]){ // conservative
+  if(pInfo->Destination[0] + GANTRY_BEAM_GAP >= pInfo->Destination[5]){ // conservative
   //if (pInfo->Destination[0] - 0.05 >= pInfo->Destination[5]) {  //closest possible
-    cm_msg(MERROR, "generate_path", "Illegal value for X destination: Beams will collide");
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for X destination: Beams will collide");
     return GENPATH_BAD_DEST;
   }
 
@@ -1627,10 +2081,10 @@ int generate_path(INFO *pInfo) {
   bool validDestination_box1 = true;
   std::pair<double, double> finalZ_box0_lo_up = gantryConfigCalc.GetOpticalBoxZ(0, gant1_tilt_start, gantry1ZDes);
   std::pair<double, double> finalZ_box1_lo_up = gantryConfigCalc.GetOpticalBoxZ(1, gant2_tilt_start, gantry2ZDes);
-  int finalZ_box0_lo = (finalZ_box0_lo_up.first - pmtHeight) / pmtPolyLayerHeight;
-  int finalZ_box0_up = (finalZ_box0_lo_up.second - pmtHeight) / pmtPolyLayerHeight;
-  int finalZ_box1_lo = (finalZ_box1_lo_up.first - pmtHeight) / pmtPolyLayerHeight;
-  int finalZ_box1_up = (finalZ_box1_lo_up.second - pmtHeight) / pmtPolyLayerHeight;
+  int finalZ_box0_lo = (finalZ_box0_lo_up.first - pmtHeight) / pmtLayerHeight;
+  int finalZ_box0_up = (finalZ_box0_lo_up.second - pmtHeight) / pmtLayerHeight;
+  int finalZ_box1_lo = (finalZ_box1_lo_up.first - pmtHeight) / pmtLayerHeight;
+  int finalZ_box1_up = (finalZ_box1_lo_up.second - pmtHeight) / pmtLayerHeight;
 
   // Check gantries & tank:
   validDestination_box0 = pathCalc_checkDestination.CheckDestination(gantry1_endpos_rotfirst_tiltfirst,
@@ -1641,29 +2095,25 @@ int generate_path(INFO *pInfo) {
                                                                      tankheight_gantend2);
 
   if (!(validDestination_box0 && validDestination_box1)) {
-    cm_msg(MERROR, "generate_path", "Invalid destination: gantries will collide with each other or with tank.");
+    PLAN_MSG(pInfo, MERROR, "generate_path", "Invalid destination: gantries will collide with each other or with tank.");
     return GENPATH_BAD_DEST;
   }
 
   // Check PMT:
   if (finalZ_box0_lo >= 0) {
-    validDestination_box0 = pathCalc_checkDestination.CheckDestination(box0_endpos_rotfirst_tiltfirst.first,
-                                                                       pmtPoly0.at(finalZ_box0_lo),
-                                                                       tankheight_gantend1);
+    validDestination_box0 = pathCalc_checkDestination.CheckDestination(box0_endpos_rotfirst_tiltfirst.first, 0,
+                                                                       finalZ_box0_lo, tankheight_gantend1);
     if (validDestination_box0 && finalZ_box0_up >= 0) {
-      validDestination_box0 = pathCalc_checkDestination.CheckDestination(box0_endpos_rotfirst_tiltfirst.second,
-                                                                         pmtPoly0.at(finalZ_box0_up),
-                                                                         tankheight_gantend1);
+      validDestination_box0 = pathCalc_checkDestination.CheckDestination(box0_endpos_rotfirst_tiltfirst.second, 0,
+                                                                         finalZ_box0_up, tankheight_gantend1);
     }
   }
   if (finalZ_box1_lo >= 0) {
-    validDestination_box1 = pathCalc_checkDestination.CheckDestination(box1_endpos_rotfirst_tiltfirst.first,
-                                                                       pmtPoly1.at(finalZ_box1_lo),
-                                                                       tankheight_gantend2);
+    validDestination_box1 = pathCalc_checkDestination.CheckDestination(box1_endpos_rotfirst_tiltfirst.first, 1,
+                                                                       finalZ_box1_lo, tankheight_gantend2);
     if (validDestination_box1 && finalZ_box1_up >= 0) {
-      validDestination_box1 = pathCalc_checkDestination.CheckDestination(box1_endpos_rotfirst_tiltfirst.second,
-                                                                         pmtPoly1.at(finalZ_box1_up),
-                                                                         tankheight_gantend2);
+      validDestination_box1 = pathCalc_checkDestination.CheckDestination(box1_endpos_rotfirst_tiltfirst.second, 1,
+                                                                         finalZ_box1_up, tankheight_gantend2);
     }
   }
   // Remove comments
@@ -1674,6 +2124,31 @@ int generate_path(INFO *pInfo) {
   }
   */
 
+  // The destination is good. If this move was planned before, use that path (see PathCache.hxx).
+  uint32_t sceneHash = 0;
+  float cacheStart[10], cacheDest[10];
+  if (pathCache) {
+    sceneHash = path_scene_hash(pInfo, scene->Settings);
+    for (int i = 0; i < 10; i++) {
+      cacheStart[i] = pInfo->CountPos[i] - pInfo->mOrigin[i];
+      cacheDest[i] = round((pInfo->Destination[i] - pInfo->LimPos[i]) * pInfo->mScale[i] + pInfo->mOrigin[i]) -
+                     pInfo->mOrigin[i];
+    }
+    float cached[PATH_CACHE_MAX_WAYPOINTS][10];
+    int numWaypoints = find_cached_path(pathCache, sceneHash, pathCacheQuantum, cacheStart, cacheDest, cached);
+    if (numWaypoints > 0) {
+      alloc_move_path(pInfo, numWaypoints);
+      for (int j = 0; j < numWaypoints; j++) {
+        for (int i = 0; i < 10; i++) pInfo->MovePath[i][j] = cached[j][i] + pInfo->mOrigin[i];
+      }
+      pInfo->PathSize = numWaypoints;
+      pInfo->PathIndex = 0;
+      compact_path(pInfo);
+      PLAN_MSG(pInfo, MINFO, "generate_path", "Using the path planned before (%i waypoints)", pInfo->PathSize);
+      return GENPATH_SUCCESS;
+    }
+  }
+
   // Define xy plane in terms of z heights at which path will be checked for collision avoidance.
   double gantry1Z = gantry1ZDes;
   double gantry2Z = gantry2ZDes;
@@ -1706,10 +2181,10 @@ int generate_path(INFO *pInfo) {
   opticalBox0_height[1] = gantryConfigCalc.GetOpticalBoxZ(0, gant1_tilt_end, gantry1Z);
   opticalBox1_height[1] = gantryConfigCalc.GetOpticalBoxZ(1, gant2_tilt_end, gantry2Z);
   for (int tilt = 0; tilt < 2; tilt++) {
-    opticalBox0_lo_Z[tilt] = (opticalBox0_height[tilt].first - pmtHeight) / pmtPolyLayerHeight;
-    opticalBox0_up_Z[tilt] = (opticalBox0_height[tilt].second - pmtHeight) / pmtPolyLayerHeight;
-    opticalBox1_lo_Z[tilt] = (opticalBox1_height[tilt].first - pmtHeight) / pmtPolyLayerHeight;
-    opticalBox1_up_Z[tilt] = (opticalBox1_height[tilt].second - pmtHeight) / pmtPolyLayerHeight;
+    opticalBox0_lo_Z[tilt] = (opticalBox0_height[tilt].first - pmtHeight) / pmtLayerHeight;
+    opticalBox0_up_Z[tilt] = (opticalBox0_height[tilt].second - pmtHeight) / pmtLayerHeight;
+    opticalBox1_lo_Z[tilt] = (opticalBox1_height[tilt].first - pmtHeight) / pmtLayerHeight;
+    opticalBox1_up_Z[tilt] = (opticalBox1_height[tilt].second - pmtHeight) / pmtLayerHeight;
   }
 
   // Tilt first
@@ -1826,67 +2301,88 @@ int generate_path(INFO *pInfo) {
   std::pair<double, double> tilt_end1 = std::make_pair(pInfo->Destination[4], pInfo->Destination[4]);
   std::pair<double, double> tilt_end2 = std::make_pair(pInfo->Destination[9], pInfo->Destination[9]);
 
-  // determine good paths
-  bool goodPath00 = false, goodPath01 = false;
+  // XY checks for each strategy, in order 1a, 1b, 2a, ..., 8b.
+  // Strategies 1, 2, 5 & 6 move gantry 1 first ("a" checks gantry 1 and "b" gantry 2), 3, 4, 7 & 8 gantry 2 first.
+  enum {
+    XY_1A, XY_1B, XY_2A, XY_2B, XY_3A, XY_3B, XY_4A, XY_4B,
+    XY_5A, XY_5B, XY_6A, XY_6B, XY_7A, XY_7B, XY_8A, XY_8B,
+    NUM_XY_CHECKS
+  };
+  TPathCalculator *xyCalcs[NUM_XY_CHECKS] = {
+    &pathCalc1a, &pathCalc1b, &pathCalc2a, &pathCalc2b, &pathCalc3a, &pathCalc3b, &pathCalc4a, &pathCalc4b,
+    &pathCalc5a, &pathCalc5b, &pathCalc6a, &pathCalc6b, &pathCalc7a, &pathCalc7b, &pathCalc8a, &pathCalc8b
+  };
+  XY_PATH_CHECK xyChecks[NUM_XY_CHECKS];
+  for (int i = 0; i < NUM_XY_CHECKS; i++) {
+    bool gantry1First = (i / 2) % 4 < 2;
+    bool movesGantry1 = (i % 2 == 0) == gantry1First;
+    xyChecks[i].Calc = xyCalcs[i];
+    xyChecks[i].Start = movesGantry1 ? xy_start1 : xy_start2;
+    xyChecks[i].End = movesGantry1 ? xy_end1 : xy_end2;
+    xyChecks[i].TankStart = start_tank;
+    xyChecks[i].TankEnd = end_tank;
+  }
+
+  // Incremental rotation & tilt paths verification
+  ROT_TILT_CHECK rotTiltChecks[NUM_ROT_TILT_CHECKS];
+  for (int i = 0; i < NUM_ROT_TILT_CHECKS; i++) {
+    ROT_TILT_CHECK &check = rotTiltChecks[i];
+    check.Calc = pathCalcs_rot_tilt[i];
+    // start position only while rotating & tilting together or before moving in X & Y
+    bool atStart = (i == ROT_TILT_ROTFIRST_TILTFIRST || i == TILT_ROTSECOND_TILTFIRST ||
+                    i == ROTATION_ROTFIRST_TILTSECOND);
+    check.Pos0 = atStart ? xy_start1 : xy_end1;
+    check.Pos1 = atStart ? xy_start2 : xy_end2;
+    check.Rot0 = rot_path1;
+    check.Rot1 = rot_path2;
+    check.Tilt0 = tilt_path1;
+    check.Tilt1 = tilt_path2;
+    check.Z0 = gantry1Z;
+    check.Z1 = gantry2Z;
+    check.TankStart = start_tank;
+    check.TankEnd = end_tank;
+  }
+  rotTiltChecks[TILT_ROTSECOND_TILTFIRST].Rot0 = rot_start1;
+  rotTiltChecks[TILT_ROTSECOND_TILTFIRST].Rot1 = rot_start2;
+  rotTiltChecks[ROTATION_ROTSECOND_TILTFIRST].Tilt0 = tilt_end1;
+  rotTiltChecks[ROTATION_ROTSECOND_TILTFIRST].Tilt1 = tilt_end2;
+  rotTiltChecks[ROTATION_ROTFIRST_TILTSECOND].Tilt0 = tilt_start1;
+  rotTiltChecks[ROTATION_ROTFIRST_TILTSECOND].Tilt1 = tilt_start2;
+  rotTiltChecks[TILT_ROTFIRST_TILTSECOND].Rot0 = rot_end1;
+  rotTiltChecks[TILT_ROTFIRST_TILTSECOND].Rot1 = rot_end2;
+  rotTiltChecks[ROT_TILT_ENDCHECK].Rot0 = rot_end1;
+  rotTiltChecks[ROT_TILT_ENDCHECK].Rot1 = rot_end2;
+  rotTiltChecks[ROT_TILT_ENDCHECK].Tilt0 = tilt_end1;
+  rotTiltChecks[ROT_TILT_ENDCHECK].Tilt1 = tilt_end2;
+
+  // Run all the checks at once; the first good strategy in the order below is then picked from their results
+  PATH_CHECKS checks = {xyChecks, NUM_XY_CHECKS, rotTiltChecks, NUM_ROT_TILT_CHECKS, 0};
+  run_path_checks(&checks);
 
   // Tilt first
-  // Calculate good paths for gantry 1 move first, rotate first
-  bool goodPath1a = pathCalc1a.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  bool goodPath1b = pathCalc1b.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  // Calculate good paths for gantry 1 move first, rotate second
-  bool goodPath2a = pathCalc2a.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  bool goodPath2b = pathCalc2b.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  // Calculate good paths for gantry 2 move first, rotate first
-  bool goodPath3a = pathCalc3a.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  bool goodPath3b = pathCalc3b.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  // Calculate good paths for gantry 2 move first, rotate second
-  bool goodPath4a = pathCalc4a.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  bool goodPath4b = pathCalc4b.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  // Incremental rotation & tilt paths verification 
-  bool goodRotationTilt_rotfirst_tiltfirst = pathCalc_rot_tilt.CalculatePath(xy_start1, xy_start2, rot_path1, rot_path2,
-                                                                             tilt_path1, tilt_path2, gantry1Z, gantry2Z,
-                                                                             start_tank, end_tank);
-  bool goodTilt_rotsecond_tiltfirst = pathCalc_rot_tilt.CalculatePath(xy_start1, xy_start2, rot_start1, rot_start2,
-                                                                      tilt_path1, tilt_path2, gantry1Z, gantry2Z,
-                                                                      start_tank, end_tank);
-  bool goodRotation_rotsecond_tiltfirst = pathCalc_rot_tilt.CalculatePath(xy_end1, xy_end2, rot_path1, rot_path2,
-                                                                          tilt_end1, tilt_end2, gantry1Z, gantry2Z,
-                                                                          start_tank, end_tank);
-  bool goodRotationTilt_endcheck_tiltfirst = pathCalc_rot_tilt.CalculatePath(xy_end1, xy_end2, rot_end1, rot_end2,
-                                                                             tilt_end1, tilt_end2, gantry1Z, gantry2Z,
-                                                                             start_tank, end_tank);
+  bool goodPath1a = xyChecks[XY_1A].Good, goodPath1b = xyChecks[XY_1B].Good;
+  bool goodPath2a = xyChecks[XY_2A].Good, goodPath2b = xyChecks[XY_2B].Good;
+  bool goodPath3a = xyChecks[XY_3A].Good, goodPath3b = xyChecks[XY_3B].Good;
+  bool goodPath4a = xyChecks[XY_4A].Good, goodPath4b = xyChecks[XY_4B].Good;
+  bool goodRotationTilt_rotfirst_tiltfirst = rotTiltChecks[ROT_TILT_ROTFIRST_TILTFIRST].Good;
+  bool goodTilt_rotsecond_tiltfirst = rotTiltChecks[TILT_ROTSECOND_TILTFIRST].Good;
+  bool goodRotation_rotsecond_tiltfirst = rotTiltChecks[ROTATION_ROTSECOND_TILTFIRST].Good;
+  bool goodRotationTilt_endcheck_tiltfirst = rotTiltChecks[ROT_TILT_ENDCHECK].Good;
   // Tilt second
-  // Calculate good paths for gantry 1 move first, rotate first
-  bool goodPath5a = pathCalc5a.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  bool goodPath5b = pathCalc5b.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  // Calculate good paths for gantry 1 move first, rotate second
-  bool goodPath6a = pathCalc6a.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  bool goodPath6b = pathCalc6b.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  // Calculate good paths for gantry 2 move first, rotate first
-  bool goodPath7a = pathCalc7a.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  bool goodPath7b = pathCalc7b.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  // Calculate good paths for gantry 2 move first, rotate second
-  bool goodPath8a = pathCalc8a.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
-  bool goodPath8b = pathCalc8b.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-  // Incremental rotation path verification 
-  bool goodRotation_rotfirst_tiltsecond = pathCalc_rot_tilt.CalculatePath(xy_start1, xy_start2, rot_path1, rot_path2,
-                                                                          tilt_start1, tilt_start2, gantry1Z, gantry2Z,
-                                                                          start_tank, end_tank);
-  bool goodTilt_rotfirst_tiltsecond = pathCalc_rot_tilt.CalculatePath(xy_end1, xy_end2, rot_end1, rot_end2, tilt_path1,
-                                                                      tilt_path2, gantry1Z, gantry2Z, start_tank,
-                                                                      end_tank);
-  bool goodRotationTilt_rotsecond_tiltsecond = pathCalc_rot_tilt.CalculatePath(xy_end1, xy_end2, rot_path1, rot_path2,
-                                                                               tilt_path1, tilt_path2, gantry1Z,
-                                                                               gantry2Z, start_tank, end_tank);
-  bool goodRotationTilt_endcheck_tiltsecond = pathCalc_rot_tilt.CalculatePath(xy_end1, xy_end2, rot_end1, rot_end2,
-                                                                              tilt_end1, tilt_end2, gantry1Z, gantry2Z,
-                                                                              start_tank, end_tank);
+  bool goodPath5a = xyChecks[XY_5A].Good, goodPath5b = xyChecks[XY_5B].Good;
+  bool goodPath6a = xyChecks[XY_6A].Good, goodPath6b = xyChecks[XY_6B].Good;
+  bool goodPath7a = xyChecks[XY_7A].Good, goodPath7b = xyChecks[XY_7B].Good;
+  bool goodPath8a = xyChecks[XY_8A].Good, goodPath8b = xyChecks[XY_8B].Good;
+  bool goodRotation_rotfirst_tiltsecond = rotTiltChecks[ROTATION_ROTFIRST_TILTSECOND].Good;
+  bool goodTilt_rotfirst_tiltsecond = rotTiltChecks[TILT_ROTFIRST_TILTSECOND].Good;
+  bool goodRotationTilt_rotsecond_tiltsecond = rotTiltChecks[ROT_TILT_ROTSECOND_TILTSECOND].Good;
+  bool goodRotationTilt_endcheck_tiltsecond = rotTiltChecks[ROT_TILT_ENDCHECK].Good;
 
   //Check whether we are not crossing a beam, because PathCalculator does not know about the beam
   //  //if(pInfo->Destination[0] + 0.05 >= gantry2XPos){   //conservative
   if (pInfo->Destination[0] - 0.05 >= gantry2XPos) {     // closest possible
-    cm_msg(MINFO, "generate_path",
-           "Illegal value for X destination gantry1: will collide against beam gantry 2. Only possible if you move gantry2 out of the way first");
+    PLAN_MSG(pInfo, MINFO, "generate_path",
+                    "Illegal value for X destination gantry1: will collide against beam gantry 2. Only possible if you move gantry2 out of the way first");
     //move_second_gantry_first = true;
     gant2_movefirst = true;
   }
@@ -1895,58 +2391,26 @@ int generate_path(INFO *pInfo) {
   // Determine which motion the gantry system can take: IF 1) gantry1 move first, rotate first ELSE 2) gantry1 move first, rotate second ELSE 3) gantry2 move first, rotate first ELSE 4) gantry2 move first, rotate second
   if (goodPath1a && goodPath1b && goodRotationTilt_rotfirst_tiltfirst && goodRotationTilt_endcheck_tiltfirst &&
       !gant2_movefirst) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation first, tilt first");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotfirst_tiltfirst, gantry2_startpos_rotfirst_tiltfirst);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotfirst_tiltfirst.first,
-                                      box0_startpos_rotfirst_tiltfirst.second,
-                                      box1_startpos_rotfirst_tiltfirst.first,
-                                      box1_startpos_rotfirst_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0],
-                                      opticalBox1_lo_Z[0], opticalBox1_up_Z[0]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_endpos_rotfirst_tiltfirst, gantry2_startpos_rotfirst_tiltfirst);
-    pathCalc01.InitialiseOpticalBoxes(box0_endpos_rotfirst_tiltfirst.first, box0_endpos_rotfirst_tiltfirst.second,
-                                      box1_startpos_rotfirst_tiltfirst.first, box1_startpos_rotfirst_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation first, tilt first");
+    path1 = xyChecks[XY_1A].Path;
+    path2 = xyChecks[XY_1B].Path;
     move_rotation_first = true;
     tiltfirst = true;
 
   } else if (goodPath2a && goodPath2b && goodTilt_rotsecond_tiltfirst && goodRotation_rotsecond_tiltfirst &&
              goodRotationTilt_endcheck_tiltfirst && !gant2_movefirst) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation second, tilt first");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotsecond_tiltfirst, gantry2_startpos_rotsecond_tiltfirst);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotsecond_tiltfirst.first, box0_startpos_rotsecond_tiltfirst.second,
-                                      box1_startpos_rotsecond_tiltfirst.first, box1_startpos_rotsecond_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_endpos_rotsecond_tiltfirst, gantry2_startpos_rotsecond_tiltfirst);
-    pathCalc01.InitialiseOpticalBoxes(box0_endpos_rotsecond_tiltfirst.first, box0_endpos_rotsecond_tiltfirst.second,
-                                      box1_startpos_rotfirst_tiltfirst.first, box1_startpos_rotfirst_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation second, tilt first");
+    path1 = xyChecks[XY_2A].Path;
+    path2 = xyChecks[XY_2B].Path;
     tiltfirst = true;
 
   } else if (goodPath3a && goodPath3b && goodRotationTilt_rotfirst_tiltfirst && goodRotationTilt_endcheck_tiltfirst) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation first, tilt first");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotfirst_tiltfirst, gantry2_endpos_rotfirst_tiltfirst);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotfirst_tiltfirst.first, box0_startpos_rotfirst_tiltfirst.second,
-                                      box1_startpos_rotfirst_tiltfirst.first, box1_startpos_rotfirst_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_startpos_rotfirst_tiltfirst, gantry2_startpos_rotfirst_tiltfirst);
-    pathCalc01.InitialiseOpticalBoxes(box0_startpos_rotfirst_tiltfirst.first, box0_startpos_rotfirst_tiltfirst.second,
-                                      box1_endpos_rotfirst_tiltfirst.first, box1_endpos_rotfirst_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation first, tilt first");
+    path1 = xyChecks[XY_3B].Path;
+    path2 = xyChecks[XY_3A].Path;
     // Check first whether we are not crossing a beam in a way that gantry1 had to move first
     if (pInfo->Destination[5] + 0.05 <= gantry1XPos) {  // closest possible
-      cm_msg(MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
+      PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
       return GENPATH_BAD_DEST;
     }
     move_rotation_first = true;
@@ -1954,116 +2418,59 @@ int generate_path(INFO *pInfo) {
     tiltfirst = true;
   } else if (goodPath4a && goodPath4b && goodTilt_rotsecond_tiltfirst && goodRotation_rotsecond_tiltfirst &&
              goodRotationTilt_endcheck_tiltfirst) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation second, tilt first");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotsecond_tiltfirst, gantry2_endpos_rotsecond_tiltfirst);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotsecond_tiltfirst.first, box0_startpos_rotsecond_tiltfirst.second,
-                                      box1_startpos_rotsecond_tiltfirst.first, box1_startpos_rotsecond_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_startpos_rotsecond_tiltfirst, gantry2_startpos_rotsecond_tiltfirst);
-    pathCalc01.InitialiseOpticalBoxes(box0_startpos_rotsecond_tiltfirst.first, box0_startpos_rotsecond_tiltfirst.second,
-                                      box1_endpos_rotsecond_tiltfirst.first, box1_endpos_rotsecond_tiltfirst.second,
-                                      opticalBox0_lo_Z[0], opticalBox0_up_Z[0], opticalBox1_lo_Z[0],
-                                      opticalBox1_up_Z[0]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation second, tilt first");
+    path1 = xyChecks[XY_4B].Path;
+    path2 = xyChecks[XY_4A].Path;
     // Check first whether we are not crossing a beam in a way that gantry1 had to move first
     if (pInfo->Destination[5] + 0.05 <= gantry1XPos) {  // closest possible
-      cm_msg(MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
+      PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
       return GENPATH_BAD_DEST;
     }
     move_second_gantry_first = true;
     tiltfirst = true;
   } else if (goodPath5a && goodPath5b && goodRotation_rotfirst_tiltsecond && goodTilt_rotfirst_tiltsecond &&
              goodRotationTilt_endcheck_tiltsecond && !gant2_movefirst) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation first, tilt second");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotfirst_tiltsecond, gantry2_startpos_rotfirst_tiltsecond);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotfirst_tiltsecond.first, box0_startpos_rotfirst_tiltsecond.second,
-                                      box1_startpos_rotfirst_tiltsecond.first, box1_startpos_rotfirst_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_endpos_rotfirst_tiltsecond, gantry2_startpos_rotfirst_tiltsecond);
-    pathCalc01.InitialiseOpticalBoxes(box0_endpos_rotfirst_tiltsecond.first, box0_endpos_rotfirst_tiltsecond.second,
-                                      box1_startpos_rotfirst_tiltsecond.first, box1_startpos_rotfirst_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation first, tilt second");
+    path1 = xyChecks[XY_5A].Path;
+    path2 = xyChecks[XY_5B].Path;
     move_rotation_first = true;
   } else if (goodPath6a && goodPath6b && goodRotationTilt_rotsecond_tiltsecond &&
              goodRotationTilt_endcheck_tiltsecond && !gant2_movefirst) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation second, tilt second");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotsecond_tiltsecond, gantry2_startpos_rotsecond_tiltsecond);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotsecond_tiltsecond.first,
-                                      box0_startpos_rotsecond_tiltsecond.second,
-                                      box1_startpos_rotsecond_tiltsecond.first,
-                                      box1_startpos_rotsecond_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_endpos_rotsecond_tiltsecond, gantry2_startpos_rotsecond_tiltsecond);
-    pathCalc01.InitialiseOpticalBoxes(box0_endpos_rotsecond_tiltsecond.first, box0_endpos_rotsecond_tiltsecond.second,
-                                      box1_startpos_rotsecond_tiltsecond.first,
-                                      box1_startpos_rotsecond_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 1 move first, rotation second, tilt second");
+    path1 = xyChecks[XY_6A].Path;
+    path2 = xyChecks[XY_6B].Path;
   } else if (goodPath7a && goodPath7b && goodRotation_rotfirst_tiltsecond && goodTilt_rotfirst_tiltsecond &&
              goodRotationTilt_endcheck_tiltsecond) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation first, tilt second");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotfirst_tiltsecond, gantry2_endpos_rotfirst_tiltsecond);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotfirst_tiltsecond.first, box0_startpos_rotfirst_tiltsecond.second,
-                                      box1_startpos_rotfirst_tiltsecond.first, box1_startpos_rotfirst_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_startpos_rotfirst_tiltsecond, gantry2_startpos_rotfirst_tiltsecond);
-    pathCalc01.InitialiseOpticalBoxes(box0_startpos_rotfirst_tiltsecond.first, box0_startpos_rotfirst_tiltsecond.second,
-                                      box1_endpos_rotfirst_tiltsecond.first, box1_endpos_rotfirst_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation first, tilt second");
+    path1 = xyChecks[XY_7B].Path;
+    path2 = xyChecks[XY_7A].Path;
     // Check first whether we are not crossing a beam in a way that gantry1 had to move first
     if (pInfo->Destination[5] + 0.05 <= gantry1XPos) {  // closest possible
-      cm_msg(MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
+      PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
       return GENPATH_BAD_DEST;
     }
     move_rotation_first = true;
     move_second_gantry_first = true;
   } else if (goodPath8a && goodPath8b && goodRotationTilt_rotsecond_tiltsecond &&
              goodRotationTilt_endcheck_tiltsecond) {
-    cm_msg(MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation second, tilt second");
-    pathCalc00.InitialiseGantries(gantry1_startpos_rotsecond_tiltsecond, gantry2_endpos_rotsecond_tiltsecond);
-    pathCalc00.InitialiseOpticalBoxes(box0_startpos_rotsecond_tiltsecond.first,
-                                      box0_startpos_rotsecond_tiltsecond.second,
-                                      box1_startpos_rotsecond_tiltsecond.first,
-                                      box1_startpos_rotsecond_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath00 = pathCalc00.CalculatePath(xy_start1, xy_end1, path1, start_tank, end_tank);
-    pathCalc01.InitialiseGantries(gantry1_startpos_rotsecond_tiltsecond, gantry2_startpos_rotsecond_tiltsecond);
-    pathCalc01.InitialiseOpticalBoxes(box0_startpos_rotsecond_tiltsecond.first,
-                                      box0_startpos_rotsecond_tiltsecond.second,
-                                      box1_endpos_rotsecond_tiltsecond.first, box1_endpos_rotsecond_tiltsecond.second,
-                                      opticalBox0_lo_Z[1], opticalBox0_up_Z[1], opticalBox1_lo_Z[1],
-                                      opticalBox1_up_Z[1]);
-    goodPath01 = pathCalc01.CalculatePath(xy_start2, xy_end2, path2, start_tank, end_tank);
+    PLAN_MSG(pInfo, MINFO, "generate_path", "Good path identified: Gantry 2 move first, rotation second, tilt second");
+    path1 = xyChecks[XY_8B].Path;
+    path2 = xyChecks[XY_8A].Path;
     // Check first whether we are not crossing a beam in a way that gantry1 had to move first
     if (pInfo->Destination[5] + 0.05 <= gantry1XPos) {  // closest possible
-      cm_msg(MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
+      PLAN_MSG(pInfo, MERROR, "generate_path", "Illegal value for X destination gantry2: will collide against beam gantry 1.");
       return GENPATH_BAD_DEST;
     }
     move_second_gantry_first = true;
   } else {
-    cm_msg(MERROR, "generate_path", "No good path available");
+    PLAN_MSG(pInfo, MERROR, "generate_path", "No good path available");
     return GENPATH_BAD_DEST;
   }
 
   //Initialize path to current position
+  //Why: +3: optional zfirst, then zlast, theta, phi is last move and very first one is initial pos.
+  alloc_move_path(pInfo, path1.size() + path2.size() + 3);
   for (int i = 0; i < 10; i++) {
-    //Why: +3: optional zfirst, then zlast, theta, phi is last move and very first one is initial pos.
-    pInfo->MovePath[i] = (float *) calloc(path1.size() + path2.size() + 3, sizeof(float));
     for (unsigned int j = 0; j < path1.size() + path2.size() + 3; ++j) {
       pInfo->MovePath[i][j] = pInfo->CountPos[i];
     }
@@ -2195,20 +2602,238 @@ int generate_path(INFO *pInfo) {
 
   for (unsigned int i = 0; i < path1.size() + path2.size() + 3; ++i) {
     for (int j = gantry_motor_start; j < gantry_motor_end; j++) {
-      cm_msg(MDEBUG, "generate_path", "Destination[%i][%i] = %6.3f (Count Destination = %6.0f, Remaining =  %6.0f)", j,
-             i, pInfo->Destination[j], pInfo->MovePath[j][i], pInfo->MovePath[j][i] - pInfo->CountPos[j]);
+      PLAN_MSG(pInfo, MDEBUG, "generate_path", "Destination[%i][%i] = %6.3f (Count Destination = %6.0f, Remaining =  %6.0f)", j,
+                      i, pInfo->Destination[j], pInfo->MovePath[j][i], pInfo->MovePath[j][i] - pInfo->CountPos[j]);
     }
   }
 
   pInfo->PathSize = path1.size() + path2.size() + 3;
   pInfo->PathIndex = 0;
 
+  compact_path(pInfo);
+
+  if (pathCache && pInfo->PathSize <= PATH_CACHE_MAX_WAYPOINTS) {
+    float planned[PATH_CACHE_MAX_WAYPOINTS][10];
+    for (int j = 0; j < pInfo->PathSize; j++) {
+      for (int i = 0; i < 10; i++) planned[j][i] = pInfo->MovePath[i][j] - pInfo->mOrigin[i];
+    }
+    store_cached_path(pathCache, sceneHash, pathCacheQuantum, cacheStart, cacheDest, planned, pInfo->PathSize);
+  }
+
   return GENPATH_SUCCESS;
 }
 
+// Makes room for a path of size waypoints, replacing the last one
+void alloc_move_path(INFO *pInfo, int size) {
+  for (int i = 0; i < 10; i++) {
+    free(pInfo->MovePath[i]);
+    pInfo->MovePath[i] = (float *) calloc(size, sizeof(float));
+  }
+}
+
+/*-- Prefetch ------------------------------------------------------*/
+// feScan wrote the destinations of the next moves: hand them to prefetch_thread
+void upcoming_destinations(HNDLE hDB, HNDLE hKey, void *data) {
+  pthread_mutex_lock(&prefetch.Mutex);
+  memcpy(prefetch.Points, upcomingDestinations, sizeof(prefetch.Points));
+  prefetch.Version++;
+  pthread_cond_signal(&prefetch.Changed);
+  pthread_mutex_unlock(&prefetch.Mutex);
+}
+
+// Plans the moves between the upcoming destinations while the gantries move, so that the paths are in the
+// path cache by the time feScan starts the moves. Starts again from the top whenever a new list comes.
+void *prefetch_thread(void *data) {
+  INFO *pInfo = (INFO *) data;
+  float points[UPCOMING_DESTINATIONS][10];
+  DWORD version = 0;
+
+  pthread_mutex_lock(&prefetch.Mutex);
+  for (;;) {
+    while (prefetch.Version == version) pthread_cond_wait(&prefetch.Changed, &prefetch.Mutex);
+    version = prefetch.Version;
+    memcpy(points, prefetch.Points, sizeof(points));
+    pthread_mutex_unlock(&prefetch.Mutex);
+
+    for (int k = 1; k < UPCOMING_DESTINATIONS && points[k][0] > -999; k++) {
+      if (*(volatile DWORD *) &prefetch.Version != version) break;
+      if (!prefetch_path(pInfo, points[k - 1], points[k])) break;
+    }
+
+    pthread_mutex_lock(&prefetch.Mutex);
+  }
+  return NULL;
+}
+
+// Plans the move from one destination to the next, as if the gantries were at the first one, into the cache.
+// generate_path finds it there if it was planned before.
+// Returns FALSE if the gantries are not initialized, as the origins are needed to get from positions to counts.
+BOOL prefetch_path(INFO *pInfo, const float *from, const float *to) {
+  float position[10], destination[10], countPos[10], origin[10];
+  float *movePath[10] = {NULL};
+
+  // initialize rewrites the origins while Initialized is 0; take a copy under the planner lock
+  pthread_mutex_lock(&plannerMutex);
+  if (!pInfo->Initialized) {
+    pthread_mutex_unlock(&plannerMutex);
+    return FALSE;
+  }
+  memcpy(origin, pInfo->mOrigin, sizeof(origin));
+
+  for (int i = 0; i < 10; i++) {
+    position[i] = from[i];
+    destination[i] = to[i];
+    countPos[i] = round((from[i] - pInfo->LimPos[i]) * pInfo->mScale[i] + origin[i]);
+  }
+
+  // Only what generate_path uses; the settings are shared, they only change when initializing
+  INFO plan;
+  memset(&plan, 0, sizeof(plan));
+  plan.Prefetch = TRUE;
+  plan.Position = position;
+  plan.Destination = destination;
+  plan.CountPos = countPos;
+  plan.MovePath = movePath;
+  plan.Channels = pInfo->Channels;
+  plan.LimPos = pInfo->LimPos;
+  plan.mScale = pInfo->mScale;
+  plan.mOrigin = origin;
+
+  generate_path(&plan);
+  pthread_mutex_unlock(&plannerMutex);
+
+  for (int i = 0; i < 10; i++) free(movePath[i]);
+  return TRUE;
+}
+
+// Hash of everything besides the start and destination that the paths of generate_path depend on
+uint32_t path_scene_hash(INFO *pInfo, const COLLISION_SETTINGS &settings) {
+  const double dimensions[] = {tiltMotorLength, gantryFrontHalfLength, gantryBackHalfLength, gantryOpticalBoxWidth,
+                               gantryTiltGearWidth, gantryOpticalBoxHeight, pmtLayerHeight};
+  const int motors[] = {gantry_motor_start, gantry_motor_end};
+  uint32_t hash = path_cache_hash(&settings, sizeof(settings));
+  hash = path_cache_hash(dimensions, sizeof(dimensions), hash);
+  hash = path_cache_hash(pInfo->LimPos, 10 * sizeof(float), hash);
+  hash = path_cache_hash(pInfo->mScale, 10 * sizeof(float), hash);
+  hash = path_cache_hash(motors, sizeof(motors), hash);
+  return path_cache_hash(&pathCacheQuantum, sizeof(pathCacheQuantum), hash);
+}
+
+
+/*-- Compact path --------------------------------------------------*/
+// Every waypoint costs a full stop of the motors, a round trip through the motor frontend and a restart.
+// Waypoints that do not move any axis are dropped, and runs of waypoints that move one and the same axis
+// in the same direction are merged into a single move: the motors go exactly the same way, just without
+// stopping. All other waypoints are kept as they are, since the order of the moves is what avoids collisions.
+void compact_path(INFO *pInfo) {
+
+  int kept = 0;          // waypoints kept so far, at the start of MovePath
+  int lastAxis = -1;     // the only axis moved by the last waypoint kept, -1 if it moved several
+  int lastDirection = 0;
+
+  for (int k = 0; k < pInfo->PathSize; k++) {
+    // Compare with the last waypoint kept, or with where the motors are for the first one
+    int moved = 0, axis = -1, direction = 0;
+    for (int i = gantry_motor_start; i < gantry_motor_end; i++) {
+      float from = kept > 0 ? pInfo->MovePath[i][kept - 1] : pInfo->CountPos[i];
+      if (pInfo->MovePath[i][k] != from) {
+        moved++;
+        axis = i;
+        direction = pInfo->MovePath[i][k] > from ? 1 : -1;
+      }
+    }
+
+    if (moved == 0) continue;
+
+    int to = kept;
+    if (moved == 1 && axis == lastAxis && direction == lastDirection) {
+      to = kept - 1; // goes on along the same axis: the last waypoint kept goes all the way instead
+    } else {
+      kept++;
+      lastAxis = moved == 1 ? axis : -1;
+      lastDirection = direction;
+    }
+    for (int i = 0; i < 10; i++) pInfo->MovePath[i][to] = pInfo->MovePath[i][k];
+  }
+
+  // Nothing to move: keep the last waypoint, so the move still completes through monitor()
+  if (kept == 0) {
+    for (int i = 0; i < 10; i++) pInfo->MovePath[i][0] = pInfo->MovePath[i][pInfo->PathSize - 1];
+    kept = 1;
+  }
+
+  if (kept < pInfo->PathSize) {
+    PLAN_MSG(pInfo, MDEBUG, "compact_path", "Path compacted from %i to %i waypoints", pInfo->PathSize, kept);
+  }
+  pInfo->PathSize = kept;
+
+}
+
+
+/*-- Move timing ---------------------------------------------------*/
+// Starts timing the waypoint move() is sending the motors to
+void start_waypoint_timing(INFO *pInfo) {
+  memset(&moveTiming.Current, 0, sizeof(moveTiming.Current));
+  moveTiming.Current.Move = moveTiming.Move;
+  moveTiming.Current.Waypoint = pInfo->PathIndex;
+  moveTiming.Current.PlanningStart = moveTiming.PlanningStart;
+  moveTiming.Current.PlanningEnd = moveTiming.PlanningEnd;
+}
+
+// Called by monitor when the waypoint is over, verified or not: queues it for the MTIM bank, adds it to the
+// histograms and to the totals of the move
+void record_waypoint_timing(INFO *pInfo) {
+  WAYPOINT_TIMING &w = moveTiming.Current;
+  if (!w.Move) return; // the motors were not moved by move() (e.g. initialize), or already recorded
+
+  if (moveTiming.NumQueued == TIMING_QUEUE_SIZE) {
+    moveTiming.QueueStart = (moveTiming.QueueStart + 1) % TIMING_QUEUE_SIZE;
+    moveTiming.NumQueued--;
+  }
+  moveTiming.Queue[(moveTiming.QueueStart + moveTiming.NumQueued) % TIMING_QUEUE_SIZE] = w;
+  moveTiming.NumQueued++;
+
+  // A waypoint that needed no move, or could not start at a limit switch, has no motion to time
+  if (w.CommandSent && w.MotionDetected) {
+    add_timing(TIMING_START, w.CommandSent, w.MotionDetected);
+    add_timing(TIMING_MOTION, w.MotionDetected, w.MotionStopped);
+  }
+  if (w.CommandSent) moveTiming.Totals.Motion += w.MotionStopped - w.CommandSent;
+  if (w.Verified) {
+    add_timing(TIMING_SETTLE, w.MotionStopped, w.Verified);
+    moveTiming.Totals.Settle += w.Verified - w.MotionStopped;
+  }
+  write_timing_histograms(pInfo->hDB);
+
+  w.Move = 0;
+}
+
+// Adds the duration from..to to the histogram of a stage, forgetting the oldest one it holds if it is full
+void add_timing(int stage, DWORD from, DWORD to) {
+  TIMING_HISTOGRAM &h = moveTiming.Histograms[stage];
+
+  int bin = 0;
+  for (DWORD ms = to - from; ms > 0 && bin < NUM_TIMING_BINS - 1; ms >>= 1) bin++;
+
+  if (h.Size == TIMING_HISTORY) h.Counts[(int) h.Recent[h.Next]]--;
+  else h.Size++;
+  h.Recent[h.Next] = bin;
+  h.Next = (h.Next + 1) % TIMING_HISTORY;
+  h.Counts[bin]++;
+}
+
+void write_timing_histograms(HNDLE hDB) {
+  char name[64];
+  for (int i = 0; i < NUM_TIMING_STAGES; i++) {
+    snprintf(name, sizeof(name), "/Equipment/Move/Timing/%s", timingStageNames[i]);
+    db_set_value(hDB, 0, name, moveTiming.Histograms[i].Counts, sizeof(moveTiming.Histograms[i].Counts),
+                 NUM_TIMING_BINS, TID_INT);
+  }
+}
+
 
 /*-- Move ----------------------------------------------------------*/
-// Use channel_rw to send the subsequent path index to the motors
+// Use write_motor_channels to send the subsequent path index to the motors
 void move(INFO *pInfo) {
   int i;
   BOOL zerotest = 0;
@@ -2231,21 +2856,14 @@ void move(INFO *pInfo) {
   DWORD start_of_loop;
   int size_phidget = sizeof(pInfo->Phidget);
 
-  //DEBUG
-  printf("Moving to path index: %i\n", pInfo->PathIndex);
+  start_waypoint_timing(pInfo);
 
   // Read in axis positions (in counts)
-  channel_rw(pInfo, pInfo->hKeyMPos, (void *) pInfo->CountPos, TID_FLOAT, 0);
+  read_motor_channels(pInfo, pInfo->hKeyMPos, pInfo->CountPos, TID_FLOAT);
 
   // Determine required destinations to be sent to the motors
   for (i = gantry_motor_start; i < gantry_motor_end; i++) {
     pInfo->CountDest[i] = pInfo->MovePath[i][pInfo->PathIndex] - pInfo->CountPos[i];
-
-    //DEBUG
-    printf("MD[%i]=%6.0f(%6.0f) ", i, pInfo->CountDest[i], pInfo->CountPos[i]);
-    if (i == 4 || i == 9) {
-      printf("\n");
-    }
     zerotest = zerotest || pInfo->CountDest[i];
   }
 
@@ -2262,7 +2880,7 @@ void move(INFO *pInfo) {
 
   // Start motors towards the specified destinations
   // Write motor destinations to the ODB
-  channel_rw(pInfo, pInfo->hKeyMDest, (void *) pInfo->CountDest, TID_FLOAT, 1);
+  write_motor_channels(pInfo, pInfo->hKeyMDest, pInfo->CountDest, TID_FLOAT);
 
   // Get the current location of the motor. This will be used to tell if a motor has started moving yet
   db_get_data(pInfo->hDB, pInfo->hKeyMPos[0], &Motor00StartPos, &size_float, TID_FLOAT);
@@ -2276,12 +2894,11 @@ void move(INFO *pInfo) {
 // Don't do anything else until the motors have started moving
   while (!started_moving) {
     start_of_loop = ss_millitime();
-    // DEBUG
-    printf("\nChannel_rw called at time : %lf\n", ss_millitime());
     // Set the ODB values to start a move
 
-    channel_rw(pInfo, pInfo->hKeyMStart, (void *) start, TID_BOOL, 1);
-    sleep(100);
+    if (!moveTiming.Current.CommandSent) moveTiming.Current.CommandSent = ss_millitime();
+    write_motor_channels(pInfo, pInfo->hKeyMStart, start, TID_BOOL);
+    ss_sleep(100);
 
     waiting = 1;
     while (waiting) {
@@ -2306,6 +2923,7 @@ void move(INFO *pInfo) {
                Motor00Pos[5] != Motor00StartPos[5]
                || Motor00Pos[6] != Motor00StartPos[6] || Motor00Pos[7] != Motor00StartPos[7]) {
         cm_msg(MINFO, "move", " Motors gantry 0 are Moving ");
+        moveTiming.Current.MotionDetected = ss_millitime();
         waiting = 0;
         started_moving = 1;
         pInfo->Moving = 1;   //not necessary for long moves, but for mm moves, move can stop before monitor can check whether it's moving, so need to set here that is was really moving
@@ -2317,6 +2935,7 @@ void move(INFO *pInfo) {
                Motor01Pos[5] != Motor01StartPos[5]
                || Motor01Pos[6] != Motor01StartPos[6] || Motor01Pos[7] != Motor01StartPos[7]) {
         cm_msg(MINFO, "move", " Motors gantry 1 are Moving ");
+        moveTiming.Current.MotionDetected = ss_millitime();
         waiting = 0;
         started_moving = 1;
         pInfo->Moving = 1;   //not necessary for long moves, but for mm moves, move can stop before monitor can check whether it's moving, so need to set here that is was really moving
@@ -2364,7 +2983,7 @@ void move(INFO *pInfo) {
         // If 5 seconds has passed and the motors haven't started moving reset the ODB values
         // that should initiate a move with the hope that a move will start.
       else if (ss_millitime() - start_of_loop > 1000 * 5) {
-        cm_msg(MINFO, "move", "Calling channel_rw again after past 5s");
+        cm_msg(MINFO, "move", "Starting the motors again after past 5s");
         waiting = 0;
       }
     }
@@ -2378,7 +2997,7 @@ void stop_move(HNDLE hDB, HNDLE hKey, void *data) {
   INFO *pInfo = (INFO *) data;
 
   BOOL stop[10] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-  channel_rw(pInfo, pInfo->hKeyMStop, (void *) stop, TID_BOOL, 1);
+  write_motor_channels(pInfo, pInfo->hKeyMStop, stop, TID_BOOL);
 
   switch (pInfo->AbortCode) {
     case AC_USER_INPUT:
@@ -2405,10 +3024,15 @@ void monitor(HNDLE hDB, HNDLE hKey, void *data) {
   int i = 0;
 
   /*-- Update variables section of ODB -----------------------------*/
+  // Only the variables that changed are written
+
+  MOTOR_STATE state;
+  read_motor_state(pInfo, &state);
 
   // Copy variable indicating if each axis is moving, and write this to ODB
-  channel_rw(pInfo, pInfo->hKeyMMoving, (void *) pInfo->AxisMoving, TID_BOOL, 0);
-  db_set_data(pInfo->hDB, pInfo->hKeyAxMoving, pInfo->AxisMoving, 10 * sizeof(float), 10, TID_BOOL);
+  memcpy(pInfo->AxisMoving, state.Moving, sizeof(state.Moving));
+  set_variable(pInfo->hDB, pInfo->hKeyAxMoving, pInfo->AxisMoving, pInfo->PublishedAxisMoving, 10 * sizeof(BOOL), 10,
+               TID_BOOL);
 
   // Check if any of the axes are moving, and write this to ODB
   pInfo->Moving = 0;
@@ -2416,26 +3040,32 @@ void monitor(HNDLE hDB, HNDLE hKey, void *data) {
     pInfo->Moving = pInfo->Moving || pInfo->AxisMoving[i];
     i++;
   }
-  db_set_data(pInfo->hDB, pInfo->hKeyMoving, &pInfo->Moving, sizeof(BOOL), 1, TID_BOOL);
+  set_variable(pInfo->hDB, pInfo->hKeyMoving, &pInfo->Moving, &pInfo->PublishedMoving, sizeof(BOOL), 1, TID_BOOL);
 
 
   // Get the axis positions and write to ODB
-  channel_rw(pInfo, pInfo->hKeyMPos, (void *) pInfo->CountPos, TID_FLOAT, 0);
+  memcpy(pInfo->CountPos, state.Position, sizeof(state.Position));
   for (i = gantry_motor_start; i < gantry_motor_end; i++) {
     pInfo->Position[i] = (pInfo->CountPos[i] - pInfo->mOrigin[i]) / pInfo->mScale[i] + pInfo->LimPos[i];
   }
-  db_set_data(pInfo->hDB, pInfo->hKeyPos, pInfo->Position, 10 * sizeof(float), 10, TID_FLOAT);
+  set_variable(pInfo->hDB, pInfo->hKeyPos, pInfo->Position, pInfo->PublishedPosition, 10 * sizeof(float), 10,
+               TID_FLOAT);
 
   // Check for limit switches triggered and write to ODB
-  channel_rw(pInfo, pInfo->hKeyMLimitNeg, (void *) pInfo->neg_AxisLimit, TID_BOOL, 0);
-  channel_rw(pInfo, pInfo->hKeyMLimitPos, (void *) pInfo->pos_AxisLimit, TID_BOOL, 0);
-  db_set_data(pInfo->hDB, pInfo->hKeyAxLimitNeg, pInfo->neg_AxisLimit, 10 * sizeof(BOOL), 10, TID_BOOL);
-  db_set_data(pInfo->hDB, pInfo->hKeyAxLimitPos, pInfo->pos_AxisLimit, 10 * sizeof(BOOL), 10, TID_BOOL);
+  memcpy(pInfo->neg_AxisLimit, state.LimitNeg, sizeof(state.LimitNeg));
+  memcpy(pInfo->pos_AxisLimit, state.LimitPos, sizeof(state.LimitPos));
+  set_variable(pInfo->hDB, pInfo->hKeyAxLimitNeg, pInfo->neg_AxisLimit, pInfo->PublishedLimitNeg, 10 * sizeof(BOOL),
+               10, TID_BOOL);
+  set_variable(pInfo->hDB, pInfo->hKeyAxLimitPos, pInfo->pos_AxisLimit, pInfo->PublishedLimitPos, 10 * sizeof(BOOL),
+               10, TID_BOOL);
 
 
   /* - If motors have stopped moving, determine next course of action */
   bool stoppedDueToLimit = false;
   if (OldMov && !pInfo->Moving) { // i.e. If the motors just stopped moving
+    moveTiming.Current.MotionStopped = ss_millitime();
+    // Where the motors stopped, for the next start of feMove
+    save_origins(pInfo);
     // Check if the destination has been reached, otherwise return an error
     for (i = gantry_motor_start; i < gantry_motor_end; i++) {
       if ((pInfo->Channels[i] != -1) && (pInfo->MovePath[i][pInfo->PathIndex] != pInfo->CountPos[i])) {
@@ -2464,6 +3094,7 @@ void monitor(HNDLE hDB, HNDLE hKey, void *data) {
             if (!stoppedDueToLimit) {
               cm_msg(MERROR, "monitor", "Move failed at i=%d, pathindex=%d : %6.2f, %6.2f", i, pInfo->PathIndex,
                   pInfo->MovePath[i][pInfo->PathIndex], pInfo->CountPos[i]);
+              record_waypoint_timing(pInfo);
               return;
             }
           }
@@ -2471,20 +3102,20 @@ void monitor(HNDLE hDB, HNDLE hKey, void *data) {
       }
     }
 
-    printf("Move to index complete\n"); //DEBUG
-    printf("Time to complete Move to index %lf\n", ss_millitime()); //DEBUG
+    moveTiming.Current.Verified = ss_millitime();
+    record_waypoint_timing(pInfo);
+
     // Check if we are at the final path index, otherwise initiate next move
     if (pInfo->PathIndex + 1 == pInfo->PathSize) {
       // Final destination reached
       pInfo->Completed = 1;
       db_set_data(hDB, pInfo->hKeyCompleted, &pInfo->Completed, sizeof(BOOL), 1, TID_BOOL);
+      post_move_completion(moveCompletion, pInfo->Completed, pInfo->BadDest, pInfo->Position, &moveTiming.Totals);
       cm_msg(MINFO, "monitor", "Move to destination complete");
       if (stoppedDueToLimit)
         cm_msg(MINFO, "monitor", "But destination not reached due to limit switch");
     } else {
       pInfo->PathIndex++;
-      // DEBUG
-      printf("Monitor called move() at : %lf\n", ss_millitime());
       move(pInfo);
     }
   }
@@ -2500,108 +3131,224 @@ void monitor(HNDLE hDB, HNDLE hKey, void *data) {
 
 
 
-/*-- Channel Read/Write --------------------------------------------*/
-// Used to communicate with the variables in the motor frontend.
+/*-- Motor channels ------------------------------------------------*/
+// Used to communicate with the variables in the motor frontend. Each call reads or writes one variable
+// of both motor equipments, with one ODB access per equipment and the handles found in frontend_init.
 // Arguments:
 // 		pInfo: Info structure
-//		hKey: Pointer to the ODB handle array to be read from/written to
-//		values: Pointer to the array from which to read/write data
-//		type: Type ID of the variable to be written (TID_FLOAT, TID_BOOL, TID_INT)
-//		rw: set to 0 for read from ODB, 1 for write to ODB
-void channel_rw(INFO *pInfo, HNDLE *hKey, void *values, DWORD type, BOOL rw) {
-
-//!!!!The Below comment is meant to help expalin how this function works as it uses "function-like" macros which people may not be famillar with. 
-
-/*
-//STORE_DATA and READ_DATA are "function-like" macros using the #define preprocessor macro (See lines 60 and 76) #define performs textual replacement. When used as a function-like macro #define will take arguments like a function. 
-//EXAMPLE:: STORE_DATA(float, values, size) is a function-like macro. The preproccesor will replace the line STORE_DATA(float); with the lines of code listed after the #define (see line 76) and everywhere that the text "TYPE" appears in those lines of code will be replaced with the text float. END EXAMPLE
-//The "function-like" are used to reduce the number of lines of code and to improve the readibility of the code. It is used to accomplish what templete functions do in C++
-//NOTE!!:: Use of template functions can be difficult when debugging this section as the code you see is not what the compiler sees. The compiler sees the code after the preproccesor has completed the text replacement. If debugging this section it may be wise to not use the macro and instead do the textual replacement yourself and then debug. Comment by Ben Krupicz  
-*/
-
-  int size;
-  int buff_size;
-  void *motor00_values;
-  void *motor01_values;
-
-
-  switch (type) {
-    case TID_FLOAT:
-      // STORE_DATA(TYPE) determines the correct value for the size value and fills  motor00_values and motor01_values with the entries in the values variable
-    STORE_DATA(float);
-      break;
-    case TID_BOOL: STORE_DATA(BOOL);
-      break;
-    case TID_INT: STORE_DATA(int)
-      break;
+//		hKey: the handles of the variable for Motors00 and Motors01
+//		values: the 10 values, in axis order (see axisChannel)
+//		type: Type ID of the variable (TID_FLOAT, TID_BOOL, TID_INT), which has to match T
+
+// Reads the variable into values
+template<typename T>
+void read_motor_channels(INFO *pInfo, const HNDLE *hKey, T *values, DWORD type) {
+  T channels[2][NUM_MOTOR_CHANNELS];
+  for (int m = 0; m < 2; m++) {
+    int size = sizeof(channels[m]);
+    db_get_data(pInfo->hDB, hKey[m], channels[m], &size, type);
+  }
+  for (int i = 0; i < 10; i++) values[i] = channels[axisMotor[i]][axisChannel[i]];
+}
+
+// Writes values to the variable, and 0 to the channels that are not used
+template<typename T>
+void write_motor_channels(INFO *pInfo, const HNDLE *hKey, const T *values, DWORD type) {
+  T channels[2][NUM_MOTOR_CHANNELS];
+  memset(channels, 0, sizeof(channels));
+  for (int i = 0; i < 10; i++) channels[axisMotor[i]][axisChannel[i]] = values[i];
+  for (int m = 0; m < 2; m++) {
+    db_set_data(pInfo->hDB, hKey[m], channels[m], sizeof(channels[m]), NUM_MOTOR_CHANNELS, type);
+  }
+}
+
+// Reads everything monitor needs to know about the motors
+void read_motor_state(INFO *pInfo, MOTOR_STATE *state) {
+  read_motor_channels(pInfo, pInfo->hKeyMMoving, state->Moving, TID_BOOL);
+  read_motor_channels(pInfo, pInfo->hKeyMPos, state->Position, TID_FLOAT);
+  read_motor_channels(pInfo, pInfo->hKeyMLimitNeg, state->LimitNeg, TID_BOOL);
+  read_motor_channels(pInfo, pInfo->hKeyMLimitPos, state->LimitPos, TID_BOOL);
+}
+
+// Writes one of the "Variables" if it differs from what was written last time (kept in published).
+// monitor runs with every update of the motors, and mostly nothing but the position of a moving axis changes.
+void set_variable(HNDLE hDB, HNDLE hKey, const void *values, void *published, INT size, INT num, DWORD type) {
+  if (memcmp(values, published, size) == 0) return;
+  db_set_data(hDB, hKey, values, size, num, type);
+  memcpy(published, values, size);
+}
+
+//-------Collision scene----------------------------------------//
+// See COLLISION_SCENE at the top of the file and COLLISION_SETTINGS in CollisionSettings.hxx.
+
+// Reads Settings/Collision, creating any missing keys with the defaults at the top of the file.
+// Only for frontend_init, see reload_collision_scene.
+void get_collision_settings(HNDLE hDB, COLLISION_SETTINGS *settings) {
+  settings->TankCentre[0] = xtankCentre;
+  settings->TankCentre[1] = ytankCentre;
+  settings->TankRadius = tankRadius;
+  settings->TankPMTholderRadius = tankPMTholderRadius;
+  settings->PMTCentre0[0] = pmtXcentre0;
+  settings->PMTCentre0[1] = pmtYcentre0;
+  settings->PMTCentre1[0] = pmtXcentre1;
+  settings->PMTCentre1[1] = pmtYcentre1;
+  settings->PMTRadius = pmtRadius;
+  settings->PMTHeight = pmtHeight;
+  settings->FRPHeight = frpHeight;
+  settings->FRPRadius = frpRadius;
+
+  read_collision_settings(hDB, settings);
+}
+
+// Returns the SCENE_* flags for the parts of the scene that differ
+int collision_scene_changes(const COLLISION_SETTINGS &l, const COLLISION_SETTINGS &r) {
+  int changes = 0;
+  if (l.TankCentre[0] != r.TankCentre[0] || l.TankCentre[1] != r.TankCentre[1] ||
+      l.TankRadius != r.TankRadius || l.TankPMTholderRadius != r.TankPMTholderRadius) {
+    changes |= SCENE_TANK;
   }
+  if (l.PMTRadius != r.PMTRadius || l.PMTHeight != r.PMTHeight ||
+      l.FRPHeight != r.FRPHeight || l.FRPRadius != r.FRPRadius) {
+    changes |= SCENE_PMT_SHAPE | SCENE_PMT0 | SCENE_PMT1;
+  }
+  if (l.PMTCentre0[0] != r.PMTCentre0[0] || l.PMTCentre0[1] != r.PMTCentre0[1]) changes |= SCENE_PMT0;
+  if (l.PMTCentre1[0] != r.PMTCentre1[0] || l.PMTCentre1[1] != r.PMTCentre1[1]) changes |= SCENE_PMT1;
+  return changes;
+}
 
-  if (rw == 0) {
-    db_get_data(pInfo->hDB, hKey[0], motor00_values, &buff_size, type);
-    db_get_data(pInfo->hDB, hKey[1], motor01_values, &buff_size, type);
+// Builds a scene from the settings, numbered after `previous`.
+std::shared_ptr<const COLLISION_SCENE> build_collision_scene(const COLLISION_SETTINGS &settings,
+                                                             const COLLISION_SCENE *previous) {
+  std::shared_ptr<COLLISION_SCENE> scene(new COLLISION_SCENE());
+  scene->Version = previous ? previous->Version + 1 : 1;
+  scene->Settings = settings;
+
+  // Both gantries see the same PMT, only its centre differs
+  scene->PMTLayerRadius.reserve(numPMTLayers);
+  for (int layer = 0; layer < numPMTLayers; ++layer) {
+    scene->PMTLayerRadius.push_back(pmt_layer_radius(settings, layer, pmtLayerHeight));
+  }
 
-    switch (type) {
-      case TID_FLOAT:
-        //READ_VALUES sortes the values from motor00_values and motor01_values in the values array
-      READ_VALUES(float);
-        break;
-      case TID_BOOL: READ_VALUES(BOOL);
-        break;
-      case TID_INT: READ_VALUES(int);
-        break;
+  return scene;
+}
+
+std::shared_ptr<const COLLISION_SCENE> current_collision_scene() {
+  pthread_mutex_lock(&collisionSceneMutex);
+  std::shared_ptr<const COLLISION_SCENE> scene = collisionScene;
+  pthread_mutex_unlock(&collisionSceneMutex);
+  return scene;
+}
+
+// Swaps in a new scene. Anyone still holding the old one keeps using it until they let go of it.
+void set_collision_scene(INFO *pInfo, const std::shared_ptr<const COLLISION_SCENE> &scene) {
+  pthread_mutex_lock(&collisionSceneMutex);
+  collisionScene = scene;
+  pthread_mutex_unlock(&collisionSceneMutex);
+
+  db_set_data(pInfo->hDB, pInfo->hKeySceneVersion, &scene->Version, sizeof(DWORD), 1, TID_DWORD);
+}
+
+// Loads the scene into the path calculators, only updating the parts that differ from the last scene loaded
+void apply_collision_scene(const std::shared_ptr<const COLLISION_SCENE> &scene) {
+  if (appliedScene && appliedScene->Version == scene->Version) return;
+
+  const COLLISION_SETTINGS &s = scene->Settings;
+  const int changes = appliedScene ? collision_scene_changes(appliedScene->Settings, s)
+                                   : (SCENE_TANK | SCENE_PMT_SHAPE | SCENE_PMT0 | SCENE_PMT1);
+  const XYPoint centre0(s.PMTCentre0[0], s.PMTCentre0[1]);
+  const XYPoint centre1(s.PMTCentre1[0], s.PMTCentre1[1]);
+
+  for (int i = 0; i < numPathCalcs; i++) {
+    if (changes & SCENE_TANK) {
+      pathCalcs[i]->InitialiseTank(s.TankCentre[0], s.TankCentre[1], s.TankRadius, s.TankPMTholderRadius);
     }
-  } else {
+    if (changes & SCENE_PMT0) pathCalcs[i]->InitialisePMT(0, centre0, scene->PMTLayerRadius);
+    if (changes & SCENE_PMT1) pathCalcs[i]->InitialisePMT(1, centre1, scene->PMTLayerRadius);
+  }
 
-    // Write data to ODB
-    db_set_data(pInfo->hDB, hKey[0], motor00_values, buff_size, 8, type);
-    db_set_data(pInfo->hDB, hKey[1], motor01_values, buff_size, 8, type);
+  for (int i = 0; i < NUM_ROT_TILT_CHECKS; i++) {
+    if (changes & SCENE_TANK) {
+      pathCalcs_rot_tilt[i]->InitialiseTank(s.TankCentre[0], s.TankCentre[1], s.TankRadius, s.TankPMTholderRadius);
+    }
+    if (changes & SCENE_PMT_SHAPE) {
+      pathCalcs_rot_tilt[i]->InitialisePMT(centre0, centre1, scene->PMTLayerRadius, s.PMTHeight, pmtLayerHeight);
+    } else {
+      if (changes & SCENE_PMT0) pathCalcs_rot_tilt[i]->InitialisePMT(0, centre0, scene->PMTLayerRadius);
+      if (changes & SCENE_PMT1) pathCalcs_rot_tilt[i]->InitialisePMT(1, centre1, scene->PMTLayerRadius);
+    }
+  }
+
+  appliedScene = scene;
+}
+
+// Hotlinked to /Equipment/Move/Settings/Collision. Only reads the settings: writing them here would call it again.
+// The keys are created once, by get_collision_settings in frontend_init.
+void reload_collision_scene(HNDLE hDB, HNDLE hKey, void *data) {
+  INFO *pInfo = (INFO *) data;
 
+  COLLISION_SETTINGS settings;
+  if (!load_collision_settings(hDB, &settings)) {
+    cm_msg(MERROR, "reload_collision_scene", "Keeping collision scene version %u",
+           current_collision_scene()->Version);
+    return;
   }
+
+  const std::shared_ptr<const COLLISION_SCENE> previous = current_collision_scene();
+  const int changes = collision_scene_changes(previous->Settings, settings);
+  if (!changes) return;
+
+  const std::shared_ptr<const COLLISION_SCENE> scene = build_collision_scene(settings, previous.get());
+  set_collision_scene(pInfo, scene);
+
+  cm_msg(MINFO, "reload_collision_scene", "Collision scene version %u:%s%s%s. Used from the next move.",
+         scene->Version,
+         (changes & SCENE_TANK) ? " tank changed" : "",
+         (changes & SCENE_PMT0) ? " PMT model 0 rebuilt" : "",
+         (changes & SCENE_PMT1) ? " PMT model 1 rebuilt" : "");
 }
 
-//-------getPMTpolygon-----------------------------------------//
-// Function used in move_init to initialise the PMT position for collision avoidance calculations
-// 
-// Parameters
-//     int polyNum: number to identify the polygon modeling the PMT cross-section at a specific z height;
-//                  1 == top-most PMT polygon
-//     int numPolySides: number of sides the polygon has; more sides = better approximation of circular x-section.
-//     double polyHeight: thickness of each polygon; thinner = better approximation of sphere.
-//
-// Author: Rika
-// Date: 17 March 2017
-// Modified: 27 April 2017 - included the FRP radius for collision avoidance with the FRP rim.
-
-void
-getPMTpolygon(XYPolygon &poly, double pmtRadius, int polyNum, double pmtXcentre, double pmtYcentre, int numPolySides,
-              double polyHeight) {
-  const double PI = 3.14159265358979323846;
-  double xFromCentre;
-  double yFromCentre;
-  double zFromCentre = pmtRadius - polyHeight * polyNum;
-  double radiusOfEnclosingCircle =
-      sqrt(pmtRadius * pmtRadius - zFromCentre * zFromCentre) / cos(PI / numPolySides) + 0.001;
-  // EnclosingCircle is the circle that encloses the polygon at the z-height,
-  // without the polygon intersecting the PMT cross-section
-  // Rika (23Mar2017): added 0.001m to round up.
-
-  // Rika (27April2017): added for collision avoidance with FRP rim.
-  if (zFromCentre <= (pmtHeight + pmtRadius) - frpHeight) {
-    // If the z height is below the rim on which the acrylic cover sits,
-    // make the polygon so that it encloses the rim (i.e. the optical box should never slide under the FRP).
-    radiusOfEnclosingCircle = frpRadius / cos(PI / numPolySides) + 0.001;
-  }
-
-  for (double theta = 0.0; theta < 2 * PI; theta += 2 * PI / numPolySides) {
-    xFromCentre = radiusOfEnclosingCircle * cos(theta);
-    yFromCentre = radiusOfEnclosingCircle * sin(theta);
-    poly.push_back(std::make_pair(xFromCentre + pmtXcentre, yFromCentre + pmtYcentre));
-    //cm_msg(MINFO, "generate_path", " PMT polygon points = %.3f %.3f", xFromCentre + pmtXcentre, yFromCentre + pmtYcentre);
-  }
-
-  // Insert last point to close the polygon
-  xFromCentre = radiusOfEnclosingCircle * cos(0.0);
-  yFromCentre = radiusOfEnclosingCircle * sin(0.0);
-  poly.push_back(std::make_pair(xFromCentre + pmtXcentre, yFromCentre + pmtYcentre));
+/*-- Path checks ---------------------------------------------------*/
+// generate_path runs its XY path and rotation/tilt checks on up to one thread per CPU.
+// Checks are handed out in order, so the ones for the preferred strategies are started first.
+
+void *path_check_thread(void *data) {
+  PATH_CHECKS *checks = (PATH_CHECKS *) data;
+
+  for (;;) {
+    int i = __sync_fetch_and_add(&checks->Next, 1);
+    if (i < checks->NumXY) {
+      XY_PATH_CHECK &check = checks->XY[i];
+      check.Good = check.Calc->CalculatePath(check.Start, check.End, check.Path, check.TankStart, check.TankEnd);
+    } else if (i < checks->NumXY + checks->NumRotTilt) {
+      ROT_TILT_CHECK &check = checks->RotTilt[i - checks->NumXY];
+      check.Good = check.Calc->CalculatePath(check.Pos0, check.Pos1, check.Rot0, check.Rot1, check.Tilt0, check.Tilt1,
+                                             check.Z0, check.Z1, check.TankStart, check.TankEnd);
+    } else {
+      break;
+    }
+  }
 
+  return NULL;
+}
+
+// Returns once every check is done. The calling thread takes part, and does everything itself if
+// no other thread can be started.
+void run_path_checks(PATH_CHECKS *checks) {
+  int numChecks = checks->NumXY + checks->NumRotTilt;
+  int numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (numThreads > numChecks) numThreads = numChecks;
+
+  checks->Next = 0;
+
+  std::vector<pthread_t> threads;
+  for (int i = 1; i < numThreads; i++) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, path_check_thread, checks) == 0) threads.push_back(thread);
+  }
+
+  path_check_thread(checks);
+
+  for (unsigned int i = 0; i < threads.size(); i++) {
+    pthread_join(threads[i], NULL);
+  }
 }
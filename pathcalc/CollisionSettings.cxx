@@ -0,0 +1,90 @@
+#include "CollisionSettings.hxx"
+#include <math.h>
+#include <algorithm>
+
+
+//----------------------------------------------------------
+void read_collision_settings(HNDLE hDB, COLLISION_SETTINGS *settings) {
+//----------------------------------------------------------
+
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/Tank Centre", settings->TankCentre, 2 * sizeof(double), 2,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/Tank Radius", &settings->TankRadius, sizeof(double), 1,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/Tank PMT Holder Radius", &settings->TankPMTholderRadius,
+                sizeof(double), 1, TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/PMT Centre 0", settings->PMTCentre0, 2 * sizeof(double), 2,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/PMT Centre 1", settings->PMTCentre1, 2 * sizeof(double), 2,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/PMT Radius", &settings->PMTRadius, sizeof(double), 1,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/PMT Height", &settings->PMTHeight, sizeof(double), 1,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/FRP Height", &settings->FRPHeight, sizeof(double), 1,
+                TID_DOUBLE);
+  db_merge_data(hDB, 0, COLLISION_SETTINGS_DIR "/FRP Radius", &settings->FRPRadius, sizeof(double), 1,
+                TID_DOUBLE);
+
+}
+
+// One key of Settings/Collision, without creating it
+//----------------------------------------------------------
+static BOOL get_collision_value(HNDLE hDB, const char *key, double *values, int num) {
+//----------------------------------------------------------
+
+  INT size = num * sizeof(double);
+  if (db_get_value(hDB, 0, key, values, &size, TID_DOUBLE, FALSE) == DB_SUCCESS) return TRUE;
+  cm_msg(MERROR, "load_collision_settings", "Cannot read %s", key);
+  return FALSE;
+
+}
+
+//----------------------------------------------------------
+BOOL load_collision_settings(HNDLE hDB, COLLISION_SETTINGS *settings) {
+//----------------------------------------------------------
+
+  return get_collision_value(hDB, COLLISION_SETTINGS_DIR "/Tank Centre", settings->TankCentre, 2) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/Tank Radius", &settings->TankRadius, 1) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/Tank PMT Holder Radius",
+                             &settings->TankPMTholderRadius, 1) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/PMT Centre 0", settings->PMTCentre0, 2) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/PMT Centre 1", settings->PMTCentre1, 2) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/PMT Radius", &settings->PMTRadius, 1) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/PMT Height", &settings->PMTHeight, 1) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/FRP Height", &settings->FRPHeight, 1) &&
+         get_collision_value(hDB, COLLISION_SETTINGS_DIR "/FRP Radius", &settings->FRPRadius, 1);
+
+}
+
+// Radius of the PMT model in a layer, used for collision avoidance calculations.
+// The PMT cross-section at any height is a circle, so the model is just its radius for each layer;
+// the path calculators check the optical boxes against these circles exactly.
+//
+// Parameters
+//     int layer: 0 == top-most layer, covering the first layerHeight below the top of the PMT.
+//     double layerHeight: thickness of each layer.
+//
+// Author: Rika
+// Date: 17 March 2017
+// Modified: 27 April 2017 - included the FRP radius for collision avoidance with the FRP rim.
+// Modified: replaced the polygon for each layer with its radius.
+//----------------------------------------------------------
+double pmt_layer_radius(const COLLISION_SETTINGS &settings, int layer, double layerHeight) {
+//----------------------------------------------------------
+
+  // The widest part of the layer is at its bottom, down to the equator of the PMT.
+  double zFromCentre = std::max(settings.PMTRadius - layerHeight * (layer + 1), 0.0);
+  // Rika (23Mar2017): added 0.001m to round up. Kept as clearance now that the circle is checked exactly.
+  double radius = sqrt(settings.PMTRadius * settings.PMTRadius - zFromCentre * zFromCentre) + 0.001;
+
+  // Rika (27April2017): added for collision avoidance with FRP rim.
+  if (zFromCentre <= (settings.PMTHeight + settings.PMTRadius) - settings.FRPHeight) {
+    // If the z height is below the rim on which the acrylic cover sits,
+    // make the layer so that it encloses the rim (i.e. the optical box should never slide under the FRP).
+    radius = settings.FRPRadius + 0.001;
+  }
+
+  return radius;
+
+}
@@ -0,0 +1,58 @@
+#ifndef CollisionSettings_H
+#define CollisionSettings_H
+
+#include "midas.h"
+
+/* Collision model shared by feMove, which checks every move with it, and feScan, which checks
+ * a whole scan with it before the run starts (see TScanValidator).
+ */
+
+// Gantry dimensions with buffer zones for collision avoidance (m); see feMove for the measured values
+#define GANTRY_TILT_MOTOR_LENGTH       0.160
+#define GANTRY_FRONT_HALF_LENGTH       0.140
+#define GANTRY_BACK_HALF_LENGTH        0.25
+#define GANTRY_OPTICAL_BOX_WIDTH       0.160
+#define GANTRY_TILT_GEAR_WIDTH         0.060
+#define GANTRY_OPTICAL_BOX_HEIGHT      0.095
+
+// Limits on a destination, in the units of the ODB positions (m, degrees)
+#define GANTRY_ROT_MIN   -100.0 // to avoid triggering the limit switch during a scan
+#define GANTRY_ROT_MAX    120.0
+#define GANTRY_TILT_MIN  -105.0
+#define GANTRY_TILT_MAX    15.0
+#define GANTRY_Z_MAX        0.535 // gantry positive z limit switch at z = 0.534m
+#define GANTRY_BEAM_GAP     0.05  // gantry 0 has to stay this far below gantry 1 in X, or the beams collide
+
+// Gantries higher than this (smaller z) are above the water tank (m). Actually 0.08 but play safe.
+#define TANK_HEIGHT 0.05
+
+// The PMT is modelled as a stack of layers of this thickness (m), down to this far below its top (m)
+#define PMT_LAYER_HEIGHT 0.01
+#define PMT_MODEL_DEPTH  0.38
+
+// Geometry of the tank and PMT, kept in /Equipment/Move/Settings/Collision
+typedef struct {
+  double TankCentre[2];       // x, y (m)
+  double TankRadius;          // (m)
+  double TankPMTholderRadius; // max/min from centre where the PMT holders sit (m)
+  double PMTCentre0[2];       // PMT x, y as seen by gantry 0 (m)
+  double PMTCentre1[2];       // PMT x, y as seen by gantry 1 (m)
+  double PMTRadius;           // (m)
+  double PMTHeight;           // z of the top of the PMT in gantry coordinates (m)
+  double FRPHeight;           // z of the FRP case rim (m)
+  double FRPRadius;           // radius of the FRP case rim (m)
+} COLLISION_SETTINGS;
+
+#define COLLISION_SETTINGS_DIR "/Equipment/Move/Settings/Collision"
+
+// Reads the settings from the ODB. Keys that are missing are created with the values settings holds on entry.
+void read_collision_settings(HNDLE hDB, COLLISION_SETTINGS *settings);
+
+// Reads the settings from the ODB without writing to it, e.g. from a hotlink on the settings.
+// Returns FALSE, with an error message, if a key is missing.
+BOOL load_collision_settings(HNDLE hDB, COLLISION_SETTINGS *settings);
+
+// Radius of the PMT model in the given layer, layer 0 being the top of the PMT
+double pmt_layer_radius(const COLLISION_SETTINGS &settings, int layer, double layerHeight);
+
+#endif
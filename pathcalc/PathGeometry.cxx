@@ -0,0 +1,75 @@
+#include "PathGeometry.hxx"
+#include <algorithm>
+
+
+// Andrew's monotone chain
+//----------------------------------------------------------
+void swept_hull(std::vector<XYPoint> &points, BoostPolygon *hull) {
+//----------------------------------------------------------
+
+  std::sort(points.begin(), points.end());
+
+  std::vector <BoostPoint> &ring = hull->outer();
+  ring.clear();
+
+  // lower chain left to right, then upper chain right to left; counter-clockwise, ending back on the first point
+  const int n = points.size();
+  std::vector<BoostPoint>::size_type lower = 1;
+  for (int k = 0; k < 2 * n - 1; ++k) {
+    const XYPoint &p = k < n ? points[k] : points[2 * n - 2 - k];
+    if (k == n) lower = ring.size();
+    while (ring.size() > lower) {
+      const BoostPoint &a = ring[ring.size() - 2];
+      const BoostPoint &b = ring[ring.size() - 1];
+      double cross = (b.x() - a.x()) * (p.second - a.y()) - (b.y() - a.y()) * (p.first - a.x());
+      if (cross > 0) break;
+      ring.pop_back();
+    }
+    ring.push_back(BoostPoint(p.first, p.second));
+  }
+
+  // BoostPolygon is clockwise and closed
+  std::reverse(ring.begin(), ring.end());
+
+}
+
+// The polygon is convex, so it reaches the circle if the centre is inside it (on the inner side of every edge)
+// or if any edge passes within the radius of the centre.
+//----------------------------------------------------------
+bool polygon_intersects_circle(const BoostPolygon &object, XYPoint centre, double radius) {
+//----------------------------------------------------------
+
+  const std::vector <BoostPoint> &ring = object.outer();
+  if (ring.empty()) return false;
+
+  const double radius2 = radius * radius;
+  bool inside = ring.size() > 3; // closed ring of at least a triangle
+
+  for (std::vector<BoostPoint>::size_type i = 0; i + 1 < ring.size(); ++i) {
+    double edgeX = ring[i + 1].x() - ring[i].x();
+    double edgeY = ring[i + 1].y() - ring[i].y();
+    double toCentreX = centre.first - ring[i].x();
+    double toCentreY = centre.second - ring[i].y();
+
+    // clockwise ring: the inside is on the right of every edge
+    if (edgeX * toCentreY - edgeY * toCentreX > 0) inside = false;
+
+    // closest point of the edge to the centre
+    double length2 = edgeX * edgeX + edgeY * edgeY;
+    double t = length2 > 0 ? (toCentreX * edgeX + toCentreY * edgeY) / length2 : 0;
+    t = std::min(1.0, std::max(0.0, t));
+    double dX = toCentreX - t * edgeX;
+    double dY = toCentreY - t * edgeY;
+    if (dX * dX + dY * dY <= radius2) return true;
+  }
+
+  // a single point
+  if (ring.size() == 1) {
+    double dX = centre.first - ring[0].x();
+    double dY = centre.second - ring[0].y();
+    return dX * dX + dY * dY <= radius2;
+  }
+
+  return inside;
+
+}
@@ -0,0 +1,25 @@
+#ifndef PathGeometry_H
+#define PathGeometry_H
+
+#include <vector>
+#include <boost/geometry/geometry.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+
+/* Polygon geometry shared by TPathCalculator and TRotationCalculator
+ */
+
+typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
+typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
+
+typedef std::pair<double, double> XYPoint;
+
+// Convex hull of the points (sorted in place), written into hull without reallocating its storage.
+// The hull is clockwise and closed, like the polygons of CreatePolygon.
+void swept_hull(std::vector<XYPoint> &points, BoostPolygon *hull);
+
+// Exact test of a convex polygon (clockwise & closed, as made by CreatePolygon or swept_hull) against a circle.
+// True if they touch or overlap.
+bool polygon_intersects_circle(const BoostPolygon &object, XYPoint centre, double radius);
+
+#endif
@@ -0,0 +1,255 @@
+#include "ScanPlan.hxx"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <algorithm>
+
+#include "midas.h" // for logging
+
+
+//----------------------------------------------------------
+uint32_t ScanPlanHash(const void *data, size_t length, uint32_t hash) {
+//----------------------------------------------------------
+
+  const unsigned char *bytes = (const unsigned char *) data;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+  return hash;
+
+}
+
+
+//----------------------------------------------------------
+bool ReadScanPlanHeader(const char *path, SCAN_PLAN_HEADER *header) {
+//----------------------------------------------------------
+
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  bool ok = fread(header, sizeof(*header), 1, file) == 1;
+  fclose(file);
+  return ok;
+
+}
+
+
+//----------------------------------------------------------
+ScanPoints::ScanPoints() : fPoints(NULL), fSize(0), fMap(NULL), fMapLength(0) {
+//----------------------------------------------------------
+
+}
+
+//----------------------------------------------------------
+ScanPoints::~ScanPoints() {
+//----------------------------------------------------------
+
+  Unmap();
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::clear() {
+//----------------------------------------------------------
+
+  Unmap();
+  fData.clear();
+  fPoints = NULL;
+  fSize = 0;
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::resize(size_t n) {
+//----------------------------------------------------------
+
+  Detach();
+  fData.resize(n * SCAN_POINT_WIDTH, 0.0);
+  fPoints = fData.empty() ? NULL : &fData[0];
+  fSize = n;
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::reserve(size_t n) {
+//----------------------------------------------------------
+
+  Detach();
+  fData.reserve(n * SCAN_POINT_WIDTH);
+  fPoints = fData.empty() ? NULL : &fData[0];
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::push_back(const std::vector<double> &point) {
+//----------------------------------------------------------
+
+  double values[SCAN_POINT_WIDTH] = {0};
+  for (size_t j = 0; j < point.size() && j < SCAN_POINT_WIDTH; j++) {
+    values[j] = point[j];
+  }
+  push_back(values);
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::push_back(const double *point) {
+//----------------------------------------------------------
+
+  Detach();
+  fData.insert(fData.end(), point, point + SCAN_POINT_WIDTH);
+  fPoints = &fData[0];
+  fSize++;
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::swap(ScanPoints &other) {
+//----------------------------------------------------------
+
+  fData.swap(other.fData); // the buffers move with their vectors, so fPoints stays valid
+  std::swap(fPoints, other.fPoints);
+  std::swap(fSize, other.fSize);
+  std::swap(fMap, other.fMap);
+  std::swap(fMapLength, other.fMapLength);
+
+}
+
+// The file is written under a temporary name and renamed, so a plan that is being written is never mapped.
+//----------------------------------------------------------
+bool ScanPoints::Write(const char *path, size_t numPoints, uint32_t settingsHash) const {
+//----------------------------------------------------------
+
+  if (numPoints > fSize) numPoints = fSize;
+
+  SCAN_PLAN_HEADER header;
+  memset(&header, 0, sizeof(header));
+  strncpy(header.Magic, SCAN_PLAN_MAGIC, sizeof(header.Magic));
+  header.Version = SCAN_PLAN_VERSION;
+  header.Width = SCAN_POINT_WIDTH;
+  header.NumPoints = numPoints;
+  header.SettingsHash = settingsHash;
+  header.Checksum = ScanPlanHash(fPoints, numPoints * SCAN_POINT_WIDTH * sizeof(double));
+
+  char tmpPath[1024];
+  snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+
+  FILE *file = fopen(tmpPath, "wb");
+  if (!file) {
+    cm_msg(MERROR, "ScanPoints::Write", "Cannot write scan plan %s: %s", tmpPath, strerror(errno));
+    return false;
+  }
+  bool ok = fwrite(&header, sizeof(header), 1, file) == 1;
+  if (ok && numPoints > 0) {
+    ok = fwrite(fPoints, sizeof(double) * SCAN_POINT_WIDTH, numPoints, file) == numPoints;
+  }
+  ok = (fclose(file) == 0) && ok;
+
+  if (!ok || rename(tmpPath, path) != 0) {
+    cm_msg(MERROR, "ScanPoints::Write", "Cannot write scan plan %s: %s", path, strerror(errno));
+    unlink(tmpPath);
+    return false;
+  }
+  return true;
+
+}
+
+//----------------------------------------------------------
+bool ScanPoints::Map(const char *path, uint32_t settingsHash) {
+//----------------------------------------------------------
+
+  return MapFile(path, &settingsHash);
+
+}
+
+//----------------------------------------------------------
+bool ScanPoints::Map(const char *path) {
+//----------------------------------------------------------
+
+  return MapFile(path, NULL);
+
+}
+
+//----------------------------------------------------------
+bool ScanPoints::MapFile(const char *path, const uint32_t *settingsHash) {
+//----------------------------------------------------------
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false; // no plan yet
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(SCAN_PLAN_HEADER)) {
+    close(fd);
+    cm_msg(MINFO, "ScanPoints::Map", "Scan plan %s is truncated, not using it", path);
+    return false;
+  }
+
+  // Private writable mapping: points can be changed in memory like owned ones without touching the file
+  const size_t length = st.st_size;
+  void *map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) {
+    cm_msg(MERROR, "ScanPoints::Map", "Cannot map scan plan %s: %s", path, strerror(errno));
+    return false;
+  }
+
+  const SCAN_PLAN_HEADER *header = (const SCAN_PLAN_HEADER *) map;
+  double *points = (double *) ((char *) map + sizeof(SCAN_PLAN_HEADER));
+  const size_t dataLength = length - sizeof(SCAN_PLAN_HEADER);
+
+  const char *problem = NULL;
+  if (strncmp(header->Magic, SCAN_PLAN_MAGIC, sizeof(header->Magic)) != 0) {
+    problem = "is not a scan plan";
+  } else if (header->Version != SCAN_PLAN_VERSION || header->Width != SCAN_POINT_WIDTH) {
+    problem = "is from another version";
+  } else if (settingsHash && header->SettingsHash != *settingsHash) {
+    problem = "is for other scan settings";
+  } else if (header->NumPoints != dataLength / (sizeof(double) * SCAN_POINT_WIDTH) ||
+             dataLength % (sizeof(double) * SCAN_POINT_WIDTH) != 0) {
+    problem = "is truncated";
+  } else if (header->Checksum != ScanPlanHash(points, dataLength)) {
+    problem = "is corrupted";
+  }
+
+  if (problem) {
+    cm_msg(MINFO, "ScanPoints::Map", "Scan plan %s %s, not using it", path, problem);
+    munmap(map, length);
+    return false;
+  }
+
+  clear();
+  fMap = map;
+  fMapLength = length;
+  fPoints = header->NumPoints > 0 ? points : NULL;
+  fSize = header->NumPoints;
+  return true;
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::Detach() {
+//----------------------------------------------------------
+
+  if (!fMap) return;
+
+  fData.assign(fPoints, fPoints + fSize * SCAN_POINT_WIDTH);
+  Unmap();
+  fPoints = fData.empty() ? NULL : &fData[0];
+
+}
+
+//----------------------------------------------------------
+void ScanPoints::Unmap() {
+//----------------------------------------------------------
+
+  if (!fMap) return;
+
+  munmap(fMap, fMapLength);
+  fMap = NULL;
+  fMapLength = 0;
+
+}
@@ -0,0 +1,100 @@
+#ifndef ScanPlan_H
+#define ScanPlan_H
+
+#include <vector>
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of values in each scan point: x, y, z, rotation, tilt of gantry 0, then the same for gantry 1.
+// Values below -999 leave that axis where it is (see move_next_position in feScan).
+#define SCAN_POINT_WIDTH 10
+
+/* Scan plan file
+ *
+ * Written by feScan once a path is generated, so a plan can be looked at offline and reused by a restarted feScan.
+ * Plans made outside feScan (e.g. the manual path, see make_scan_plan.py) have the same layout, with a
+ * SettingsHash of 0.
+ * Layout (native byte order):
+ *     SCAN_PLAN_HEADER
+ *     NumPoints x SCAN_POINT_WIDTH doubles, point after point
+ * The points start at a multiple of 8 bytes, so the file can be mapped and used in place.
+ */
+
+#define SCAN_PLAN_MAGIC "PTFPLAN"
+// Bump when the layout changes so older files are not used
+#define SCAN_PLAN_VERSION 1
+
+typedef struct {
+  char Magic[8];          // SCAN_PLAN_MAGIC
+  uint32_t Version;       // SCAN_PLAN_VERSION
+  uint32_t Width;         // SCAN_POINT_WIDTH
+  uint64_t NumPoints;
+  uint32_t SettingsHash;  // identifies the settings the plan was generated from, see ScanSequence::SettingsHash
+  uint32_t Checksum;      // ScanPlanHash of the points
+} SCAN_PLAN_HEADER;
+
+// 32 bit FNV-1a hash of length bytes, continuing from hash
+uint32_t ScanPlanHash(const void *data, size_t length, uint32_t hash = 2166136261u);
+
+// Reads just the header of a plan file. Returns false if there is no such file or it is too short.
+bool ReadScanPlanHeader(const char *path, SCAN_PLAN_HEADER *header);
+
+
+// The points of a scan, stored in one contiguous block of SCAN_POINT_WIDTH doubles per point.
+// points[i][j] is value j of point i, as with the std::vector<std::vector<double> > it replaces.
+// The points either belong to the object or are a plan file mapped with Map; in the latter case they
+// can still be changed in place (privately, the file is not written), and are copied out of the file
+// as soon as the number of points changes.
+class ScanPoints {
+
+public:
+  ScanPoints();
+  ~ScanPoints();
+
+  double *operator[](size_t i) { return fPoints + i * SCAN_POINT_WIDTH; }
+  const double *operator[](size_t i) const { return fPoints + i * SCAN_POINT_WIDTH; }
+
+  size_t size() const { return fSize; }
+  bool empty() const { return fSize == 0; }
+  // True if the points are a mapped plan file
+  bool mapped() const { return fMap != NULL; }
+
+  void clear();
+  // New points are zero
+  void resize(size_t n);
+  void reserve(size_t n);
+  // Appends a point; missing values are zero and values beyond SCAN_POINT_WIDTH are ignored
+  void push_back(const std::vector<double> &point);
+  void push_back(const double *point);
+  // Exchanges the points (owned or mapped) with those of other
+  void swap(ScanPoints &other);
+
+  // Writes the first numPoints points to a plan file. Returns false (and says why) if it could not.
+  bool Write(const char *path, size_t numPoints, uint32_t settingsHash) const;
+  // Replaces the points with the ones of a plan file, if it was made from settings with this hash and is intact.
+  // Returns false if the file cannot be used, leaving the points untouched.
+  bool Map(const char *path, uint32_t settingsHash);
+  // The same for a plan made outside feScan, which is used whatever the settings
+  bool Map(const char *path);
+
+private:
+  // Not copyable (the mapping would be unmapped twice)
+  ScanPoints(const ScanPoints &);
+  ScanPoints &operator=(const ScanPoints &);
+
+  // Map, checking the settings hash unless it is NULL
+  bool MapFile(const char *path, const uint32_t *settingsHash);
+  // Copies mapped points into fData and unmaps the file
+  void Detach();
+  void Unmap();
+
+  std::vector<double> fData;
+  double *fPoints; // first point, in fData or in the mapping
+  size_t fSize;
+
+  void *fMap;
+  size_t fMapLength;
+
+};
+
+#endif
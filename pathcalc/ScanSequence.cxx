@@ -1,13 +1,13 @@
 #include "ScanSequence.hxx"
+#include "TScanValidator.hxx"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include <cmath>
 #include <sys/time.h>
 #include <sstream>
 
-#include "demo_path.cxx"
-
 //globals from feScan, which I need here (are global any  way, otherwise pass by ref Init?)
 
 /*
@@ -34,7 +34,7 @@ void ScanSequence::Init(SCAN_SETTINGS &fs_in, float *gantryLim){
 
 
 //----------------------------------------------------------
-int ScanSequence::GeneratePath(std::vector<std::vector<double> > &points_in){
+int ScanSequence::GeneratePath(ScanPoints &points_in){
 //----------------------------------------------------------
 
 
@@ -96,7 +96,149 @@ int ScanSequence::GeneratePath(std::vector<std::vector<double> > &points_in){
 
 
 //----------------------------------------------------------
-int ScanSequence::CylinderPath(std::vector<std::vector<double> > &points){
+uint32_t ScanSequence::SettingsHash(){
+//----------------------------------------------------------
+
+  uint32_t hash = ScanPlanHash(&fs, sizeof(fs));
+  hash = ScanPlanHash(gGantryLimits, 10 * sizeof(float), hash);
+  if(fs.scan_type == MANUAL){
+    // The manual path is whatever the plan file holds now
+    SCAN_PLAN_HEADER header;
+    hash = ScanPlanHash(fManualPlan.c_str(), fManualPlan.size(), hash);
+    if(ReadScanPlanHeader(fManualPlan.c_str(), &header))
+      hash = ScanPlanHash(&header, sizeof(header), hash);
+  }
+  return hash;
+}
+
+
+// Reports the invalid points and moves found by the last validation, up to a few of them
+static void ReportInvalid(const TScanValidator &validator, int numPoints){
+
+  const int maxReported = 10;
+  int reported = 0, notReported = 0;
+  for(int i = 0; i < numPoints; i++){
+    const bool badPoint = validator.GetPointProblem(i) != SCAN_POINT_OK;
+    const bool badMove = !validator.GetMoveGood(i);
+    if(!badPoint && !badMove) continue;
+    if(reported == maxReported){
+      notReported++;
+      continue;
+    }
+    const double *p = validator.GetResolvedPoint(i);
+    if(badPoint)
+      cm_msg(MERROR, "ValidatePath", "Point %i (%.3f %.3f %.3f %.1f %.1f, %.3f %.3f %.3f %.1f %.1f): %s", i,
+             p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9],
+             TScanValidator::GetProblemName(validator.GetPointProblem(i)));
+    else
+      cm_msg(MERROR, "ValidatePath", "Point %i (%.3f %.3f %.3f %.1f %.1f, %.3f %.3f %.3f %.1f %.1f): "
+             "no path from the point before", i, p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7], p[8], p[9]);
+    reported++;
+  }
+  if(notReported > 0)
+    cm_msg(MERROR, "ValidatePath", "... and %i more invalid points or moves", notReported);
+}
+
+
+//----------------------------------------------------------
+int ScanSequence::ValidatePath(ScanPoints &points, int numPoints, std::vector<char> &waypoints, const float *start,
+                               const COLLISION_SETTINGS &collision, const SCAN_VALIDATION &options,
+                               SCAN_VALIDATION_SUMMARY *summary){
+//----------------------------------------------------------
+
+  memset(summary, 0, sizeof(SCAN_VALIDATION_SUMMARY));
+  summary->FirstInvalid = -1;
+  waypoints.assign(numPoints, 0);
+
+  if(!options.CheckPoints || numPoints <= 0)
+    return numPoints;
+
+  TScanValidator validator(collision, gGantryLimits);
+  DWORD startTime = ss_millitime();
+  int numInvalid = validator.Validate(points, numPoints, start, options.CheckMoves);
+
+  for(int i = 0; i < numPoints; i++){
+    if(validator.GetPointProblem(i) != SCAN_POINT_OK) summary->InvalidPoints++;
+    if(!validator.GetMoveGood(i)) summary->InvalidMoves++;
+  }
+  cm_msg(summary->InvalidPoints || summary->InvalidMoves ? MERROR : MINFO, "ValidatePath",
+         "Checked %i points%s in %u ms: %i invalid points, %i moves without a path", numPoints,
+         options.CheckMoves ? " and moves" : "", ss_millitime() - startTime,
+         summary->InvalidPoints, summary->InvalidMoves);
+  ReportInvalid(validator, numPoints);
+
+  // Reroute: lift both gantries to their limit (base) height above the start of the move first.
+  // feMove then makes the move in X & Y up there, where the gantries are clear of the tank, before going down.
+  // The values of the point after the waypoint are filled in, so that they are not taken from the waypoint.
+  if(options.RerouteMoves && summary->InvalidMoves > 0){
+    ScanPoints rerouted;
+    std::vector<char> reroutedWaypoints;
+    rerouted.reserve(numPoints + summary->InvalidMoves);
+    for(int i = 0; i < numPoints; i++){
+      if(validator.GetMoveGood(i)){
+        rerouted.push_back(points[i]);
+        reroutedWaypoints.push_back(waypoints[i]);
+        continue;
+      }
+      double waypoint[SCAN_POINT_WIDTH];
+      for(int j = 0; j < SCAN_POINT_WIDTH; j++)
+        waypoint[j] = i == 0 ? start[j] : validator.GetResolvedPoint(i - 1)[j];
+      waypoint[2] = gGantryLimits[2];
+      waypoint[7] = gGantryLimits[7];
+      rerouted.push_back(waypoint);
+      reroutedWaypoints.push_back(1);
+      rerouted.push_back(validator.GetResolvedPoint(i));
+      reroutedWaypoints.push_back(waypoints[i]);
+      summary->ReroutedMoves++;
+    }
+    points.swap(rerouted);
+    waypoints.swap(reroutedWaypoints);
+    numPoints = points.size();
+    numInvalid = validator.Validate(points, numPoints, start, options.CheckMoves);
+  }
+
+  // Drop: removing a point can leave the next one without a path, so repeat until everything left is valid.
+  // Each round removes at least one point, so this ends.
+  while(options.DropInvalid && numInvalid > 0){
+    ScanPoints kept;
+    std::vector<char> keptWaypoints;
+    kept.reserve(numPoints);
+    for(int i = 0; i < numPoints; i++){
+      if(validator.GetPointProblem(i) != SCAN_POINT_OK || !validator.GetMoveGood(i)){
+        summary->DroppedPoints++;
+        continue;
+      }
+      // Filled in: values left where they are could otherwise come from a dropped point
+      kept.push_back(validator.GetResolvedPoint(i));
+      keptWaypoints.push_back(waypoints[i]);
+    }
+    points.swap(kept);
+    waypoints.swap(keptWaypoints);
+    numPoints = points.size();
+    numInvalid = validator.Validate(points, numPoints, start, options.CheckMoves);
+  }
+
+  if(summary->ReroutedMoves > 0 || summary->DroppedPoints > 0){
+    cm_msg(numInvalid ? MERROR : MINFO, "ValidatePath",
+           "Rerouted %i moves and dropped %i points: %i points left, %i of them invalid or without a path",
+           summary->ReroutedMoves, summary->DroppedPoints, numPoints, numInvalid);
+    ReportInvalid(validator, numPoints);
+  }
+
+  summary->StillInvalid = numInvalid;
+  for(int i = 0; i < numPoints; i++){
+    if(validator.GetPointProblem(i) != SCAN_POINT_OK || !validator.GetMoveGood(i)){
+      summary->FirstInvalid = i;
+      break;
+    }
+  }
+
+  return numPoints;
+}
+
+
+//----------------------------------------------------------
+int ScanSequence::CylinderPath(ScanPoints &points){
 //----------------------------------------------------------
 
   //TODO : test
@@ -106,7 +248,6 @@ int ScanSequence::CylinderPath(std::vector<std::vector<double> > &points){
   // For cylindrical scan
   float PI = 3.14159265;
   int max_size = 0;
-  int prev_max_size = -1;
   points.clear();
 
   /*
@@ -149,13 +290,8 @@ int ScanSequence::CylinderPath(std::vector<std::vector<double> > &points){
 
     // for efficient vector usage: already resize
     if (point_num == max_size) {
-      prev_max_size = max_size;
       max_size =! max_size ? 1 : max_size << 1;
       points.resize(max_size);
-
-      for(int j = prev_max_size;j < max_size; j++){
-        points[j].reserve(10);
-      }
     }
 
 
@@ -176,13 +312,8 @@ int ScanSequence::CylinderPath(std::vector<std::vector<double> > &points){
 
         // for efficient vector usage: already resize
         if (point_num == max_size) {
-          prev_max_size = max_size;
           max_size =! max_size ? 1 : max_size << 1;
           points.resize(max_size);
-
-          for(int j = prev_max_size;j < max_size; j++){
-            points[j].reserve(10);
-          }
         }
 
 
@@ -209,13 +340,8 @@ int ScanSequence::CylinderPath(std::vector<std::vector<double> > &points){
 
   // for efficient vector usage: already resize
   if (point_num == max_size) {
-    prev_max_size = max_size;
     max_size =! max_size ? 1 : max_size << 1;
     points.resize(max_size);
-
-    for(int j = prev_max_size;j < max_size; j++){
-      points[j].reserve(10);
-    }
   }
 
   // Add end point: back to their corner!
@@ -224,15 +350,18 @@ int ScanSequence::CylinderPath(std::vector<std::vector<double> > &points){
   }
   point_num = point_num + 1;
 
-  printf("%i - %.4F %.4F %.4F \n",point_num,points[point_num][0],points[point_num][1],points[point_num][2]);
-  printf("%i - %.4F %.4F %.4F \n",point_num,points[point_num][5],points[point_num][6],points[point_num][7]);
+  // drop the space left over from the resizing, so the return to base comes right after the end point
+  points.resize(point_num);
+
+  printf("%i - %.4F %.4F %.4F \n",point_num,points[point_num-1][0],points[point_num-1][1],points[point_num-1][2]);
+  printf("%i - %.4F %.4F %.4F \n",point_num,points[point_num-1][5],points[point_num-1][6],points[point_num-1][7]);
 
   return point_num;
 }
 
 
 //----------------------------------------------------------
-int ScanSequence::RectangularPath(std::vector<std::vector<double> > &points){
+int ScanSequence::RectangularPath(ScanPoints &points){
 //----------------------------------------------------------
 
 // 1) Use for magnetic field scan (with zero tilt and -90 rotation or so), but using two gantries
@@ -301,6 +430,19 @@ int ScanSequence::RectangularPath(std::vector<std::vector<double> > &points){
   // 19/Oct/2017 - Kevin Xie - added extra code to rectangular scan paths so that the entire region can be scanned. Previously, false collision messages appeared at the Y-position where the non-scanning gantry switched hemispheres
   bool crossedHemisphere = false;
   double offset = 0.005; // 5mm offset added to corners to avoid limit switch errors
+
+  // Normal incidence does not depend on z, so it is worked out once for the x-y grid instead of in every layer
+  const int grid_x = trunc(fs.rect_par.prism_length_x/fs.rect_par.x_step) + 1;
+  const int grid_y = trunc(fs.rect_par.prism_width_y/fs.rect_par.y_step) + 1;
+  const int grid_size = grid_x*grid_y;
+  std::vector<double> norm_incidence[2];
+  if(fs.rect_par.subtype == NORM_INCIDENCE){
+    if(fs.rect_par.which_gantry == GANTRY0 || fs.rect_par.which_gantry == BOTH)
+      NormIncidenceGrid(GANTRY0, grid_x, grid_y, norm_incidence[0]);
+    if(fs.rect_par.which_gantry == GANTRY1 || fs.rect_par.which_gantry == BOTH)
+      NormIncidenceGrid(GANTRY1, grid_x, grid_y, norm_incidence[1]);
+  }
+
   for(int z_layer = 0;z_layer<=(trunc(fs.rect_par.prism_height_z/fs.rect_par.z_step));z_layer++){
 
     //scan for gantry 0
@@ -330,14 +472,9 @@ int ScanSequence::RectangularPath(std::vector<std::vector<double> > &points){
             single_point[3] = fs.rect_par.init_rotation;
             single_point[4] = fs.rect_par.init_tilt;
           } else if(fs.rect_par.subtype == NORM_INCIDENCE){
-            CalculateNormIncidence(single_point, 0.359, 0.326, 0.05, 0, 0, GANTRY0);//Rika (25Apr2017): estimated new PMT centre (0.341, 0.328) // Kevin's new estimate (0.359, 0.326)
-            //Beamlength changed to 0.05m
-            for (int trial = 0; trial < 10; trial++)
-            {
-              char buffer[32];
-              snprintf(buffer, sizeof(buffer), "%g", single_point[trial]);
-              //cm_msg(MINFO,"Testing", buffer);  //TF: too slow to dump, only for debugging purposes for short sequences
-            }
+            const double *grid = &norm_incidence[0][y_layer*grid_x + x_layer];
+            SetNormIncidencePoint(single_point, GANTRY0, grid[0], grid[grid_size], grid[2*grid_size],
+                                  grid[3*grid_size], grid[4*grid_size]);
           }
 
           if(fs.rect_par.which_gantry == BOTH){
@@ -438,13 +575,9 @@ int ScanSequence::RectangularPath(std::vector<std::vector<double> > &points){
             single_point[8] = fs.rect_par.init_rotation;
             single_point[9] = fs.rect_par.init_tilt;
           } else if(fs.rect_par.subtype == NORM_INCIDENCE){
-            CalculateNormIncidence(single_point, 0.359, 0.326, 0.05, 0, 0, GANTRY1);
-            for (int trial = 0; trial < 10; trial++)
-            {
-              char buffer[32];
-              snprintf(buffer, sizeof(buffer), "%g", single_point[trial]);
-              //cm_msg(MINFO,"Testing", buffer); //TF: too slow to dump, only for debugging purposes for short sequences
-            }
+            const double *grid = &norm_incidence[1][y_layer*grid_x + x_layer];
+            SetNormIncidencePoint(single_point, GANTRY1, grid[0], grid[grid_size], grid[2*grid_size],
+                                  grid[3*grid_size], grid[4*grid_size]);
           }
           if(fs.rect_par.which_gantry == BOTH){
             single_point[2] =  fs.rect_par.init_pos_z + (z_layer*fs.rect_par.z_step);
@@ -547,7 +680,7 @@ int ScanSequence::RectangularPath(std::vector<std::vector<double> > &points){
 }
 
 //----------------------------------------------------------
-int ScanSequence::DemoPath(std::vector<std::vector<double> > &points){
+int ScanSequence::DemoPath(ScanPoints &points){
 //----------------------------------------------------------
 
 // Demo sequence for HK Workshop
@@ -586,7 +719,7 @@ int ScanSequence::DemoPath(std::vector<std::vector<double> > &points){
 }
 
 //----------------------------------------------------------
-int ScanSequence::TankAvoidancePath(std::vector<std::vector<double> > &points){
+int ScanSequence::TankAvoidancePath(ScanPoints &points){
 //---------------------------------------------------------
 
   points.clear();
@@ -609,10 +742,7 @@ int ScanSequence::TankAvoidancePath(std::vector<std::vector<double> > &points){
                            {0.631,0.000,0.200,-45.0,0.00, 0.650,0.647,0.200,-45.0,0.00}, // Gantry 0 top-bottom limit
                            {0.632,0.000,0.200,-45.0,0.00, 0.650,0.647,0.200,-45.0,0.00}}; // Over limit (0.631-0.632)
 
-  points.reserve(point_num+1);
-  for(int j = 0; j < (point_num+1); j++){
-    points[j].reserve(10);
-  }
+  points.resize(max_size);
 
   for(int p = 0; p < max_size; p++){
     for(int l = 0; l < 10; l++){
@@ -623,29 +753,30 @@ int ScanSequence::TankAvoidancePath(std::vector<std::vector<double> > &points){
 }
 
 
+// The manual path is read from a plan file made with make_scan_plan.py (see SetManualPlan), mapped
+// rather than parsed, so a new path needs no rebuild and large ones load in no time.
 //----------------------------------------------------------
-int ScanSequence::ManualPath(std::vector<std::vector<double> > &points){
+int ScanSequence::ManualPath(ScanPoints &points){
 //----------------------------------------------------------
-  cm_msg(MDEBUG, "ManualPath", "Loading manual path...");
-  point_num = DEMO_PATH_LENGTH - 1;
+  cm_msg(MDEBUG, "ManualPath", "Loading manual path %s...", fManualPlan.c_str());
   points.clear();
 
-  points.resize(DEMO_PATH_LENGTH);
-
-  for (int i = 0; i < DEMO_PATH_LENGTH; i++) {
-    points[i].resize(10);
-    for (int j = 0; j < 10; j++)
-      points[i][j] = DEMO_PATH[i][j];
+  ScanPoints plan;
+  if(!plan.Map(fManualPlan.c_str()) || plan.empty()){
+    cm_msg(MERROR, "ManualPath", "Cannot load manual path %s", fManualPlan.c_str());
+    return 0;
   }
+  points.swap(plan);
+  point_num = points.size() - 1;
 
-  cm_msg(MDEBUG, "ManualPath", "Manual path loaded. There are %i points.", DEMO_PATH_LENGTH);
+  cm_msg(MDEBUG, "ManualPath", "Manual path loaded. There are %i points.", (int) points.size());
 
   return point_num;
 }
 
 
 //----------------------------------------------------------
-int ScanSequence::AlignmentPath(std::vector<std::vector<double> > &points){
+int ScanSequence::AlignmentPath(ScanPoints &points){
 //----------------------------------------------------------
 
 
@@ -661,9 +792,6 @@ int ScanSequence::AlignmentPath(std::vector<std::vector<double> > &points){
   // Create some initial space
   max_size = 1;
   points.resize(max_size);
-  for(int j = 0;j < max_size; j++){
-    points[j].reserve(10);
-  }
 
 
   //STEP 1: set both gantries at initial position 
@@ -713,8 +841,7 @@ int ScanSequence::AlignmentPath(std::vector<std::vector<double> > &points){
 
 
   //STEP 3: back to initial position, but go to corner in solid angle grid, start scan
-  single_point.clear();
-  single_point.reserve(10);
+  single_point.assign(10, 0.0);
 
   for(int l = 0; l < 10; l++)
     single_point[l] = fs.align_par.init_pos[l];
@@ -750,7 +877,7 @@ int ScanSequence::AlignmentPath(std::vector<std::vector<double> > &points){
 }
 
 //----------------------------------------------------------
-int ScanSequence::PassByPath(std::vector<std::vector<double> > &points){
+int ScanSequence::PassByPath(ScanPoints &points){
 //----------------------------------------------------------
 
   points.clear();
@@ -793,7 +920,7 @@ int ScanSequence::PassByPath(std::vector<std::vector<double> > &points){
 
 
 //----------------------------------------------------------
-int ScanSequence::PMTSurfacePath(std::vector<std::vector<double> > &points){
+int ScanSequence::PMTSurfacePath(ScanPoints &points){
 //----------------------------------------------------------
 
   /* This is a sequence on the surface of the PMT: an azimuthal symmetric object, which
@@ -875,7 +1002,7 @@ int ScanSequence::PMTSurfacePath(std::vector<std::vector<double> > &points){
 
 /**
 //----------------------------------------------------------
-int ScanSequence::FixedPointPath(std::vector<std::vector<double> > &points){
+int ScanSequence::FixedPointPath(ScanPoints &points){
 //----------------------------------------------------------
 
 
@@ -919,9 +1046,6 @@ int ScanSequence::FixedPointPath(std::vector<std::vector<double> > &points){
   // Create some initial space
   max_size = 1;
   points.resize(max_size);
-  for(int j = 0;j < max_size; j++){
-    points[j].reserve(10);
-  }
 
   for(int theta = startTheta; theta <= startTheta + totalTheta; theta += stepTheta){
 
@@ -946,7 +1070,7 @@ int ScanSequence::FixedPointPath(std::vector<std::vector<double> > &points){
 **/
 
 //----------------------------------------------------------
-void ScanSequence::ReturnToBase(std::vector<std::vector<double> > &points){
+void ScanSequence::ReturnToBase(ScanPoints &points){
 //----------------------------------------------------------
   std::vector<double> single_point(10);
 
@@ -980,160 +1104,174 @@ void ScanSequence::CalculateNormIncidence(std::vector<double> &point, double cen
  *      gantry   - choice of gantry to be used for the scan
  **/
 
+  const int first = (gantry == GANTRY0) ? 0 : 5;
+  double x, y, z, rotation, tilt;
+
+  CalculateNormIncidence(1, &point[first], &point[first + 1], center_x, center_y, beam, incidence, azimuth, gantry,
+                         &x, &y, &z, &rotation, &tilt);
+  SetNormIncidencePoint(point, gantry, x, y, z, rotation, tilt);
+
+  return;
+
+}
+
+//----------------------------------------------------------
+void ScanSequence::CalculateNormIncidence(int n, const double *point_x, const double *point_y, double center_x,
+                                          double center_y, double beam, double incidence, double azimuth,
+                                          gantry_t gantry, double *gantry_x, double *gantry_y, double *gantry_z,
+                                          double *rotation, double *tilt)
+{
+//----------------------------------------------------------
 
 /* General idea: - Gradient of spherical surface function evaluated at a point on the sphere gives its normal vector.
                  - for a circle, sphere or sum of spheres (good model for PMT with azimuthal symm): 
 		   => Normal is ALWAYS line going through center (radius is perpendicular with tangential plane!!)
+
+   The angles of the spherical coordinates of the point only ever go into sines and cosines, which are ratios of
+   the coordinates themselves (cos(alpha) = z/radius, cos(gamma) = x/r, ...). So are the sines and cosines of the
+   rotation and tilt of the beam, which the optical box offsets need. The only trig left per point are the two
+   atan2 for the rotation and tilt that are returned; the incidence and azimuth are the same for the whole batch.
  */
 
   const double PI  = 3.141592653589793238463;
 
-  double radius = 0.323;
-  double pmtHeight = 0.390;
-
-  double x, y, z, gamma, alpha, x_origin, y_origin, z_origin,
-      x_inc, y_inc, z_inc, x_inc_temp, /*y_inc_temp,*/
-      tilt_angle, rot_angle, offset1_g0, offset2_g0,
-      offset3_g0, offset1_g1, offset2_g1, offset3_g1,
-      g0_o_mag, g1_o_mag, g0_final_offset_x, g0_final_offset_y,
-      g0_final_offset_z, g1_final_offset_x, g1_final_offset_y, g1_final_offset_z,
-      output_rot_angle;
+  const double radius = 0.323;
+  const double pmtHeight = 0.390;
 
   //Offsets for Gantry 0
-  offset1_g0 = 0.115; //TODO: determine accuracy
-  offset2_g0 = 0.042; //- 0.003*beam*10; //0.042 +- 0.002 correction factor: -0.003*beam*10 added Feb24, 2017 (4pm)-> edited to -0.003*beam*10 Mar6,2017
-  offset3_g0 = -0.0365; //0.037 +/- 0.002 Mar6,2017
-  g0_o_mag = sqrt(offset1_g0*offset1_g0 + offset2_g0*offset2_g0 + offset3_g0*offset3_g0);
-
+  //offset2: 0.042 +- 0.002 correction factor: -0.003*beam*10 added Feb24, 2017 (4pm)-> edited to -0.003*beam*10 Mar6,2017
+  //offset3: 0.037 +/- 0.002 Mar6,2017
   //Offsets for Gantry 1
-  offset1_g1 = 0.115;
-  offset2_g1 = 0.052; //- 0.002*beam*10; //correction factor: -0.002*beam*10 added Mar9,2017
-  offset3_g1 = -0.0395;
-  g1_o_mag = sqrt(offset1_g1*offset1_g1 + offset2_g1*offset2_g1 + offset3_g1*offset3_g1);
+  //offset2: correction factor: -0.002*beam*10 added Mar9,2017
+  const double offset1 = 0.115; //TODO: determine accuracy
+  const double offset2 = (gantry == GANTRY0) ? 0.042 : 0.052;
+  const double offset3 = (gantry == GANTRY0) ? -0.0365 : -0.0395;
+
+  //Beam relative to the normal, in spherical coordinates converted to cartesian
+  const double x_beam = beam*sin(PI*incidence/180)*cos(PI*azimuth/180);
+  const double y_beam = beam*sin(PI*incidence/180)*sin(PI*azimuth/180);
+  const double z_beam = beam*cos(PI*incidence/180);
+
+  for(int i = 0; i < n; i++){
+
+    //Converts gantry position in absolute coordinates to relative coordinates
+    const double x = point_x[i] - center_x;
+    const double y = point_y[i] - center_y;
+    const double r2 = x*x + y*y;
+
+    double x_pos, y_pos, z_pos, rot_angle, tilt_angle, cos_rot, sin_rot, cos_tilt, sin_tilt;
+
+    if(r2 < radius*radius){
+      //z position on PMT surface, and the angles of its spherical coordinates
+      const double r = sqrt(r2);
+      const double z = sqrt(radius*radius - r2);
+      const double cos_alpha = z/radius, sin_alpha = r/radius;
+      const double cos_gamma = (r > 0) ? x/r : 1.0, sin_gamma = (r > 0) ? y/r : 0.0;
+
+      //Rotation about y-axis of PMT
+      const double x_tmp = cos_alpha*x_beam + sin_alpha*z_beam;
+      const double z_inc = -sin_alpha*x_beam + cos_alpha*z_beam;
+
+      //Rotation about x-axis of PMT
+      const double x_inc = cos_gamma*x_tmp - sin_gamma*y_beam;
+      const double y_inc = sin_gamma*x_tmp + cos_gamma*y_beam;
+
+      //Superposition of coordinates to achieve point source positioning
+      x_pos = (x + center_x) + x_inc;
+      y_pos = (y + center_y) + y_inc;
+      z_pos = z + z_inc;
+
+      //Rotation and tilt angle that describe the beam from the gantry
+      const double xy_inc = sqrt(x_inc*x_inc + y_inc*y_inc);
+      const double length = sqrt(xy_inc*xy_inc + z_inc*z_inc);
+      rot_angle = atan2(y_inc, x_inc); //Range for atan2 is (-PI,+PI) since it takes into account sign of arguments to determine quadrant
+      tilt_angle = atan2(z_inc, xy_inc); //tilt_angle comes out positive
+      cos_tilt = (length > 0) ? xy_inc/length : 1.0;
+      sin_tilt = (length > 0) ? z_inc/length : 0.0;
+
+      //Converts beam rotation about point of laser incidence (x_origin, y_origin) to rotation angle of Gantry 0,
+      //which turns the beam around
+      rot_angle = (rot_angle < 0) ? rot_angle + PI : rot_angle - PI;
+      cos_rot = (xy_inc > 0) ? -x_inc/xy_inc : -1.0;
+      sin_rot = (xy_inc > 0) ? -y_inc/xy_inc : 0.0;
+    }
+    else{ //The point (x,y) specified is not on the PMT surface, so do a vertical scan
+      x_pos = point_x[i];
+      y_pos = point_y[i];
+      z_pos = pmtHeight + radius - offset1; //Distance away from PMT cover centre of curvature - optical box height
+      rot_angle = 0.0;
+      tilt_angle = 90.0*PI/180;
+      cos_rot = 1.0;
+      sin_rot = 0.0;
+      cos_tilt = 0.0;
+      sin_tilt = 1.0;
+    }
 
+    //Corrections for the optical box of the gantry
+    x_pos -= offset1*cos_rot*cos_tilt - offset2*sin_rot + offset3*cos_rot*sin_tilt;
+    y_pos -= offset1*sin_rot*cos_tilt + offset2*cos_rot + offset3*sin_rot*sin_tilt;
+    z_pos -= (-1)*offset1*sin_tilt + offset3*cos_tilt;
 
+    if(gantry != GANTRY0){
+      //Updated from (rot_angle > 90*PI/180) in order to fix problem of illegal angles being produced - Mar 1, 2017
+      rot_angle = (rot_angle > 0.0) ? rot_angle - PI : rot_angle + PI;
+    }
 
-  //Converts gantry position in absolute coordinates to relative coordinates
-  if(gantry==GANTRY0){
-    x = point[0] - center_x;
-    y = point[1] - center_y;
-  } else{
-    x = point[5] - center_x;
-    y = point[6] - center_y;
+    //Final conversions to gantry frame
+    gantry_x[i] = x_pos;
+    gantry_y[i] = y_pos;
+    gantry_z[i] = pmtHeight + radius - z_pos; //0.712 == z position of centre of PMT cover in PTF coordinates - updated 24Apr2017
+    rotation[i] = rot_angle*180/PI;
+    tilt[i] = -tilt_angle*180/PI;
   }
 
-  if(sqrt(x*x + y*y) < radius){
-    //Calculates z position on PMT surface
-    z = radius*cos(asin(sqrt(x*x + y*y)/radius));
-
-    //Converts angular arguments to radians for use with trig functions
-    incidence = PI*incidence/180;
-    azimuth = PI*azimuth/180;
-
-    //Calculates spherical coordinate angles
-    gamma = atan2(y,x);
-    alpha = asin(sqrt(x*x + y*y)/radius);
-
-    //Defines point that will be examined at different angles
-    x_origin = x + center_x;
-    y_origin = y + center_y;
-    z_origin = z;
-
-    //Conversion of spherical coordinates to cartesian
-    x_inc = beam*sin(incidence)*cos(azimuth);
-    y_inc = beam*sin(incidence)*sin(azimuth);
-    z_inc = beam*cos(incidence);
-
-    //Rotation about y-axis of PMT
-    x_inc_temp = x_inc;
-    x_inc = cos(alpha)*x_inc + sin(alpha)*z_inc;
-    z_inc = (-1)*sin(alpha)*x_inc_temp +cos(alpha)*z_inc;
-
-    //Rotation about x-axis of PMT
-    x_inc_temp = x_inc;
-    x_inc = cos(gamma)*x_inc - sin(gamma)*y_inc;
-    y_inc = sin(gamma)*x_inc_temp + cos(gamma)*y_inc;
-
-    //Superposition of coordinates to achieve point source positioning
-    x = x_origin + x_inc;
-    y = y_origin + y_inc;
-    z = z_origin + z_inc;
-
-    //Calculates rotation and tilt angle that describe the beam from the gantry
-    rot_angle = atan2(y_inc, x_inc); //Range for atan2 is (-PI,+PI) since it takes into account sign of arguments to determine quadrant
-    tilt_angle = atan2(z_inc, sqrt(x_inc*x_inc + y_inc*y_inc)); //tilt_angle comes out positive
-
-    //Converts beam rotation about point of laser incidence (x_origin, y_origin) to rotation angle of Gantry 0
-    if(rot_angle < 0)
-    {
-      rot_angle = rot_angle + PI;
-    }
-    else
-    {
-      rot_angle = rot_angle - PI;
-    }
-  }
-  else{ //The point (x,y) specified is not on the PMT surface, so do a vertical scan
-    if(gantry==GANTRY0){
-      x = point[0];
-      y = point[1];
-      z = pmtHeight + radius - offset1_g0; //Distance away from PMT cover centre of curvature - optical box height
-    }
-    else{
-      x = point[5];
-      y = point[6];
-      z = pmtHeight + radius - offset1_g1; //Distance away from PMT cover centre of curvature
-    }
-    rot_angle = 0.0;
-    tilt_angle = 90.0*PI/180;
-  }
-  //Corrections for gantry 1 and gantry 0 optical boxes
-  //Calculations for placement of point source
-  g0_final_offset_x = offset1_g0*cos(rot_angle)*cos(tilt_angle) - offset2_g0*sin(rot_angle) + offset3_g0*cos(rot_angle)*sin(tilt_angle);
-  g0_final_offset_y = offset1_g0*sin(rot_angle)*cos(tilt_angle) + offset2_g0*cos(rot_angle) + offset3_g0*sin(rot_angle)*sin(tilt_angle);
-  g0_final_offset_z = (-1)*offset1_g0*sin(tilt_angle) + offset3_g0*cos(tilt_angle);
+  return;
 
-  g1_final_offset_x = offset1_g1*cos(rot_angle)*cos(tilt_angle) - offset2_g1*sin(rot_angle) + offset3_g1*cos(rot_angle)*sin(tilt_angle);
-  g1_final_offset_y = offset1_g1*sin(rot_angle)*cos(tilt_angle) + offset2_g1*cos(rot_angle) + offset3_g1*sin(rot_angle)*sin(tilt_angle);
-  g1_final_offset_z = (-1)*offset1_g1*sin(tilt_angle) + offset3_g1*cos(tilt_angle);
+}
 
-  if (gantry==GANTRY0)
-  {
-    x = x - g0_final_offset_x;
-    y = y - g0_final_offset_y;
-    z = z - g0_final_offset_z;
-    output_rot_angle = rot_angle;
-  }
-  else
-  {
-    x = x - g1_final_offset_x;
-    y = y - g1_final_offset_y;
-    z = z - g1_final_offset_z;
+// The grid holds the five results (x, y, z, rotation, tilt) as one array of grid_x*grid_y values each,
+// x fastest, followed by the x and y of the points on the PMT.
+//----------------------------------------------------------
+void ScanSequence::NormIncidenceGrid(gantry_t gantry, int grid_x, int grid_y, std::vector<double> &grid)
+{
+//----------------------------------------------------------
 
-    if( rot_angle > 0.0) //Updated from (rot_angle > 90*PI/180) in order to fix problem of illegal angles being produced - Mar 1, 2017
-    {
-      output_rot_angle = rot_angle - PI;
-    }
-    else
-    {
-      output_rot_angle = rot_angle + PI;
+  const int size = grid_x*grid_y;
+  grid.resize(7*size);
+
+  double *point_x = &grid[5*size];
+  double *point_y = &grid[6*size];
+  for(int y_layer = 0; y_layer < grid_y; y_layer++){
+    for(int x_layer = 0; x_layer < grid_x; x_layer++){
+      point_x[y_layer*grid_x + x_layer] = fs.rect_par.init_pos_x + (x_layer*fs.rect_par.x_step);
+      point_y[y_layer*grid_x + x_layer] = fs.rect_par.init_pos_y + (y_layer*fs.rect_par.y_step);
     }
   }
 
-  //Final conversions to gantry frame
-  z =  pmtHeight + radius - z; //0.712 == z position of centre of PMT cover in PTF coordinates - updated 24Apr2017
-  tilt_angle = tilt_angle*(-1);
+  //Rika (25Apr2017): estimated new PMT centre (0.341, 0.328) // Kevin's new estimate (0.359, 0.326)
+  //Beamlength changed to 0.05m
+  CalculateNormIncidence(size, point_x, point_y, 0.359, 0.326, 0.05, 0, 0, gantry,
+                         &grid[0], &grid[size], &grid[2*size], &grid[3*size], &grid[4*size]);
+
+  return;
+
+}
 
-  //sets up return array
+//----------------------------------------------------------
+void ScanSequence::SetNormIncidencePoint(std::vector<double> &point, gantry_t gantry, double x, double y, double z,
+                                         double rotation, double tilt)
+{
+//----------------------------------------------------------
 
+  // The other gantry waits in its corner
   if(gantry==GANTRY0)
   {
 
     point[0] = x;
     point[1] = y;
     point[2] = z;
-    point[3] = output_rot_angle*180/PI;
-    point[4] = tilt_angle*180/PI;
+    point[3] = rotation;
+    point[4] = tilt;
 
     point[5] = 0.647;
     point[6] = 0;
@@ -1154,8 +1292,8 @@ void ScanSequence::CalculateNormIncidence(std::vector<double> &point, double cen
     point[5] = x;
     point[6] = y;
     point[7] = z;
-    point[8] = output_rot_angle*180/PI;
-    point[9] = tilt_angle*180/PI;
+    point[8] = rotation;
+    point[9] = tilt;
 
   }
 
@@ -3,7 +3,27 @@
 
 #include "midas.h"    
 #include "experim_new.h"  
+#include "ScanPlan.hxx"
+#include "CollisionSettings.hxx"
 #include <vector>
+#include <string>
+
+// Options for checking a scan before the run, kept in /Equipment/Scan/Validation (see ValidatePath)
+typedef struct {
+  BOOL CheckPoints;   // check that every point is a destination feMove accepts
+  BOOL CheckMoves;    // also check that feMove finds a path for every move
+  BOOL DropInvalid;   // remove the points that fail, and the points feMove cannot get to
+  BOOL RerouteMoves;  // make moves without a path over the top, through a waypoint above the start
+} SCAN_VALIDATION;
+
+typedef struct {
+  INT InvalidPoints;  // found in the path as generated
+  INT InvalidMoves;
+  INT DroppedPoints;
+  INT ReroutedMoves;
+  INT StillInvalid;   // invalid points and moves left in the path that will be scanned
+  INT FirstInvalid;   // first point of that path that is invalid or cannot be got to, -1 if none
+} SCAN_VALIDATION_SUMMARY;
 
 class ScanSequence {
   
@@ -14,10 +34,25 @@ public:
   void Init(SCAN_SETTINGS &fs_in, float* gantryLim);
   
   //
-  int GeneratePath(std::vector<std::vector<double> > &points_in);
+  int GeneratePath(ScanPoints &points_in);
   
   // Helper functions
   int GetMeasTime(){ return fs.meas_time; };
+
+  // Plan file with the path of manual scans, made with make_scan_plan.py
+  void SetManualPlan(const char *path){ fManualPlan = path; };
+
+  // Checks the first numPoints points against the collision model of feMove (see TScanValidator), starting
+  // from the gantry positions start, and reports the points and moves feMove would refuse.
+  // Depending on the options the path is then changed: waypoints[i] is set for the points that were added to
+  // reroute a move, which are only passed through. Returns the number of points in the path.
+  int ValidatePath(ScanPoints &points, int numPoints, std::vector<char> &waypoints, const float *start,
+                   const COLLISION_SETTINGS &collision, const SCAN_VALIDATION &options,
+                   SCAN_VALIDATION_SUMMARY *summary);
+
+  // Identifies everything GeneratePath depends on (settings, gantry limits, manual path),
+  // so a saved plan is only reused for the same scan. See ScanPlan.hxx.
+  uint32_t SettingsHash();
   
   
 private:
@@ -29,16 +64,16 @@ private:
    *                                                Loops in h, fix phi and r: big circles
    *                                                Fixed point
    */
-  int CylinderPath(std::vector<std::vector<double> > &points);
-  int RectangularPath(std::vector<std::vector<double> > &points);
-  int PMTSurfacePath(std::vector<std::vector<double> > &points);
-  int AlignmentPath(std::vector<std::vector<double> > &points);
-  int PassByPath(std::vector<std::vector<double> > &points);
-  int ManualPath(std::vector<std::vector<double> > &points);
-  int TankAvoidancePath(std::vector<std::vector<double> > &points);
-  int DemoPath(std::vector<std::vector<double> > &points);
+  int CylinderPath(ScanPoints &points);
+  int RectangularPath(ScanPoints &points);
+  int PMTSurfacePath(ScanPoints &points);
+  int AlignmentPath(ScanPoints &points);
+  int PassByPath(ScanPoints &points);
+  int ManualPath(ScanPoints &points);
+  int TankAvoidancePath(ScanPoints &points);
+  int DemoPath(ScanPoints &points);
   
-  void ReturnToBase(std::vector<std::vector<double> > &points);
+  void ReturnToBase(ScanPoints &points);
 
   // ToDo : the above ones can call the Reflectivity function, for a reflectivity sequence for each point
   // Probably very similar to acceptance with two heads....both pointing at the PMT center...
@@ -49,6 +84,16 @@ private:
   // Probably overload this: first version: getting a point in space, normal to surface 
   // goes through that point and the center of the local sphere.
   void CalculateNormIncidence(std::vector<double> &point, double center_x, double center_y, double beam, double incidence, double azimuth, gantry_t gantry);
+  // Batch version for n points on the PMT at (point_x[i], point_y[i]), all with the same beam, incidence and
+  // azimuth: fills the preallocated gantry_x ... tilt with n values each. Much faster than point by point.
+  void CalculateNormIncidence(int n, const double *point_x, const double *point_y, double center_x, double center_y,
+                              double beam, double incidence, double azimuth, gantry_t gantry,
+                              double *gantry_x, double *gantry_y, double *gantry_z, double *rotation, double *tilt);
+  // Normal incidence for the x-y grid of a rectangular scan with grid_x * grid_y points
+  void NormIncidenceGrid(gantry_t gantry, int grid_x, int grid_y, std::vector<double> &grid);
+  // Puts a result of CalculateNormIncidence into a point, with the other gantry out of the way
+  void SetNormIncidencePoint(std::vector<double> &point, gantry_t gantry, double x, double y, double z,
+                             double rotation, double tilt);
   // second version: if the point in space by itself depends on the rotation and tilt.
   //void CalculateNormIncidence(double &rotation, double &tilt, double x_pos, double y_pos, double z_pos);
 
@@ -69,6 +114,8 @@ private:
   // NOW: do a resize beforehand for more efficient mem usage..
   int point_num;
   float z_max_value;
+
+  std::string fManualPlan;
   
 };
 
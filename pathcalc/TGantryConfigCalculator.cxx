@@ -11,7 +11,6 @@
 \********************************************************************/
 
 #include "TGantryConfigCalculator.hxx"
-#include "midas.h" // for logging
 
 
 //----------------------------------------------------------
@@ -29,11 +28,79 @@ TGantryConfigCalculator::TGantryConfigCalculator(double tiltMotor, double gFront
 }
 
 
+// The single pose versions go through the batch versions with n = 1, so both always agree.
 //----------------------------------------------------------
 XYPolygon TGantryConfigCalculator::GetGantryConfig(int whichGantry, double rot, double tilt, double xPos, double yPos) {
 //----------------------------------------------------------
 
+  double gantryXDimensions[4];
+  double gantryYDimensions[4];
+  double *cornerX[4];
+  double *cornerY[4];
+  for (int i = 0; i < 4; ++i) {
+    cornerX[i] = &gantryXDimensions[i];
+    cornerY[i] = &gantryYDimensions[i];
+  }
+
+  GetGantryConfig(whichGantry, 1, &rot, &tilt, &xPos, &yPos, cornerX, cornerY);
+
   XYPolygon gantryConfig;
+  for (int i = 0; i < 4; ++i) {
+    gantryConfig.push_back(std::make_pair(gantryXDimensions[i], gantryYDimensions[i]));
+  }
+
+  return gantryConfig;
+
+}
+
+
+//----------------------------------------------------------
+std::pair <XYPolygon, XYPolygon>
+TGantryConfigCalculator::GetOpticalBoxConfig(int whichGantry, double rot, double tilt, double xPos, double yPos) {
+//----------------------------------------------------------
+
+  double boxXDimensions[8];
+  double boxYDimensions[8];
+  double *cornerX[8];
+  double *cornerY[8];
+  for (int i = 0; i < 8; ++i) {
+    cornerX[i] = &boxXDimensions[i];
+    cornerY[i] = &boxYDimensions[i];
+  }
+
+  GetOpticalBoxConfig(whichGantry, 1, &rot, &tilt, &xPos, &yPos, cornerX, cornerY);
+
+  XYPolygon boxConfig_lo;
+  XYPolygon boxConfig_up;
+  for (int i = 0; i < 4; ++i) {
+    boxConfig_lo.push_back(std::make_pair(boxXDimensions[i], boxYDimensions[i]));
+    boxConfig_up.push_back(std::make_pair(boxXDimensions[i + 4], boxYDimensions[i + 4]));
+  }
+
+  return std::make_pair(boxConfig_lo, boxConfig_up);
+
+}
+
+
+//----------------------------------------------------------
+std::pair<double, double> TGantryConfigCalculator::GetOpticalBoxZ(int whichGantry, double tilt, double zPos) {
+//----------------------------------------------------------
+
+  double z_opticalBoxLowerSurface;
+  double z_opticalBoxUpperSurface;
+
+  GetOpticalBoxZ(whichGantry, 1, &tilt, &zPos, &z_opticalBoxLowerSurface, &z_opticalBoxUpperSurface);
+
+  return std::make_pair(z_opticalBoxLowerSurface, z_opticalBoxUpperSurface);
+
+}
+
+
+//----------------------------------------------------------
+void TGantryConfigCalculator::GetGantryConfig(int whichGantry, int n, const double *rot, const double *tilt,
+                                              const double *xPos, const double *yPos, double *cornerX[4],
+                                              double *cornerY[4]) {
+//----------------------------------------------------------
 
   // Gantry dimensions:
   double front_tiltMotor = tiltMotorLength;
@@ -42,9 +109,6 @@ XYPolygon TGantryConfigCalculator::GetGantryConfig(int whichGantry, double rot,
   double right = gantryTiltGearWidth;
   double height = gantryOpticalBoxHeight;
 
-  double gantryXDimensions[4];
-  double gantryYDimensions[4];
-
   if (whichGantry == 1) { // Gantry 1 is rotated 180 degrees compared to Gantry 0
     front_tiltMotor *= -1;
     back *= -1;
@@ -53,38 +117,42 @@ XYPolygon TGantryConfigCalculator::GetGantryConfig(int whichGantry, double rot,
     height *= -1;
   }
 
+  double *x0 = cornerX[0], *x1 = cornerX[1], *x2 = cornerX[2], *x3 = cornerX[3];
+  double *y0 = cornerY[0], *y1 = cornerY[1], *y2 = cornerY[2], *y3 = cornerY[3];
+
   // Calculating gantry configuration, including tilt motor at the top
-  gantryXDimensions[0] = front_tiltMotor * cos(rot) + right * sin(rot);
-  gantryYDimensions[0] = front_tiltMotor * sin(rot) - right * cos(rot);
+  for (int i = 0; i < n; ++i) {
+    double cosRot = cos(rot[i]);
+    double sinRot = sin(rot[i]);
+    double cosTilt = cos(tilt[i]);
+    double sinTilt = sin(tilt[i]);
 
-  gantryXDimensions[1] = front_tiltMotor * cos(rot) - left * sin(rot);
-  gantryYDimensions[1] = front_tiltMotor * sin(rot) + left * cos(rot);
+    // back of the gantry, which moves with the tilt
+    double backX = (-1) * back * cosRot * cosTilt + height * cosRot * sinTilt;
+    double backY = (-1) * back * sinRot * cosTilt + height * sinRot * sinTilt;
 
-  gantryXDimensions[2] = (-1) * back * cos(rot) * cos(tilt) - left * sin(rot) + height * cos(rot) * sin(tilt);
-  gantryYDimensions[2] = (-1) * back * sin(rot) * cos(tilt) + left * cos(rot) + height * sin(rot) * sin(tilt);
+    x0[i] = front_tiltMotor * cosRot + right * sinRot + xPos[i];
+    y0[i] = front_tiltMotor * sinRot - right * cosRot + yPos[i];
 
-  gantryXDimensions[3] = (-1) * back * cos(rot) * cos(tilt) + right * sin(rot) + height * cos(rot) * sin(tilt);
-  gantryYDimensions[3] = (-1) * back * sin(rot) * cos(tilt) - right * cos(rot) + height * sin(rot) * sin(tilt);
+    x1[i] = front_tiltMotor * cosRot - left * sinRot + xPos[i];
+    y1[i] = front_tiltMotor * sinRot + left * cosRot + yPos[i];
 
-  gantryConfig.clear();
+    x2[i] = backX - left * sinRot + xPos[i];
+    y2[i] = backY + left * cosRot + yPos[i];
 
-  for (int i = 0; i < 4; ++i) {
-    gantryConfig.push_back(std::make_pair(gantryXDimensions[i] + xPos, gantryYDimensions[i] + yPos));
+    x3[i] = backX + right * sinRot + xPos[i];
+    y3[i] = backY - right * cosRot + yPos[i];
   }
 
-  return gantryConfig;
-
 }
 
 
 //----------------------------------------------------------
-std::pair <XYPolygon, XYPolygon>
-TGantryConfigCalculator::GetOpticalBoxConfig(int whichGantry, double rot, double tilt, double xPos, double yPos) {
+void TGantryConfigCalculator::GetOpticalBoxConfig(int whichGantry, int n, const double *rot, const double *tilt,
+                                                  const double *xPos, const double *yPos, double *cornerX[8],
+                                                  double *cornerY[8]) {
 //----------------------------------------------------------
 
-  XYPolygon boxConfig_lo;
-  XYPolygon boxConfig_up;
-
   // Optical box dimensions:
   double front = gantryFrontHalfLength;
   double back = gantryBackHalfLength;
@@ -92,9 +160,6 @@ TGantryConfigCalculator::GetOpticalBoxConfig(int whichGantry, double rot, double
   double right = gantryTiltGearWidth;
   double height = gantryOpticalBoxHeight;
 
-  double boxXDimensions[8];
-  double boxYDimensions[8];
-
   if (whichGantry == 1) {
     front *= -1;
     back *= -1;
@@ -104,42 +169,37 @@ TGantryConfigCalculator::GetOpticalBoxConfig(int whichGantry, double rot, double
   }
 
   //Calculating optical box configuration
-  boxXDimensions[0] = front * cos(rot) * cos(tilt) + right * sin(rot) + height * cos(rot) * sin(tilt);
-  boxYDimensions[0] = front * sin(rot) * cos(tilt) - right * cos(rot) + height * sin(rot) * sin(tilt);
-
-  boxXDimensions[1] = front * cos(rot) * cos(tilt) - left * sin(rot) + height * cos(rot) * sin(tilt);
-  boxYDimensions[1] = front * sin(rot) * cos(tilt) + left * cos(rot) + height * sin(rot) * sin(tilt);
-
-  boxXDimensions[2] = (-1) * back * cos(rot) * cos(tilt) - left * sin(rot) + height * cos(rot) * sin(tilt);
-  boxYDimensions[2] = (-1) * back * sin(rot) * cos(tilt) + left * cos(rot) + height * sin(rot) * sin(tilt);
-
-  boxXDimensions[3] = (-1) * back * cos(rot) * cos(tilt) + right * sin(rot) + height * cos(rot) * sin(tilt);
-  boxYDimensions[3] = (-1) * back * sin(rot) * cos(tilt) - right * cos(rot) + height * sin(rot) * sin(tilt);
-
-  boxXDimensions[4] = front * cos(rot) * cos(tilt) + right * sin(rot);
-  boxYDimensions[4] = front * sin(rot) * cos(tilt) - right * cos(rot);
-
-  boxXDimensions[5] = front * cos(rot) * cos(tilt) - left * sin(rot);
-  boxYDimensions[5] = front * sin(rot) * cos(tilt) + left * cos(rot);
-
-  boxXDimensions[6] = (-1) * back * cos(rot) * cos(tilt) - left * sin(rot);
-  boxYDimensions[6] = (-1) * back * sin(rot) * cos(tilt) + left * cos(rot);
-
-  boxXDimensions[7] = (-1) * back * cos(rot) * cos(tilt) + right * sin(rot);
-  boxYDimensions[7] = (-1) * back * sin(rot) * cos(tilt) - right * cos(rot);
-
-  for (int i = 0; i < 4; ++i) {
-    boxConfig_lo.push_back(std::make_pair(boxXDimensions[i] + xPos, boxYDimensions[i] + yPos));
-    boxConfig_up.push_back(std::make_pair(boxXDimensions[i + 4] + xPos, boxYDimensions[i + 4] + yPos));
+  for (int i = 0; i < n; ++i) {
+    double cosRot = cos(rot[i]);
+    double sinRot = sin(rot[i]);
+    double cosTilt = cos(tilt[i]);
+    double sinTilt = sin(tilt[i]);
+
+    // front and back of the box on the upper surface, and the offset of the lower surface from the upper one
+    double frontX = front * cosRot * cosTilt;
+    double frontY = front * sinRot * cosTilt;
+    double backX = (-1) * back * cosRot * cosTilt;
+    double backY = (-1) * back * sinRot * cosTilt;
+    double heightX = height * cosRot * sinTilt;
+    double heightY = height * sinRot * sinTilt;
+
+    double upX[4] = {frontX + right * sinRot, frontX - left * sinRot, backX - left * sinRot, backX + right * sinRot};
+    double upY[4] = {frontY - right * cosRot, frontY + left * cosRot, backY + left * cosRot, backY - right * cosRot};
+
+    for (int c = 0; c < 4; ++c) {
+      cornerX[c][i] = upX[c] + heightX + xPos[i];
+      cornerY[c][i] = upY[c] + heightY + yPos[i];
+      cornerX[c + 4][i] = upX[c] + xPos[i];
+      cornerY[c + 4][i] = upY[c] + yPos[i];
+    }
   }
 
-  return std::make_pair(boxConfig_lo, boxConfig_up);
-
 }
 
 
 //----------------------------------------------------------
-std::pair<double, double> TGantryConfigCalculator::GetOpticalBoxZ(int whichGantry, double tilt, double zPos) {
+void TGantryConfigCalculator::GetOpticalBoxZ(int whichGantry, int n, const double *tilt, const double *zPos,
+                                             double *zLower, double *zUpper) {
 //----------------------------------------------------------
 
   // Optical box dimensions:
@@ -147,17 +207,15 @@ std::pair<double, double> TGantryConfigCalculator::GetOpticalBoxZ(int whichGantr
   double back = gantryBackHalfLength;
   double height = gantryOpticalBoxHeight;
 
-  double z_opticalBoxLowerSurface = gantryOpticalBoxHeight;
-  double z_opticalBoxUpperSurface = 0.0;
+  for (int i = 0; i < n; ++i) {
+    double sinTilt = sin(tilt[i]);
+    double cosTilt = cos(tilt[i]);
 
-  if (tilt < 0) {
-    z_opticalBoxLowerSurface = (-1) * front * sin(tilt) + height * cos(tilt);
-    z_opticalBoxUpperSurface = (-1) * front * sin(tilt);
-  } else {
-    z_opticalBoxLowerSurface = back * sin(tilt) + height * cos(tilt);
-    z_opticalBoxUpperSurface = back * sin(tilt);
-  }
+    // tilted down, the front is lowest; tilted up, the back
+    double length = (tilt[i] < 0) ? (-1) * front : back;
 
-  return std::make_pair(z_opticalBoxLowerSurface + zPos, z_opticalBoxUpperSurface + zPos);
+    zUpper[i] = length * sinTilt + zPos[i];
+    zLower[i] = zUpper[i] + height * cosTilt;
+  }
 
 }
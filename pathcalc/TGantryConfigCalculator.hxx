@@ -100,6 +100,24 @@ public:
      **/
     std::pair<double, double> GetOpticalBoxZ(int whichGantry, double tilt, double zPos);
 
+    /**
+     * Batch versions of the above, for n poses at once.
+     *
+     * The poses and the results are stored as one array per quantity (structure of arrays), all provided
+     * by the caller and at least n long: pose i is (rot[i], tilt[i], xPos[i], yPos[i]), and corner c of
+     * pose i is at (cornerX[c][i], cornerY[c][i]), with the corners numbered as above.
+     * Nothing is allocated, and sin & cos are worked out once per pose and shared by all its corners.
+     **/
+    void GetGantryConfig(int whichGantry, int n, const double *rot, const double *tilt, const double *xPos,
+                         const double *yPos, double *cornerX[4], double *cornerY[4]);
+
+    // Corners 0-3 are the lower surface, 4-7 the upper surface.
+    void GetOpticalBoxConfig(int whichGantry, int n, const double *rot, const double *tilt, const double *xPos,
+                             const double *yPos, double *cornerX[8], double *cornerY[8]);
+
+    void GetOpticalBoxZ(int whichGantry, int n, const double *tilt, const double *zPos, double *zLower,
+                        double *zUpper);
+
 private:
     // Store gantry dimensions here:
     double tiltMotorLength;
@@ -1,4 +1,7 @@
 #include "TPathCalculator.hxx"
+#include "PathGeometry.hxx"
+#include <algorithm>
+#include <cmath>
 #include "midas.h" // for logging
 
 
@@ -7,19 +10,14 @@ TPathCalculator::TPathCalculator(double tankCentreXPos, double tankCentreYPos, d
                                  double tankPMTholderRadius) {
 //----------------------------------------------------------
 
-  fObject0 = new BoostPolygon();
-  fObject1 = new BoostPolygon();
-  fOpticalBox0_lo = new BoostPolygon();
-  fOpticalBox0_up = new BoostPolygon();
-  fOpticalBox1_lo = new BoostPolygon();
-  fOpticalBox1_up = new BoostPolygon();
-
   //tank boundaries
   Xcent = tankCentreXPos;
   Ycent = tankCentreYPos;
   tRadius = tankRadius;
   tPMTholder = tankPMTholderRadius; // max/min from center where PMT holders sit
 
+  fStationaryPath.push_back(std::make_pair(0.0, 0.0));
+  fVerbose = true;
 
 }
 
@@ -28,9 +26,12 @@ void TPathCalculator::InitialiseGantries(XYPolygon points0, XYPolygon points1) {
 //----------------------------------------------------------
 
   //cm_msg(MINFO,"InitialiseGantries"," Gantry 0: ");
-  CreatePolygon(fObject0, points0);
+  CreatePolygon(&fObject0, points0);
   //cm_msg(MINFO,"InitialiseGantries"," Gantry 1: ");
-  CreatePolygon(fObject1, points1);
+  CreatePolygon(&fObject1, points1);
+
+  boost::geometry::envelope(fObject0, fObjectBox0);
+  boost::geometry::envelope(fObject1, fObjectBox1);
 
 }
 
@@ -45,11 +46,11 @@ void TPathCalculator::InitialiseOpticalBoxes(XYPolygon points0_lo, XYPolygon poi
   height_OpticalBox1_up = z1_up;
 
   //cm_msg(MINFO,"InitialiseOpticalBoxes"," Optical Box 0: z height = %i cm below PMT cover top.", height_OpticalBox0_lo);
-  CreatePolygon(fOpticalBox0_lo, points0_lo);
-  CreatePolygon(fOpticalBox0_up, points0_up);
+  CreatePolygon(&fOpticalBox0_lo, points0_lo);
+  CreatePolygon(&fOpticalBox0_up, points0_up);
   //cm_msg(MINFO,"InitialiseOpticalBoxes"," Optical Box 1: z height = %i cm below PMT cover top.", height_OpticalBox1_lo);
-  CreatePolygon(fOpticalBox1_lo, points1_lo);
-  CreatePolygon(fOpticalBox1_up, points1_up);
+  CreatePolygon(&fOpticalBox1_lo, points1_lo);
+  CreatePolygon(&fOpticalBox1_up, points1_up);
 
 }
 
@@ -58,25 +59,42 @@ void TPathCalculator::InitialiseOpticalBoxes(XYPolygon points0_lo, XYPolygon poi
 // (21Mar2017): updated to take std::vector< XYPolygon > as argument;
 // i.e. a vector of polygons;
 // and loop through the vector to build polygons.
+// The layers are now circles given by their radius, which are checked exactly instead of through polygons.
 //----------------------------------------------------------
-void TPathCalculator::InitialisePMT(std::vector <XYPolygon> pmt0, std::vector <XYPolygon> pmt1) {
+void TPathCalculator::InitialisePMT(XYPoint centre0, XYPoint centre1, std::vector<double> layerRadius) {
 //----------------------------------------------------------
 
-  for (int i = 0; i < pmt0.size(); ++i) {
-    if (i >= fPMTmultiPoly0.size()) {
-      fPMTmultiPoly0.push_back(new BoostPolygon());
-    }
-    CreatePolygon(fPMTmultiPoly0.at(i), pmt0.at(i));
-  }
-  for (int j = 0; j < pmt1.size(); ++j) {
-    if (j >= fPMTmultiPoly1.size()) {
-      fPMTmultiPoly1.push_back(new BoostPolygon());
-    }
-    CreatePolygon(fPMTmultiPoly1.at(j), pmt1.at(j));
+  InitialisePMT(0, centre0, layerRadius);
+  InitialisePMT(1, centre1, layerRadius);
+
+}
+
+//----------------------------------------------------------
+void TPathCalculator::InitialisePMT(int pmt, XYPoint centre, const std::vector<double> &layerRadius) {
+//----------------------------------------------------------
+
+  if (pmt == 0) {
+    fPMTCentre0 = centre;
+    fPMTRadius0 = layerRadius;
+  } else {
+    fPMTCentre1 = centre;
+    fPMTRadius1 = layerRadius;
   }
 
 }
 
+//----------------------------------------------------------
+void TPathCalculator::InitialiseTank(double tankCentreXPos, double tankCentreYPos, double tankRadius,
+                                     double tankPMTholderRadius) {
+//----------------------------------------------------------
+
+  Xcent = tankCentreXPos;
+  Ycent = tankCentreYPos;
+  tRadius = tankRadius;
+  tPMTholder = tankPMTholderRadius;
+
+}
+
 // Rika (16Mar2017):
 // New CalculatePath function to complement the change in arguments passed to CheckPathForCollisions.
 // PMT collision avoidance added.
@@ -85,19 +103,21 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
                                     std::pair<bool, bool> tank_height_start, std::pair<bool, bool> tank_height_end) {
 //----------------------------------------------------------
 
-  cm_msg(MINFO, "CalculatePath", "Calculating path from %.3lf in X to %.3lf and from %.3lf in Y to %.3lf", start.first,
-         end.first, start.second, end.second);
+  if (fVerbose) {
+    cm_msg(MINFO, "CalculatePath", "Calculating path from %.3lf in X to %.3lf and from %.3lf in Y to %.3lf",
+           start.first, end.first, start.second, end.second);
+  }
 
   bool isObject0 = 1;
   bool validEndPoint = 0;
   bool goodPath = 0;
 
-  isObject0 = boost::geometry::within(boost::geometry::make<BoostPoint>(start.first, start.second), *fObject0);
+  isObject0 = boost::geometry::within(boost::geometry::make<BoostPoint>(start.first, start.second), fObject0);
 
   if (isObject0) {
-    validEndPoint = !boost::geometry::within(boost::geometry::make<BoostPoint>(end.first, end.second), *fObject1);
+    validEndPoint = !boost::geometry::within(boost::geometry::make<BoostPoint>(end.first, end.second), fObject1);
   } else {
-    validEndPoint = !boost::geometry::within(boost::geometry::make<BoostPoint>(end.first, end.second), *fObject0);
+    validEndPoint = !boost::geometry::within(boost::geometry::make<BoostPoint>(end.first, end.second), fObject0);
   }
 
   if (!validEndPoint) {
@@ -111,7 +131,8 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
 
     // Check path does not collide with other objects
 
-    goodPath = CheckPathForCollisions(fObject0, fObject1, path, tank_height_start.first, tank_height_end.first);
+    goodPath = CheckPathForCollisions(&fObject0, &fObject1, path, tank_height_start.first, tank_height_end.first,
+                                      &fObjectBox1);
     /**
     if(!goodPath){ // FOR DEBUGGING
         cm_msg(MINFO,"CalculatePath"," Gantry 0 moving in x first will collide with Gantry 1 or with tank.");
@@ -123,12 +144,12 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
     // Temporarily disabling
     /*
     if (goodPath && height_OpticalBox0_lo >= 0) {
-      goodPath = CheckPathForCollisions(fOpticalBox0_lo, fPMTmultiPoly0.at(height_OpticalBox0_lo), path,
-                                        tank_height_start.first, tank_height_end.first);
+      goodPath = CheckPathForPMT(&fOpticalBox0_lo, 0, height_OpticalBox0_lo, path, tank_height_start.first,
+                                 tank_height_end.first);
     }
     if (goodPath && height_OpticalBox0_up >= 0) {
-      goodPath = CheckPathForCollisions(fOpticalBox0_up, fPMTmultiPoly0.at(height_OpticalBox0_up), path,
-                                        tank_height_start.first, tank_height_end.first);
+      goodPath = CheckPathForPMT(&fOpticalBox0_up, 0, height_OpticalBox0_up, path, tank_height_start.first,
+                                 tank_height_end.first);
     }
     */
 
@@ -146,7 +167,8 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
     } else {
       CreatePath(start.first, start.second, end.first, end.second, path, 0, false);
 
-      goodPath = CheckPathForCollisions(fObject0, fObject1, path, tank_height_start.first, tank_height_end.first);
+      goodPath = CheckPathForCollisions(&fObject0, &fObject1, path, tank_height_start.first, tank_height_end.first,
+                                      &fObjectBox1);
 
       /**
       if(!goodPath){ // FOR DEBUGGING
@@ -157,12 +179,12 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
       // Temporarily disabling
       /*
       if (goodPath && height_OpticalBox0_lo >= 0) {
-        goodPath = CheckPathForCollisions(fOpticalBox0_lo, fPMTmultiPoly0.at(height_OpticalBox0_lo), path,
-                                          tank_height_start.first, tank_height_end.first);
+        goodPath = CheckPathForPMT(&fOpticalBox0_lo, 0, height_OpticalBox0_lo, path, tank_height_start.first,
+                                   tank_height_end.first);
       }
       if (goodPath && height_OpticalBox0_up >= 0) {
-        goodPath = CheckPathForCollisions(fOpticalBox0_up, fPMTmultiPoly0.at(height_OpticalBox0_up), path,
-                                          tank_height_start.first, tank_height_end.first);
+        goodPath = CheckPathForPMT(&fOpticalBox0_up, 0, height_OpticalBox0_up, path, tank_height_start.first,
+                                   tank_height_end.first);
       }
       */
     }
@@ -183,7 +205,8 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
     // Create path doing X steps first
     CreatePath(start.first, start.second, end.first, end.second, path, 1, false);
 
-    goodPath = CheckPathForCollisions(fObject1, fObject0, path, tank_height_start.second, tank_height_end.second);
+    goodPath = CheckPathForCollisions(&fObject1, &fObject0, path, tank_height_start.second, tank_height_end.second,
+                                      &fObjectBox0);
 
     /**
     if(!goodPath){ // FOR DEBUGGING
@@ -196,12 +219,12 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
     // Temporarily disabling
     /*
     if (goodPath && height_OpticalBox1_lo >= 0) {
-      goodPath = CheckPathForCollisions(fOpticalBox1_lo, fPMTmultiPoly1.at(height_OpticalBox1_lo), path,
-                                        tank_height_start.second, tank_height_end.second);
+      goodPath = CheckPathForPMT(&fOpticalBox1_lo, 1, height_OpticalBox1_lo, path, tank_height_start.second,
+                                 tank_height_end.second);
     }
     if (goodPath && height_OpticalBox1_up >= 0) {
-      goodPath = CheckPathForCollisions(fOpticalBox1_up, fPMTmultiPoly1.at(height_OpticalBox1_up), path,
-                                        tank_height_start.second, tank_height_end.second);
+      goodPath = CheckPathForPMT(&fOpticalBox1_up, 1, height_OpticalBox1_up, path, tank_height_start.second,
+                                 tank_height_end.second);
     }
     */
     /**
@@ -218,7 +241,8 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
     } else {
       CreatePath(start.first, start.second, end.first, end.second, path, 0, false);
 
-      goodPath = CheckPathForCollisions(fObject1, fObject0, path, tank_height_start.second, tank_height_end.second);
+      goodPath = CheckPathForCollisions(&fObject1, &fObject0, path, tank_height_start.second, tank_height_end.second,
+                                      &fObjectBox0);
 
       /**
       if(!goodPath){ // FOR DEBUGGING
@@ -227,12 +251,12 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
       **/
 
       if (goodPath && height_OpticalBox1_lo >= 0) {
-        goodPath = CheckPathForCollisions(fOpticalBox1_lo, fPMTmultiPoly1.at(height_OpticalBox1_lo), path,
-                                          tank_height_start.second, tank_height_end.second);
+        goodPath = CheckPathForPMT(&fOpticalBox1_lo, 1, height_OpticalBox1_lo, path, tank_height_start.second,
+                                   tank_height_end.second);
       }
       if (goodPath && height_OpticalBox1_up >= 0) {
-        goodPath = CheckPathForCollisions(fOpticalBox1_up, fPMTmultiPoly1.at(height_OpticalBox1_up), path,
-                                          tank_height_start.second, tank_height_end.second);
+        goodPath = CheckPathForPMT(&fOpticalBox1_up, 1, height_OpticalBox1_up, path, tank_height_start.second,
+                                   tank_height_end.second);
       }
     }
     /**
@@ -252,16 +276,10 @@ bool TPathCalculator::CalculatePath(XYPoint start, XYPoint end, std::vector <XYP
 bool TPathCalculator::CheckDestination(XYPolygon points0, XYPolygon points1, bool tank_height_end) {
 //----------------------------------------------------------
 
-  BoostPolygon obj0;
-  BoostPolygon obj1;
-
-  std::vector <XYPoint> stationaryPath;
-
-  CreatePolygon(&obj0, points0);
-  CreatePolygon(&obj1, points1);
-  stationaryPath.push_back(std::make_pair(0.0, 0.0));
+  CreatePolygon(&fDestination0, points0);
+  CreatePolygon(&fDestination1, points1);
 
-  return CheckPathForCollisions(&obj0, &obj1, stationaryPath, tank_height_end, tank_height_end);
+  return CheckPathForCollisions(&fDestination0, &fDestination1, fStationaryPath, tank_height_end, tank_height_end);
 
   /**
   bool validDestination = true;
@@ -286,6 +304,16 @@ return validDestination;
   **/
 }
 
+//----------------------------------------------------------
+bool TPathCalculator::CheckDestination(XYPolygon points, int pmt, int layer, bool tank_height_end) {
+//----------------------------------------------------------
+
+  CreatePolygon(&fDestination0, points);
+
+  return CheckPathForPMT(&fDestination0, pmt, layer, fStationaryPath, tank_height_end, tank_height_end);
+
+}
+
 //----------------------------------------------------------
 void TPathCalculator::CreatePath(double startX, double startY, double endX, double endY, std::vector <XYPoint> &path,
                                  bool xFirst, bool simplePath) {
@@ -358,56 +386,107 @@ void TPathCalculator::CreatePolygon(BoostPolygon *object, XYPolygon points) {
 }
 
 // Rika (16Mar2017): CheckPathForCollisions updated to take pointers to the two objects to be compared
-// (either gantry-gantry or opticalBox-PMT).
+// (either gantry-gantry or opticalBox-PMT). The optical box-to-PMT checks are now done by CheckPathForPMT.
 // Rika (23Mar2017): Updated function to take in only one tank_height_* variable for z position information
 // corresponding to objectMoving only (previously a vector was passed, containing info for both gantries).
 //----------------------------------------------------------
 bool TPathCalculator::CheckPathForCollisions(BoostPolygon *objectMoving, BoostPolygon *objectStationary,
                                              std::vector <XYPoint> &path, bool tank_height_start,
-                                             bool tank_height_end) {
+                                             bool tank_height_end, const BoostBox *stationaryBox) {
 //----------------------------------------------------------
 
-  double Xdif;
-  double Ydif;
+  return CheckSweptPath(objectMoving, path, tank_height_start, tank_height_end, objectStationary, stationaryBox,
+                        XYPoint(0, 0), 0);
+
+}
+
+// The layer is a circle, so the swept area is checked with polygon_intersects_circle (PathGeometry.hxx) instead of
+// boost::geometry::intersects, after the same bounding box quick reject.
+//----------------------------------------------------------
+bool TPathCalculator::CheckPathForPMT(BoostPolygon *objectMoving, int pmt, int layer, std::vector <XYPoint> &path,
+                                      bool tank_height_start, bool tank_height_end) {
+//----------------------------------------------------------
 
-  double Maxval = tRadius;
-  double Ydifmax = tPMTholder; // max/min from center where PMT holders sit
+  const XYPoint &centre = (pmt == 0) ? fPMTCentre0 : fPMTCentre1;
+  const double radius = ((pmt == 0) ? fPMTRadius0 : fPMTRadius1).at(layer);
 
-  std::vector <BoostPoint> objectPoints = objectMoving->outer();
+  BoostBox circleBox(BoostPoint(centre.first - radius, centre.second - radius),
+                     BoostPoint(centre.first + radius, centre.second + radius));
 
-  // Collision check agaisnt tank:
-  for (int iter = 0; iter < (int) path.size(); ++iter) {
-    bool collides_tank = 0;
-    bool collides_obj = 0;
+  return CheckSweptPath(objectMoving, path, tank_height_start, tank_height_end, NULL, &circleBox, centre, radius);
 
+}
+
+// The moving polygon is now swept along each segment of the path instead of being checked at every step only.
+// A convex polygon covers exactly the convex hull of its start and end positions while it translates, so
+// one hull per straight run of identical steps replaces the per-step checks and also covers the travel in between.
+// The tank region (disk cut by the PMT holders) is convex too, so the vertexes at the end of each segment are
+// enough for the tank check; the start of each segment was the end of the one before.
+// If the bounding box of objectStationary is given, segments whose own bounding box is clear of it are not
+// checked any further.
+//----------------------------------------------------------
+bool TPathCalculator::CheckSweptPath(BoostPolygon *objectMoving, std::vector <XYPoint> &path,
+                                     bool tank_height_start, bool tank_height_end, BoostPolygon *objectStationary,
+                                     const BoostBox *stationaryBox, XYPoint circleCentre, double circleRadius) {
+//----------------------------------------------------------
+
+  // Determine if box moves outside of tank limits. If gantry doesn't move above tank first and if starting height is not outside of tank, must check limits
+  const bool checkTank = !tank_height_end && !tank_height_start;
+  const double Maxval2 = tRadius * tRadius;
+  const double Ydifmax = tPMTholder; // max/min from center where PMT holders sit
+
+  const std::vector <BoostPoint> &objectPoints = objectMoving->outer();
+
+  // offset of the moving polygon at the start of the current segment
+  double offsetX = 0;
+  double offsetY = 0;
+
+  std::vector<XYPoint>::size_type iter = 0;
+  while (iter < path.size()) {
+    // merge the run of identical steps (CreatePath makes 1 mm steps) into one segment
+    double segX = path[iter].first;
+    double segY = path[iter].second;
+    std::vector<XYPoint>::size_type next = iter + 1;
+    while (next < path.size() && path[next] == path[iter]) {
+      segX += path[next].first;
+      segY += path[next].second;
+      ++next;
+    }
+
+    fSweptPoints.clear();
+    BoostBox sweptBox;
+    boost::geometry::assign_inverse(sweptBox);
     for (std::vector<BoostPoint>::size_type i = 0; i < objectPoints.size(); ++i) {
-      double newX = boost::geometry::get<0>(objectPoints[i]) + path[iter].first;
-      double newY = boost::geometry::get<1>(objectPoints[i]) + path[iter].second;
-
-      // std::cout<< "TF DEBUG " << iter << " " << i << " " << newX << " " << newY << " " << path[iter].first << " " << path[iter].second << std::endl;
-      boost::geometry::set<0>(objectPoints[i], newX);
-      boost::geometry::set<1>(objectPoints[i], newY);
-
-      // Determine if box moves outside of tank limits. If gantry doesn't move above tank first and if starting height is not outside of tank, must check limits
-      if (!tank_height_end) {
-        if (!tank_height_start) {
-          if (newX >= Xcent) Xdif = newX - Xcent;
-          else Xdif = Xcent - newX;
-          if (newY >= Ycent) Ydif = newY - Ycent;
-          else Ydif = Ycent - newY;
-          if ((sqrt(Xdif * Xdif + Ydif * Ydif) > Maxval) || (Ydifmax < Ydif)) {
-            collides_tank = true;
-          }
-        }
+      double startX = boost::geometry::get<0>(objectPoints[i]) + offsetX;
+      double startY = boost::geometry::get<1>(objectPoints[i]) + offsetY;
+      double newX = startX + segX;
+      double newY = startY + segY;
+
+      if (checkTank) {
+        double Xdif = newX - Xcent;
+        double Ydif = newY - Ycent;
+        if ((Xdif * Xdif + Ydif * Ydif > Maxval2) || (Ydifmax < fabs(Ydif))) return false;
       }
+
+      fSweptPoints.push_back(XYPoint(startX, startY));
+      fSweptPoints.push_back(XYPoint(newX, newY));
+      boost::geometry::expand(sweptBox, BoostPoint(startX, startY));
+      boost::geometry::expand(sweptBox, BoostPoint(newX, newY));
     }
-    BoostPolygon fTestObject;
 
-    boost::geometry::assign_points(fTestObject, objectPoints);
-    boost::geometry::correct(fTestObject);
-    collides_obj = boost::geometry::intersects(fTestObject, *objectStationary);
+    if (!stationaryBox || boost::geometry::intersects(sweptBox, *stationaryBox)) {
+      swept_hull(fSweptPoints, &fSweptObject);
+      if (objectStationary) {
+        if (boost::geometry::intersects(fSweptObject, *objectStationary)) return false;
+      } else {
+        if (polygon_intersects_circle(fSweptObject, circleCentre, circleRadius)) return false;
+      }
+    }
 
-    if (collides_obj || collides_tank) return false;
+    offsetX += segX;
+    offsetY += segY;
+    iter = next;
   }
   return true;
 }
+
@@ -4,9 +4,11 @@
 #include <boost/geometry/geometry.hpp> 
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/geometries/box.hpp>
 
 typedef boost::geometry::model::d2::point_xy<double> BoostPoint;
 typedef boost::geometry::model::polygon<BoostPoint> BoostPolygon;
+typedef boost::geometry::model::box<BoostPoint> BoostBox;
 
 typedef std::pair<double, double> XYPoint;
 typedef std::vector<XYPoint> XYPolygon;
@@ -21,20 +23,31 @@ class TPathCalculator {
         void InitialiseGantries(XYPolygon points0, XYPolygon points1);
 
         // Input dimensions of the two optical boxes
-        // z0 & z1 relate the optical box heights to the indecies of the corresponding PMT polygon to be compared.
+        // z0 & z1 relate the optical box heights to the indecies of the corresponding PMT layer to be compared.
         // lo & up correspond to the lower and upper surfaces of the optical box.
         void InitialiseOpticalBoxes(XYPolygon points0_lo, XYPolygon points0_up, XYPolygon points1_lo, XYPolygon points1_up, int z0_lo, int z0_up, int z1_lo, int z1_up);
 
         // Input dimensions of PMT
-        // Two models for the PMT, one for each gantry, in case the coordinates are different between the gantries
-        void InitialisePMT(std::vector<XYPolygon> pmt0, std::vector<XYPolygon> pmt1);
+        // Two models for the PMT, one for each gantry, in case the coordinates are different between the gantries.
+        // The PMT is a stack of layers, layer i being a circle of radius layerRadius[i] around the centre;
+        // layer 0 is the top of the PMT.
+        void InitialisePMT(XYPoint centre0, XYPoint centre1, std::vector<double> layerRadius);
+        // Replace the model of one PMT (0 or 1) only, leaving the other untouched
+        void InitialisePMT(int pmt, XYPoint centre, const std::vector<double>& layerRadius);
+
+        // Input dimensions of the water tank, replacing the ones given to the constructor
+        void InitialiseTank(double tankCentreXPos, double tankCentreYPos, double tankRadius, double tankPMTholderRadius);
  
         // Calculate a path between two x,y points that does not create collisions
         // Returns true if this is possible, with the vector 'path' holding the good path
         bool CalculatePath(XYPoint start, XYPoint end, std::vector<XYPoint>& path, std::pair<bool, bool> tank_height_start, std::pair<bool, bool> tank_height_end);
 
+        // Whether CalculatePath logs the path it calculates (default), see TScanValidator for why it may not.
+        void SetVerbose(bool verbose) { fVerbose = verbose; }
+
         // Checks a path to see if it collides with either gantry or the water tank
-        bool CheckPathForCollisions(BoostPolygon* objectMoving, BoostPolygon* objectStationary, std::vector<XYPoint>& path, bool tank_height_start, bool tank_height_end);
+        // stationaryBox, if given, is the bounding box of objectStationary, used to skip the parts of the path far from it
+        bool CheckPathForCollisions(BoostPolygon* objectMoving, BoostPolygon* objectStationary, std::vector<XYPoint>& path, bool tank_height_start, bool tank_height_end, const BoostBox* stationaryBox = NULL);
 
         // Method that creates a possible path between the start and end points
         // TF: added option to avoid unnecessary waypoints for ACTUAL movement
@@ -42,26 +55,51 @@ class TPathCalculator {
 
         // Method that checks destination for optical box-to-PMT collision
         bool CheckDestination(XYPolygon points0, XYPolygon points1, bool tank_height_end);
+        // Same, against layer 'layer' of the PMT model given to InitialisePMT for gantry 'pmt' (0 or 1)
+        bool CheckDestination(XYPolygon points, int pmt, int layer, bool tank_height_end);
+
+        // Checks a path to see if objectMoving collides with layer 'layer' of PMT 'pmt' or with the water tank
+        bool CheckPathForPMT(BoostPolygon* objectMoving, int pmt, int layer, std::vector<XYPoint>& path, bool tank_height_start, bool tank_height_end);
 
     private:
         void CreatePolygon(BoostPolygon* object, XYPolygon points);
 
-        // BOOST Geometry polygons to store the position and dimensions of the gantries and PMT
-        BoostPolygon* fObject0; //Gantry0
-        BoostPolygon* fObject1; //Gantry1
-        BoostPolygon* fOpticalBox0_lo;
-        BoostPolygon* fOpticalBox1_lo;
-        BoostPolygon* fOpticalBox0_up;
-        BoostPolygon* fOpticalBox1_up;
-        std::vector<BoostPolygon*> fPMTmultiPoly0; // PMT position as seen by Gantry 0
-        std::vector<BoostPolygon*> fPMTmultiPoly1; // PMT position as seen by Gantry 1
-
-        int height_OpticalBox0_lo; // Index relating optical box 0 z height to the index in the PMT polygon vector
+        // CheckPathForCollisions and CheckPathForPMT: the swept area of objectMoving is checked against
+        // objectStationary if given, otherwise against the circle of radius circleRadius around circleCentre
+        bool CheckSweptPath(BoostPolygon* objectMoving, std::vector<XYPoint>& path, bool tank_height_start, bool tank_height_end, BoostPolygon* objectStationary, const BoostBox* stationaryBox, XYPoint circleCentre, double circleRadius);
+
+
+        // BOOST Geometry polygons to store the position and dimensions of the gantries
+        BoostPolygon fObject0; //Gantry0
+        BoostPolygon fObject1; //Gantry1
+        BoostBox fObjectBox0; // bounding boxes of the gantries
+        BoostBox fObjectBox1;
+        BoostPolygon fOpticalBox0_lo;
+        BoostPolygon fOpticalBox1_lo;
+        BoostPolygon fOpticalBox0_up;
+        BoostPolygon fOpticalBox1_up;
+
+        // PMT models, see InitialisePMT
+        XYPoint fPMTCentre0; // PMT position as seen by Gantry 0
+        XYPoint fPMTCentre1; // PMT position as seen by Gantry 1
+        std::vector<double> fPMTRadius0; // radius of each layer
+        std::vector<double> fPMTRadius1;
+
+        // Scratch storage, kept between calls so that the checks don't allocate
+        std::vector<XYPoint> fSweptPoints;
+        BoostPolygon fSweptObject;
+        BoostPolygon fDestination0; // CheckDestination
+        BoostPolygon fDestination1;
+        std::vector<XYPoint> fStationaryPath; // a single step of (0,0)
+
+        int height_OpticalBox0_lo; // Index relating optical box 0 z height to the PMT layer
                                    // for collision avoidance calc w/ PMT    
         int height_OpticalBox1_lo;
         int height_OpticalBox0_up;
         int height_OpticalBox1_up;
 
+        bool fVerbose;
+
         // tank dimensions:
         double Xcent;
         double Ycent;
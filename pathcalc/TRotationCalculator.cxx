@@ -1,6 +1,9 @@
 #include "TRotationCalculator.hxx"
+#include "PathGeometry.hxx"
 #include "midas.h" // for logging
 #include "TGantryConfigCalculator.hxx"
+#include <algorithm>
+#include <cmath>
 
 
 //----------------------------------------------------------
@@ -8,9 +11,14 @@ TRotationCalculator::TRotationCalculator(double tiltMotorLength, double gantryFr
                                          double gantryBackHalfLength, double gantryOpticalBoxWidth,
                                          double gantryTiltGearWidth, double gantryOpticalBoxHeight,
                                          double tankCentreXPos, double tankCentreYPos, double tankRadius,
-                                         double tankPMTholderRadius) {
+                                         double tankPMTholderRadius)
+    : fGantryConfigCalc(tiltMotorLength, gantryFrontHalfLength, gantryBackHalfLength, gantryOpticalBoxWidth,
+                        gantryTiltGearWidth, gantryOpticalBoxHeight) {
 //----------------------------------------------------------
 
+  fSweptCheck = true;
+  fVerbose = true;
+
   // gantry dimensions
   tiltMotor = tiltMotorLength;
   gFront = gantryFrontHalfLength;
@@ -31,25 +39,41 @@ TRotationCalculator::TRotationCalculator(double tiltMotorLength, double gantryFr
 // Taken from TPathCalculator.cxx
 // Rika (28Mar2017): Updated to include pmtHeight and pmtPolyLayerHeight.
 //----------------------------------------------------------
-void TRotationCalculator::InitialisePMT(std::vector <XYPolygon> pmt0, std::vector <XYPolygon> pmt1, double height,
-                                        double polygonThickness) {
+void TRotationCalculator::InitialisePMT(XYPoint centre0, XYPoint centre1, std::vector<double> layerRadius,
+                                        double height, double layerThickness) {
 //----------------------------------------------------------
 
-  for (int i = 0; i < pmt0.size(); ++i) {
-    if (i >= fPMTmultiPoly0.size()) {
-      fPMTmultiPoly0.push_back(new BoostPolygon());
-    }
-    CreatePolygon(fPMTmultiPoly0.at(i), pmt0.at(i));
-  }
-  for (int j = 0; j < pmt1.size(); ++j) {
-    if (j >= fPMTmultiPoly1.size()) {
-      fPMTmultiPoly1.push_back(new BoostPolygon());
-    }
-    CreatePolygon(fPMTmultiPoly1.at(j), pmt1.at(j));
-  }
+  InitialisePMT(0, centre0, layerRadius);
+  InitialisePMT(1, centre1, layerRadius);
 
   pmtHeight = height;
-  pmtPolyLayerHeight = polygonThickness;
+  pmtLayerHeight = layerThickness;
+
+}
+
+//----------------------------------------------------------
+void TRotationCalculator::InitialisePMT(int pmt, XYPoint centre, const std::vector<double> &layerRadius) {
+//----------------------------------------------------------
+
+  if (pmt == 0) {
+    fPMTCentre0 = centre;
+    fPMTRadius0 = layerRadius;
+  } else {
+    fPMTCentre1 = centre;
+    fPMTRadius1 = layerRadius;
+  }
+
+}
+
+//----------------------------------------------------------
+void TRotationCalculator::InitialiseTank(double tankCentreXPos, double tankCentreYPos, double tankRadius,
+                                         double tankPMTholderRadius) {
+//----------------------------------------------------------
+
+  Xcent = tankCentreXPos;
+  Ycent = tankCentreYPos;
+  tRadius = tankRadius;
+  tPMTholder = tankPMTholderRadius;
 
 }
 
@@ -65,17 +89,12 @@ bool TRotationCalculator::CalculatePath(XYPoint start0, XYPoint start1, std::pai
                                         std::pair<bool, bool> tank_height_end) {
 //----------------------------------------------------------
 
-  const double pi = boost::math::constants::pi<double>();
-
-  BoostPolygon fGantry0;
-  BoostPolygon fGantry1;
-  BoostPolygon fOpticalBox0_lo;
-  BoostPolygon fOpticalBox0_up;
-  BoostPolygon fOpticalBox1_lo;
-  BoostPolygon fOpticalBox1_up;
+  if (fSweptCheck) {
+    return CalculateSweptPath(start0, start1, rotationPath0, rotationPath1, tiltPath0, tiltPath1, tank_height_start,
+                              tank_height_end);
+  }
 
-  TGantryConfigCalculator gantryConfigCalc(tiltMotor, gFront, gBack, gOpticalBoxWidth, gTiltGearWidth,
-                                           gOpticalBoxHeight);
+  const double pi = boost::math::constants::pi<double>();
 
   // initialize variables
   double startX0 = start0.first;
@@ -107,7 +126,7 @@ bool TRotationCalculator::CalculatePath(XYPoint start0, XYPoint start1, std::pai
   // Z position of the two optical box surfaces relative to the PMT.
   std::pair<double, double> Z0_lo_up;
   std::pair<double, double> Z1_lo_up;
-  // PMT polygon layer index calculated as Z = ( opticalBoxZheight + gantZpos - pmtHeight )/ pmtPolyLayerHeight.
+  // PMT layer index calculated as Z = ( opticalBoxZheight + gantZpos - pmtHeight )/ pmtLayerHeight.
   int Z0_lo;
   int Z0_up;
   int Z1_lo;
@@ -157,24 +176,24 @@ bool TRotationCalculator::CalculatePath(XYPoint start0, XYPoint start1, std::pai
     }
 
     // determine boundary coordintes for gantry 0 & 1
-    gantry0 = gantryConfigCalc.GetGantryConfig(0, rot0, tilt0, startX0, startY0);
-    gantry1 = gantryConfigCalc.GetGantryConfig(1, rot1, tilt1, startX1, startY1);
+    gantry0 = fGantryConfigCalc.GetGantryConfig(0, rot0, tilt0, startX0, startY0);
+    gantry1 = fGantryConfigCalc.GetGantryConfig(1, rot1, tilt1, startX1, startY1);
 
-    opticalBox0 = gantryConfigCalc.GetOpticalBoxConfig(0, rot0, tilt0, startX0, startY0);
-    opticalBox1 = gantryConfigCalc.GetOpticalBoxConfig(1, rot1, tilt1, startX1, startY1);
+    opticalBox0 = fGantryConfigCalc.GetOpticalBoxConfig(0, rot0, tilt0, startX0, startY0);
+    opticalBox1 = fGantryConfigCalc.GetOpticalBoxConfig(1, rot1, tilt1, startX1, startY1);
 
     opticalBox0_lo = opticalBox0.first;
     opticalBox0_up = opticalBox0.second;
     opticalBox1_lo = opticalBox1.first;
     opticalBox1_up = opticalBox1.second;
 
-    Z0_lo_up = gantryConfigCalc.GetOpticalBoxZ(0, tilt0, gant0_z);
-    Z1_lo_up = gantryConfigCalc.GetOpticalBoxZ(1, tilt1, gant1_z);
+    Z0_lo_up = fGantryConfigCalc.GetOpticalBoxZ(0, tilt0, gant0_z);
+    Z1_lo_up = fGantryConfigCalc.GetOpticalBoxZ(1, tilt1, gant1_z);
 
-    Z0_lo = (Z0_lo_up.first - pmtHeight) / pmtPolyLayerHeight;
-    Z0_up = (Z0_lo_up.second - pmtHeight) / pmtPolyLayerHeight;
-    Z1_lo = (Z1_lo_up.first - pmtHeight) / pmtPolyLayerHeight;
-    Z1_up = (Z1_lo_up.second - pmtHeight) / pmtPolyLayerHeight;
+    Z0_lo = (Z0_lo_up.first - pmtHeight) / pmtLayerHeight;
+    Z0_up = (Z0_lo_up.second - pmtHeight) / pmtLayerHeight;
+    Z1_lo = (Z1_lo_up.first - pmtHeight) / pmtLayerHeight;
+    Z1_up = (Z1_lo_up.second - pmtHeight) / pmtLayerHeight;
 
     CreatePolygon(&fGantry0, gantry0);
     CreatePolygon(&fGantry1, gantry1);
@@ -187,33 +206,29 @@ bool TRotationCalculator::CalculatePath(XYPoint start0, XYPoint start1, std::pai
     // Check gantry-to-gantry collision:
     collisionFree = CheckPathForCollisions(&fGantry0, &fGantry1, tank_height_start.first, tank_height_end.first);
     if (!collisionFree) {
-      cm_msg(MINFO, "CalculatePath",
-             "Invalid rotation/tilt path: gantries will collide against each other or with tank.");
+      if (fVerbose) cm_msg(MINFO, "CalculatePath",
+                           "Invalid rotation/tilt path: gantries will collide against each other or with tank.");
       return false;
     }
 
     // Temporarily disabling
     /*
     if (Z0_lo >= 0) { // If Z0_lo>=0, lower surface of optical box 0 is lowered to PMT region, therefore check against PMT for collision.
-      collisionFree = CheckPathForCollisions(&fOpticalBox0_lo, fPMTmultiPoly0.at(Z0_lo), tank_height_start.first,
-                                             tank_height_end.first);
+      collisionFree = CheckPMTCollision(&fOpticalBox0_lo, 0, Z0_lo);
     }
     if (collisionFree && Z0_up >= 0) { // Upper surface of optical box 0 must be checked against PMT for collision.
-      collisionFree = CheckPathForCollisions(&fOpticalBox0_up, fPMTmultiPoly0.at(Z0_up), tank_height_start.first,
-                                             tank_height_end.first);
+      collisionFree = CheckPMTCollision(&fOpticalBox0_up, 0, Z0_up);
     }
     if (collisionFree && Z1_lo >= 0) { // If Z1_lo>=0, optical box 1 must be checked against PMT for collision.
-      collisionFree = CheckPathForCollisions(&fOpticalBox1_lo, fPMTmultiPoly1.at(Z1_lo), tank_height_start.second,
-                                             tank_height_end.second);
+      collisionFree = CheckPMTCollision(&fOpticalBox1_lo, 1, Z1_lo);
     }
     if (collisionFree && Z1_up >= 0) { // Upper surface of optical box 0 must be checked against PMT for collision.
-      collisionFree = CheckPathForCollisions(&fOpticalBox1_up, fPMTmultiPoly1.at(Z1_up), tank_height_start.second,
-                                             tank_height_end.second);
+      collisionFree = CheckPMTCollision(&fOpticalBox1_up, 1, Z1_up);
     }
     */
 
     if (!collisionFree) {
-      cm_msg(MINFO, "CalculatePath", "Invalid rotation/tilt path: gantry will collide with PMT.");
+      if (fVerbose) cm_msg(MINFO, "CalculatePath", "Invalid rotation/tilt path: gantry will collide with PMT.");
       return false;
     }
 
@@ -271,55 +286,161 @@ bool TRotationCalculator::CalculatePath(XYPoint start0, XYPoint start1, std::pai
 
 }
 
-// Rika (23Mar2017): Implemented CheckPathForCollisions function for PMT collision avoidance.
-// Taken from TPathCalculator.cxx
+// Angle (radians) reached along a rotation or tilt path (degrees) after s degrees of progress.
+// As in the stepped check, every angle moves by one degree per degree of progress until it reaches its end.
 //----------------------------------------------------------
-bool TRotationCalculator::CheckPathForCollisions(BoostPolygon *objectMoving, BoostPolygon *objectStationary,
-                                                 bool tank_height_start, bool tank_height_end) {
+static double AngleAlongPath(std::pair<double, double> path, double s) {
+//----------------------------------------------------------
+
+  const double pi = boost::math::constants::pi<double>();
+
+  double total = path.second - path.first;
+  if (s >= fabs(total)) return path.second * pi / 180;
+  if (total < 0) return (path.first - s) * pi / 180;
+  return (path.first + s) * pi / 180;
+
+}
+
+// Swept version of CalculatePath. For a range of progress the area covered by each gantry is bounded by a convex
+// polygon (SweptGantry), and the range is free of collisions if the bounds pass the same checks as a single
+// configuration. Otherwise the range is split in two until it is one increment long, where the configurations at
+// both of its ends are checked exactly like the stepped check does.
+// The optical box-to-PMT check is disabled in the stepped check and is not done here either.
+//----------------------------------------------------------
+bool TRotationCalculator::CalculateSweptPath(XYPoint start0, XYPoint start1, std::pair<double, double> rotationPath0,
+                                             std::pair<double, double> rotationPath1,
+                                             std::pair<double, double> tiltPath0,
+                                             std::pair<double, double> tiltPath1,
+                                             std::pair<bool, bool> tank_height_start,
+                                             std::pair<bool, bool> tank_height_end) {
 //----------------------------------------------------------
 
-  double Xdif;
-  double Ydif;
+  const double increment = 1.0; // degrees, same as the stepped check
+  const double maxRange = 30.0; // degrees; larger ranges are split up front so the bounds stay tight
+
+  double total = std::max(std::max(fabs(rotationPath0.second - rotationPath0.first),
+                                   fabs(rotationPath1.second - rotationPath1.first)),
+                          std::max(fabs(tiltPath0.second - tiltPath0.first),
+                                   fabs(tiltPath1.second - tiltPath1.first)));
+
+  // ranges of progress still to check; the last one is checked first so they are done in order
+  std::vector <std::pair<double, double> > ranges;
+  for (double s = total; s > 0; s -= maxRange) {
+    ranges.push_back(std::make_pair(std::max(s - maxRange, 0.0), s));
+  }
+  if (ranges.empty()) ranges.push_back(std::make_pair(0.0, 0.0));
+
+  while (!ranges.empty()) {
+    std::pair<double, double> range = ranges.back();
+    ranges.pop_back();
+
+    SweptGantry(0, AngleAlongPath(rotationPath0, range.first), AngleAlongPath(rotationPath0, range.second),
+                AngleAlongPath(tiltPath0, range.first), AngleAlongPath(tiltPath0, range.second),
+                start0.first, start0.second, &fGantry0);
+    SweptGantry(1, AngleAlongPath(rotationPath1, range.first), AngleAlongPath(rotationPath1, range.second),
+                AngleAlongPath(tiltPath1, range.first), AngleAlongPath(tiltPath1, range.second),
+                start1.first, start1.second, &fGantry1);
+
+    if (CheckPathForCollisions(&fGantry0, &fGantry1, tank_height_start.first, tank_height_end.first)) continue;
+
+    if (range.second - range.first > increment) {
+      double mid = 0.5 * (range.first + range.second);
+      ranges.push_back(std::make_pair(mid, range.second));
+      ranges.push_back(std::make_pair(range.first, mid));
+      continue;
+    }
+
+    double ends[2] = {range.first, range.second};
+    for (int i = 0; i < 2; ++i) {
+      CreatePolygon(&fGantry0, fGantryConfigCalc.GetGantryConfig(0, AngleAlongPath(rotationPath0, ends[i]),
+                                                                 AngleAlongPath(tiltPath0, ends[i]),
+                                                                 start0.first, start0.second));
+      CreatePolygon(&fGantry1, fGantryConfigCalc.GetGantryConfig(1, AngleAlongPath(rotationPath1, ends[i]),
+                                                                 AngleAlongPath(tiltPath1, ends[i]),
+                                                                 start1.first, start1.second));
+      if (!CheckPathForCollisions(&fGantry0, &fGantry1, tank_height_start.first, tank_height_end.first)) {
+        if (fVerbose) cm_msg(MINFO, "CalculatePath",
+                             "Invalid rotation/tilt path: gantries will collide against each other or with tank.");
+        return false;
+      }
+    }
+  }
+
+  return true;
 
-  double Maxval = tRadius;
-  double Ydifmax = tPMTholder; // max/min from center where PMT holders sit
+}
 
-  std::vector <BoostPoint> objectPoints = objectMoving->outer();
+// Each corner moves along a circular arc as the gantry rotates; the arc lies inside the triangle made of its end
+// points and the point where the tangents at the ends meet (1/cos(half the angle) further out than the middle of
+// the arc). The hull of these triangles for all corners holds the gantry at every rotation in between.
+// Tilt only moves the back corners, along a straight line, so outlines at the tilts where they are furthest in and
+// out are enough.
+//----------------------------------------------------------
+void TRotationCalculator::SweptGantry(int whichGantry, double rotA, double rotB, double tiltA, double tiltB,
+                                      double xPos, double yPos, BoostPolygon *swept) {
+//----------------------------------------------------------
 
-  bool collides_tank = 0;
-  bool collides_obj = 0;
+  const double pi = boost::math::constants::pi<double>();
 
-  // Collision check agaisnt tank:
-  for (std::vector<BoostPoint>::size_type i = 0; i < objectPoints.size(); ++i) {
-    double newX = boost::geometry::get<0>(objectPoints[i]);
-    double newY = boost::geometry::get<1>(objectPoints[i]);
+  if (rotA > rotB) std::swap(rotA, rotB);
+  if (tiltA > tiltB) std::swap(tiltA, tiltB);
 
-    // std::cout<< "TF DEBUG " << iter << " " << i << " " << newX << " " << newY << " " << path[iter].first << " " << path[iter].second << std::endl;
-    boost::geometry::set<0>(objectPoints[i], newX);
-    boost::geometry::set<1>(objectPoints[i], newY);
+  // back corners sit at -back*cos(tilt) + height*sin(tilt), which is furthest in or out where its derivative is 0
+  double tilts[5] = {tiltA, tiltB};
+  int nTilts = 2;
+  double tiltTurn = atan2(-gOpticalBoxHeight, gBack);
+  for (int k = -1; k <= 1; ++k) {
+    double tilt = tiltTurn + k * pi;
+    if (tilt > tiltA && tilt < tiltB) tilts[nTilts++] = tilt;
+  }
 
-    // Determine if box moves outside of tank limits. If gantry doesn't move above tank first and if starting height is not outside of tank, must check limits
-    if (!tank_height_end) {
-      if (!tank_height_start) {
-        if (newX >= Xcent) Xdif = newX - Xcent;
-        else Xdif = Xcent - newX;
-        if (newY >= Ycent) Ydif = newY - Ycent;
-        else Ydif = Ycent - newY;
-        if ((sqrt(Xdif * Xdif + Ydif * Ydif) > Maxval) || (Ydifmax < Ydif)) {
-          collides_tank = true;
-        }
+  double halfRange = 0.5 * (rotB - rotA);
+  double rotMid = rotA + halfRange;
+  double bulge = 1.0 / cos(halfRange);
+
+  fSweptPoints.clear();
+  for (int t = 0; t < nTilts; ++t) {
+    XYPolygon corners = fGantryConfigCalc.GetGantryConfig(whichGantry, 0, tilts[t], 0, 0);
+    for (int i = 0; i < (int) corners.size(); ++i) {
+      double px = corners[i].first;
+      double py = corners[i].second;
+      fSweptPoints.push_back(std::make_pair(xPos + px * cos(rotA) - py * sin(rotA),
+                                            yPos + px * sin(rotA) + py * cos(rotA)));
+      if (halfRange > 0) {
+        fSweptPoints.push_back(std::make_pair(xPos + bulge * (px * cos(rotMid) - py * sin(rotMid)),
+                                              yPos + bulge * (px * sin(rotMid) + py * cos(rotMid))));
+        fSweptPoints.push_back(std::make_pair(xPos + px * cos(rotB) - py * sin(rotB),
+                                              yPos + px * sin(rotB) + py * cos(rotB)));
       }
     }
   }
-  BoostPolygon fTestObject;
 
-  boost::geometry::assign_points(fTestObject, objectPoints);
-  boost::geometry::correct(fTestObject);
-  collides_obj = boost::geometry::intersects(fTestObject, *objectStationary);
+  swept_hull(fSweptPoints, swept);
 
-  if (collides_obj || collides_tank) return false;
+}
 
-  return true;
+// Rika (23Mar2017): Implemented CheckPathForCollisions function for PMT collision avoidance.
+// Taken from TPathCalculator.cxx
+//----------------------------------------------------------
+bool TRotationCalculator::CheckPathForCollisions(BoostPolygon *objectMoving, BoostPolygon *objectStationary,
+                                                 bool tank_height_start, bool tank_height_end) {
+//----------------------------------------------------------
+
+  // Determine if box moves outside of tank limits. If gantry doesn't move above tank first and if starting height is not outside of tank, must check limits
+  if (!tank_height_end && !tank_height_start) {
+    const double Maxval2 = tRadius * tRadius;
+    const double Ydifmax = tPMTholder; // max/min from center where PMT holders sit
+
+    const std::vector <BoostPoint> &objectPoints = objectMoving->outer();
+    for (std::vector<BoostPoint>::size_type i = 0; i < objectPoints.size(); ++i) {
+      double Xdif = boost::geometry::get<0>(objectPoints[i]) - Xcent;
+      double Ydif = boost::geometry::get<1>(objectPoints[i]) - Ycent;
+      if ((Xdif * Xdif + Ydif * Ydif > Maxval2) || (Ydifmax < fabs(Ydif))) return false;
+    }
+  }
+
+  // objectMoving is already a valid polygon (CreatePolygon & swept_hull), so it is checked as it is
+  return !boost::geometry::intersects(*objectMoving, *objectStationary);
 }
 
 // Rika (23Mar2017): From TPathCalculator.cxx
@@ -340,3 +461,13 @@ void TRotationCalculator::CreatePolygon(BoostPolygon *object, XYPolygon points)
   boost::geometry::correct(*object);
 
 }
+
+// The layer is a circle, so it is checked exactly (objectMoving is convex & clockwise, see CreatePolygon)
+//----------------------------------------------------------
+bool TRotationCalculator::CheckPMTCollision(BoostPolygon *objectMoving, int pmt, int layer) {
+//----------------------------------------------------------
+
+  const XYPoint &centre = (pmt == 0) ? fPMTCentre0 : fPMTCentre1;
+  const double radius = ((pmt == 0) ? fPMTRadius0 : fPMTRadius1).at(layer);
+  return !polygon_intersects_circle(*objectMoving, centre, radius);
+}
@@ -20,15 +20,36 @@ class TRotationCalculator {
         TRotationCalculator(double tiltMotorLength, double gantryFrontHalfLength, double gantryBackHalfLength, double gantryOpticalBoxWidth, double gantryTiltGearWidth, double gantryOpticalBoxHeight, double tankCentreXPos, double tankCentreYPos, double tankRadius, double tankPMTholderRadius);
 
         // Rika (23Mar2017):
-        // Input positions of PMT polygon for different z layers.
-        void InitialisePMT(std::vector<XYPolygon> pmt0, std::vector<XYPolygon> pmt1, double pmtHeight, double pmtPolyLayerHeight); 
+        // Input positions of PMT for different z layers.
+        // Layer i is a circle of radius layerRadius[i] around the centre, pmtLayerHeight below layer i-1.
+        void InitialisePMT(XYPoint centre0, XYPoint centre1, std::vector<double> layerRadius, double pmtHeight, double pmtLayerHeight);
+        // Replace the model of one PMT (0 or 1) only, keeping the height and layer thickness
+        void InitialisePMT(int pmt, XYPoint centre, const std::vector<double>& layerRadius);
+
+        // Input dimensions of the water tank, replacing the ones given to the constructor
+        void InitialiseTank(double tankCentreXPos, double tankCentreYPos, double tankRadius, double tankPMTholderRadius);
 
         // Calculate rotation and tilt paths in n-degree increments between start and end rotation / tilt. 
         // If collision with water tank or other gantry detected at any increment returns false.
         // Rika (3Apr2017): Updated to include tilt path collision check
         bool CalculatePath(XYPoint start0, XYPoint start1, std::pair<double, double> rotationPath0, std::pair<double, double> rotationPath1, std::pair<double, double> tiltPath0, std::pair<double, double> tiltPath1, double gant0_z, double gant1_z, std::pair<bool, bool> tank_height_start, std::pair<bool, bool> tank_height_end);
 
+        // Choose between checking the swept area of the gantries (default) and checking every n-degree increment.
+        // The swept check bounds the area covered by each gantry over a range of angles and tests it once,
+        // only stepping where the bounds of the two gantries or the tank overlap.
+        void SetSweptCheck(bool swept) { fSweptCheck = swept; }
+
+        // Whether CalculatePath says why a path is invalid (default), see TScanValidator for why it may not.
+        void SetVerbose(bool verbose) { fVerbose = verbose; }
+
     private:
+        // CalculatePath using the swept area of the gantries, see SetSweptCheck.
+        bool CalculateSweptPath(XYPoint start0, XYPoint start1, std::pair<double, double> rotationPath0, std::pair<double, double> rotationPath1, std::pair<double, double> tiltPath0, std::pair<double, double> tiltPath1, std::pair<bool, bool> tank_height_start, std::pair<bool, bool> tank_height_end);
+
+        // Convex polygon containing gantry whichGantry at (xPos, yPos) for every rotation between rotA & rotB
+        // and every tilt between tiltA & tiltB (radians).
+        void SweptGantry(int whichGantry, double rotA, double rotB, double tiltA, double tiltB, double xPos, double yPos, BoostPolygon* swept);
+
         // Rika (23Mar2017): Generic function to create BoostPolygon objects.
         void CreatePolygon(BoostPolygon* object, XYPolygon points);
 
@@ -37,12 +58,33 @@ class TRotationCalculator {
         // Returns true if path is free of collision; false otherwise.
         bool CheckPathForCollisions(BoostPolygon* objectMoving, BoostPolygon* objectStationary, bool tank_height_start, bool tank_height_end);
 
-        // BOOST Geometry polygons to store the position and dimensions of PMT
-        std::vector<BoostPolygon*> fPMTmultiPoly0; // PMT position as seen by Gantry 0
-        std::vector<BoostPolygon*> fPMTmultiPoly1; // PMT position as seen by Gantry 1
+        // Checks objectMoving against layer 'layer' of PMT 'pmt'. Returns true if there is no collision.
+        bool CheckPMTCollision(BoostPolygon* objectMoving, int pmt, int layer);
+
+        // PMT models, see InitialisePMT
+        XYPoint fPMTCentre0; // PMT position as seen by Gantry 0
+        XYPoint fPMTCentre1; // PMT position as seen by Gantry 1
+        std::vector<double> fPMTRadius0; // radius of each layer
+        std::vector<double> fPMTRadius1;
+
+        // Gantry & optical box polygons at the angles being checked, reused by every CalculatePath
+        BoostPolygon fGantry0;
+        BoostPolygon fGantry1;
+        BoostPolygon fOpticalBox0_lo;
+        BoostPolygon fOpticalBox0_up;
+        BoostPolygon fOpticalBox1_lo;
+        BoostPolygon fOpticalBox1_up;
+
+        // Shared by all the CalculatePath calls instead of being constructed for every one
+        TGantryConfigCalculator fGantryConfigCalc;
+
+        bool fSweptCheck;
+        bool fVerbose;
+        // Scratch storage for the swept check
+        std::vector<XYPoint> fSweptPoints;
 
         double pmtHeight; // z position of PMT top surface
-        double pmtPolyLayerHeight; // Height of PMT polygon layers
+        double pmtLayerHeight; // Height of PMT layers
 
         // Gantry dimensions; to be passed to TGantryConfigCalculator to determine orientation of gantry
         double tiltMotor;
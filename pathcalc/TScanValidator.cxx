@@ -0,0 +1,406 @@
+#include "TScanValidator.hxx"
+#include <algorithm>
+#include <pthread.h>
+#include <unistd.h>
+#include <boost/math/constants/constants.hpp>
+
+
+// Rotation & tilt checks needed by each strategy, besides its XY checks; see generate_path in feMove
+const int TScanValidator::fStrategyRotTiltChecks[8][4] = {
+  // Tilt first: gantry 0 first, rotation first & second; then the same with gantry 1 first
+  {ROT_TILT_ROTFIRST_TILTFIRST, ROT_TILT_ENDCHECK, -1},
+  {TILT_ROTSECOND_TILTFIRST, ROTATION_ROTSECOND_TILTFIRST, ROT_TILT_ENDCHECK, -1},
+  {ROT_TILT_ROTFIRST_TILTFIRST, ROT_TILT_ENDCHECK, -1},
+  {TILT_ROTSECOND_TILTFIRST, ROTATION_ROTSECOND_TILTFIRST, ROT_TILT_ENDCHECK, -1},
+  // Tilt second
+  {ROTATION_ROTFIRST_TILTSECOND, TILT_ROTFIRST_TILTSECOND, ROT_TILT_ENDCHECK, -1},
+  {ROT_TILT_ROTSECOND_TILTSECOND, ROT_TILT_ENDCHECK, -1},
+  {ROTATION_ROTFIRST_TILTSECOND, TILT_ROTFIRST_TILTSECOND, ROT_TILT_ENDCHECK, -1},
+  {ROT_TILT_ROTSECOND_TILTSECOND, ROT_TILT_ENDCHECK, -1}
+};
+
+
+//----------------------------------------------------------
+TScanValidator::TScanValidator(const COLLISION_SETTINGS &settings, const float *limits)
+  : fGantryConfigCalc(GANTRY_TILT_MOTOR_LENGTH, GANTRY_FRONT_HALF_LENGTH, GANTRY_BACK_HALF_LENGTH,
+                      GANTRY_OPTICAL_BOX_WIDTH, GANTRY_TILT_GEAR_WIDTH, GANTRY_OPTICAL_BOX_HEIGHT) {
+//----------------------------------------------------------
+
+  fSettings = settings;
+  for (int j = 0; j < 10; j++) fLimits[j] = limits[j];
+
+  // Same PMT model as feMove's collision scene
+  const int numLayers = PMT_MODEL_DEPTH / PMT_LAYER_HEIGHT;
+  std::vector<double> layerRadius;
+  for (int layer = 0; layer < numLayers; ++layer) {
+    layerRadius.push_back(pmt_layer_radius(settings, layer, PMT_LAYER_HEIGHT));
+  }
+  const XYPoint centre0(settings.PMTCentre0[0], settings.PMTCentre0[1]);
+  const XYPoint centre1(settings.PMTCentre1[0], settings.PMTCentre1[1]);
+
+  int numThreads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (numThreads < 1) numThreads = 1;
+
+  fThreads.resize(numThreads);
+  for (int t = 0; t < numThreads; t++) {
+    THREAD &thread = fThreads[t];
+    thread.Validator = this;
+
+    thread.PathCalc = new TPathCalculator(settings.TankCentre[0], settings.TankCentre[1], settings.TankRadius,
+                                          settings.TankPMTholderRadius);
+    thread.PathCalc->InitialisePMT(centre0, centre1, layerRadius);
+    // Thousands of checks: only the summary made by the caller should end up in the log
+    thread.PathCalc->SetVerbose(false);
+
+    thread.RotationCalc = new TRotationCalculator(GANTRY_TILT_MOTOR_LENGTH, GANTRY_FRONT_HALF_LENGTH,
+                                                  GANTRY_BACK_HALF_LENGTH, GANTRY_OPTICAL_BOX_WIDTH,
+                                                  GANTRY_TILT_GEAR_WIDTH, GANTRY_OPTICAL_BOX_HEIGHT,
+                                                  settings.TankCentre[0], settings.TankCentre[1],
+                                                  settings.TankRadius, settings.TankPMTholderRadius);
+    thread.RotationCalc->InitialisePMT(centre0, centre1, layerRadius, settings.PMTHeight, PMT_LAYER_HEIGHT);
+    thread.RotationCalc->SetVerbose(false);
+  }
+
+  fNumPoints = 0;
+  fCheck = NULL;
+  fNumChecks = 0;
+  fNext = 0;
+
+}
+
+//----------------------------------------------------------
+TScanValidator::~TScanValidator() {
+//----------------------------------------------------------
+
+  for (unsigned int t = 0; t < fThreads.size(); t++) {
+    delete fThreads[t].PathCalc;
+    delete fThreads[t].RotationCalc;
+  }
+
+}
+
+//----------------------------------------------------------
+const char *TScanValidator::GetProblemName(int problem) {
+//----------------------------------------------------------
+
+  switch (problem) {
+    case SCAN_POINT_OK:
+      return "valid";
+    case SCAN_POINT_ANGLE:
+      return "rotation or tilt out of range";
+    case SCAN_POINT_Z:
+      return "Z too large";
+    case SCAN_POINT_LIMITS:
+      return "outside the gantry limits";
+    case SCAN_POINT_BEAMS:
+      return "beams will collide";
+    case SCAN_POINT_COLLISION:
+      return "gantries will collide with each other or with the tank";
+    default:
+      return "unknown";
+  }
+
+}
+
+//----------------------------------------------------------
+int TScanValidator::Validate(const ScanPoints &points, int numPoints, const float *start, bool checkMoves) {
+//----------------------------------------------------------
+
+  if (numPoints > (int) points.size()) numPoints = points.size();
+  if (numPoints < 0) numPoints = 0;
+
+  for (int j = 0; j < SCAN_POINT_WIDTH; j++) fStart[j] = start[j];
+  fNumPoints = numPoints;
+
+  // Fill in the values that are left where they are, as move_next_position in feScan does
+  fResolved.resize(numPoints * SCAN_POINT_WIDTH);
+  const double *previous = fStart;
+  for (int i = 0; i < numPoints; i++) {
+    double *resolved = &fResolved[i * SCAN_POINT_WIDTH];
+    for (int j = 0; j < SCAN_POINT_WIDTH; j++) {
+      resolved[j] = points[i][j] > -999 ? points[i][j] : previous[j];
+    }
+    previous = resolved;
+  }
+
+  fPointProblem.assign(numPoints, SCAN_POINT_OK);
+  fMoveGood.assign(numPoints, 1);
+  ComputePoses(checkMoves);
+
+  // Moves are only checked between valid points, so all the points are checked first
+  RunChecks(&TScanValidator::CheckPoint, numPoints);
+  if (checkMoves) RunChecks(&TScanValidator::CheckMove, numPoints);
+
+  int numInvalid = 0;
+  for (int i = 0; i < numPoints; i++) {
+    if (fPointProblem[i] != SCAN_POINT_OK) numInvalid++;
+    if (!fMoveGood[i]) numInvalid++;
+  }
+  return numInvalid;
+
+}
+
+// Only the rotation and tilt change the shape of a gantry, so the corners are worked out with the gantry at (0, 0)
+// and PlaceCorners moves them to where it is.
+//----------------------------------------------------------
+void TScanValidator::ComputePoses(bool checkMoves) {
+//----------------------------------------------------------
+
+  const double rad = boost::math::constants::pi<double>() / 180;
+  const int n = fNumPoints;
+  const int numPoses = checkMoves ? 3 * n + 1 : n + 1;
+  std::vector<double> rot(numPoses), tilt(numPoses), zero(numPoses, 0.);
+
+  for (int g = 0; g < 2; g++) {
+    const int o = 5 * g;
+    for (int i = 0; i <= n; i++) {
+      const double *point = i == 0 ? fStart : GetResolvedPoint(i - 1);
+      rot[i] = point[o + 3] * rad;
+      tilt[i] = point[o + 4] * rad;
+    }
+    if (checkMoves) {
+      for (int i = 0; i < n; i++) {
+        rot[GetPose(i, true, false)] = rot[i + 1];
+        tilt[GetPose(i, true, false)] = tilt[i];
+        rot[GetPose(i, false, true)] = rot[i];
+        tilt[GetPose(i, false, true)] = tilt[i + 1];
+      }
+    }
+
+    double *cornerX[12], *cornerY[12];
+    for (int c = 0; c < 12; c++) {
+      fCornerX[g][c].resize(numPoses);
+      fCornerY[g][c].resize(numPoses);
+      cornerX[c] = &fCornerX[g][c][0];
+      cornerY[c] = &fCornerY[g][c][0];
+    }
+    fGantryConfigCalc.GetGantryConfig(g, numPoses, &rot[0], &tilt[0], &zero[0], &zero[0], cornerX, cornerY);
+    fGantryConfigCalc.GetOpticalBoxConfig(g, numPoses, &rot[0], &tilt[0], &zero[0], &zero[0], cornerX + 4,
+                                          cornerY + 4);
+
+    // The optical boxes are at the height the gantry moves in X & Y at, see CheckMove
+    if (checkMoves && n > 0) {
+      std::vector<double> boxTilt(2 * n), boxZ(2 * n);
+      for (int i = 0; i < n; i++) {
+        boxTilt[i] = tilt[i + 1];
+        boxTilt[n + i] = tilt[i];
+        boxZ[i] = boxZ[n + i] = std::min(GetResolvedPoint(i)[o + 2], GetMoveStart(i)[o + 2]);
+      }
+      fBoxZLower[g].resize(2 * n);
+      fBoxZUpper[g].resize(2 * n);
+      fGantryConfigCalc.GetOpticalBoxZ(g, 2 * n, &boxTilt[0], &boxZ[0], &fBoxZLower[g][0], &fBoxZUpper[g][0]);
+    }
+  }
+
+}
+
+//----------------------------------------------------------
+void TScanValidator::PlaceCorners(int g, int pose, int first, double x, double y, XYPolygon &corners) const {
+//----------------------------------------------------------
+
+  corners.resize(4);
+  for (int c = 0; c < 4; c++) {
+    corners[c].first = fCornerX[g][first + c][pose] + x;
+    corners[c].second = fCornerY[g][first + c][pose] + y;
+  }
+
+}
+
+// Returns once every check is done. The calling thread takes part, and does everything itself if
+// no other thread can be started. Same as run_path_checks in feMove.
+//----------------------------------------------------------
+void TScanValidator::RunChecks(void (TScanValidator::*check)(THREAD &, int), int numPoints) {
+//----------------------------------------------------------
+
+  fCheck = check;
+  fNumChecks = numPoints;
+  fNext = 0;
+
+  int numThreads = fThreads.size();
+  if (numThreads > numPoints) numThreads = numPoints;
+
+  std::vector<pthread_t> threads;
+  for (int t = 1; t < numThreads; t++) {
+    pthread_t thread;
+    if (pthread_create(&thread, NULL, CheckThread, &fThreads[t]) == 0) threads.push_back(thread);
+  }
+
+  CheckThread(&fThreads[0]);
+
+  for (unsigned int t = 0; t < threads.size(); t++) {
+    pthread_join(threads[t], NULL);
+  }
+
+}
+
+//----------------------------------------------------------
+void *TScanValidator::CheckThread(void *data) {
+//----------------------------------------------------------
+
+  THREAD *thread = (THREAD *) data;
+  TScanValidator *validator = thread->Validator;
+
+  for (;;) {
+    int i = __sync_fetch_and_add(&validator->fNext, 1);
+    if (i >= validator->fNumChecks) break;
+    (validator->*validator->fCheck)(*thread, i);
+  }
+
+  return NULL;
+
+}
+
+// Same checks, in the same order, as generate_path makes for a destination
+//----------------------------------------------------------
+void TScanValidator::CheckPoint(THREAD &thread, int i) {
+//----------------------------------------------------------
+
+  const double *des = GetResolvedPoint(i);
+
+  for (int g = 0; g < 2; g++) {
+    const double *d = des + 5 * g;
+    if (d[3] < GANTRY_ROT_MIN || d[3] > GANTRY_ROT_MAX || d[4] < GANTRY_TILT_MIN || d[4] > GANTRY_TILT_MAX) {
+      fPointProblem[i] = SCAN_POINT_ANGLE;
+      return;
+    }
+  }
+  if (des[2] > GANTRY_Z_MAX || des[7] > GANTRY_Z_MAX) {
+    fPointProblem[i] = SCAN_POINT_Z;
+    return;
+  }
+  // As in generate_path, both gantries have to be between the limit positions of gantry 0 and gantry 1
+  if (des[0] < fLimits[0] || des[0] > fLimits[5] || des[5] < fLimits[0] || des[5] > fLimits[5] ||
+      des[1] < fLimits[1] || des[1] > fLimits[6] || des[6] < fLimits[1] || des[6] > fLimits[6]) {
+    fPointProblem[i] = SCAN_POINT_LIMITS;
+    return;
+  }
+  if (des[0] + GANTRY_BEAM_GAP >= des[5]) {
+    fPointProblem[i] = SCAN_POINT_BEAMS;
+    return;
+  }
+
+  XYPolygon *gantry = thread.Gantry;
+  PlaceCorners(0, GetPose(i, true, true), 0, des[0], des[1], gantry[0]);
+  PlaceCorners(1, GetPose(i, true, true), 0, des[5], des[6], gantry[1]);
+  if (!thread.PathCalc->CheckDestination(gantry[0], gantry[1], des[2] < TANK_HEIGHT) ||
+      !thread.PathCalc->CheckDestination(gantry[1], gantry[0], des[7] < TANK_HEIGHT)) {
+    fPointProblem[i] = SCAN_POINT_COLLISION;
+  }
+
+}
+
+// The strategies are tried in the order generate_path tries them, and the move is good if
+// generate_path would find a path: the first strategy that works must also not cross the beams.
+//----------------------------------------------------------
+void TScanValidator::CheckMove(THREAD &thread, int i) {
+//----------------------------------------------------------
+
+  fMoveGood[i] = 1;
+  if (fPointProblem[i] != SCAN_POINT_OK || (i > 0 && fPointProblem[i - 1] != SCAN_POINT_OK)) return;
+
+  MOVE move;
+  move.Index = i;
+  move.Pos = GetMoveStart(i);
+  move.Des = GetResolvedPoint(i);
+  move.TankStart = std::make_pair(move.Pos[2] < TANK_HEIGHT, move.Pos[7] < TANK_HEIGHT);
+  move.TankEnd = std::make_pair(move.Des[2] < TANK_HEIGHT, move.Des[7] < TANK_HEIGHT);
+  // It is always safer to move up first, so the gantries move in X & Y at the higher of the two heights
+  move.Z[0] = std::min(move.Des[2], move.Pos[2]);
+  move.Z[1] = std::min(move.Des[7], move.Pos[7]);
+  for (int c = 0; c < NUM_ROT_TILT_CHECKS; c++) move.RotTilt[c] = -1;
+
+  // Gantry 0 would run into the beam of gantry 1 unless gantry 1 moves out of the way first
+  const bool gantry1First = move.Des[0] - GANTRY_BEAM_GAP >= move.Pos[5];
+
+  for (int s = 0; s < 8; s++) {
+    const bool gantry0First = s % 4 < 2;
+    if (gantry0First && gantry1First) continue;
+
+    bool good = true;
+    for (int c = 0; good && fStrategyRotTiltChecks[s][c] >= 0; c++) {
+      good = CheckRotTilt(thread, move, fStrategyRotTiltChecks[s][c]);
+    }
+    if (good) good = CheckXY(thread, move, s);
+
+    if (good) {
+      // generate_path gives up if gantry 1 would then run into the beam of gantry 0
+      fMoveGood[i] = gantry0First || move.Des[5] + GANTRY_BEAM_GAP > move.Pos[0];
+      return;
+    }
+  }
+
+  fMoveGood[i] = 0;
+
+}
+
+// Strategies 0-3 tilt before moving in X & Y, 4-7 after; even ones rotate before, odd ones after;
+// 0, 1, 4 & 5 move gantry 0 first, the others gantry 1.
+//----------------------------------------------------------
+bool TScanValidator::CheckXY(THREAD &thread, const MOVE &move, int strategy) {
+//----------------------------------------------------------
+
+  const bool tiltEnd = strategy < 4;
+  const int pose = GetPose(move.Index, strategy % 2 == 0, tiltEnd);
+  const int heights = tiltEnd ? move.Index : fNumPoints + move.Index;
+  const int first = strategy % 4 < 2 ? 0 : 1;
+
+  int boxLo[2], boxUp[2];
+  for (int g = 0; g < 2; g++) {
+    boxLo[g] = (fBoxZLower[g][heights] - fSettings.PMTHeight) / PMT_LAYER_HEIGHT;
+    boxUp[g] = (fBoxZUpper[g][heights] - fSettings.PMTHeight) / PMT_LAYER_HEIGHT;
+  }
+
+  for (int step = 0; step < 2; step++) {
+    const int moving = step == 0 ? first : 1 - first;
+
+    for (int g = 0; g < 2; g++) {
+      // The gantry that moved first is at its end position while the other one moves
+      const double *at = (step == 1 && g == first) ? move.Des : move.Pos;
+      const int o = 5 * g;
+      PlaceCorners(g, pose, 0, at[o], at[o + 1], thread.Gantry[g]);
+      PlaceCorners(g, pose, 4, at[o], at[o + 1], thread.BoxLo[g]);
+      PlaceCorners(g, pose, 8, at[o], at[o + 1], thread.BoxUp[g]);
+    }
+
+    thread.PathCalc->InitialiseGantries(thread.Gantry[0], thread.Gantry[1]);
+    thread.PathCalc->InitialiseOpticalBoxes(thread.BoxLo[0], thread.BoxUp[0], thread.BoxLo[1], thread.BoxUp[1],
+                                            boxLo[0], boxUp[0], boxLo[1], boxUp[1]);
+
+    const int o = 5 * moving;
+    if (!thread.PathCalc->CalculatePath(XYPoint(move.Pos[o], move.Pos[o + 1]), XYPoint(move.Des[o], move.Des[o + 1]),
+                                        thread.Path, move.TankStart, move.TankEnd)) {
+      return false;
+    }
+  }
+
+  return true;
+
+}
+
+// Each check is made once per move, as several strategies share it
+//----------------------------------------------------------
+bool TScanValidator::CheckRotTilt(THREAD &thread, MOVE &move, int check) {
+//----------------------------------------------------------
+
+  if (move.RotTilt[check] >= 0) return move.RotTilt[check];
+
+  // Where the gantries are, and the angles they turn from and to, while the check is made
+  const bool atStart = (check == ROT_TILT_ROTFIRST_TILTFIRST || check == TILT_ROTSECOND_TILTFIRST ||
+                        check == ROTATION_ROTFIRST_TILTSECOND);
+  const double *at = atStart ? move.Pos : move.Des;
+  const double *rot0 = move.Pos, *rot1 = move.Des, *tilt0 = move.Pos, *tilt1 = move.Des;
+  if (check == TILT_ROTSECOND_TILTFIRST) rot1 = move.Pos;      // not rotated yet
+  if (check == ROTATION_ROTSECOND_TILTFIRST) tilt0 = move.Des; // already tilted
+  if (check == ROTATION_ROTFIRST_TILTSECOND) tilt1 = move.Pos; // not tilted yet
+  if (check == TILT_ROTFIRST_TILTSECOND) rot0 = move.Des;      // already rotated
+  if (check == ROT_TILT_ENDCHECK) rot0 = tilt0 = move.Des;
+
+  bool good = thread.RotationCalc->CalculatePath(XYPoint(at[0], at[1]), XYPoint(at[5], at[6]),
+                                                 std::make_pair(rot0[3], rot1[3]), std::make_pair(rot0[8], rot1[8]),
+                                                 std::make_pair(tilt0[4], tilt1[4]),
+                                                 std::make_pair(tilt0[9], tilt1[9]),
+                                                 move.Z[0], move.Z[1], move.TankStart, move.TankEnd);
+  move.RotTilt[check] = good;
+  return good;
+
+}
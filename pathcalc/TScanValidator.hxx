@@ -0,0 +1,150 @@
+/********************************************************************\
+
+  Name:         TScanValidator.hxx
+
+  Checks a whole scan against the collision model of feMove before
+  the run starts, so that points feMove would refuse ("Bad Destination")
+  are known up front instead of being found one move at a time.
+
+  Every point is checked the way generate_path in feMove checks a
+  destination. Optionally every move between consecutive points is
+  checked too, by trying the same eight strategies (which gantry moves
+  first, rotation & tilt before or after moving in X & Y) with the same
+  path calculators; a move is valid if one of them is.
+  The checks are independent and run on up to one thread per CPU.
+
+  Keep the checks in step with generate_path.
+
+\********************************************************************/
+
+#ifndef ScanValidator_H
+#define ScanValidator_H
+
+#include <vector>
+#include "CollisionSettings.hxx"
+#include "ScanPlan.hxx"
+#include "TPathCalculator.hxx"
+#include "TRotationCalculator.hxx"
+#include "TGantryConfigCalculator.hxx"
+
+// Why a point is not a valid destination, in the order generate_path checks
+enum {
+  SCAN_POINT_OK = 0,
+  SCAN_POINT_ANGLE,       // rotation or tilt out of range
+  SCAN_POINT_Z,           // deeper than GANTRY_Z_MAX
+  SCAN_POINT_LIMITS,      // X or Y outside the gantry limit positions
+  SCAN_POINT_BEAMS,       // the beams of the two gantries would cross
+  SCAN_POINT_COLLISION,   // the gantries would collide with each other or with the tank
+  NUM_SCAN_POINT_PROBLEMS
+};
+
+class TScanValidator {
+
+public:
+  // limits: the 10 "Limit Positions" of feMove
+  TScanValidator(const COLLISION_SETTINGS &settings, const float *limits);
+  ~TScanValidator();
+
+  // Checks the first numPoints points, and with checkMoves also the move to each of them, the first one
+  // from start (the 10 current gantry positions). As in feScan, values of -999 or less are taken from the
+  // point before. Returns the number of invalid points plus the number of invalid moves between valid points.
+  int Validate(const ScanPoints &points, int numPoints, const float *start, bool checkMoves);
+
+  // Results of the last Validate, for point i:
+  // SCAN_POINT_OK or why the point is not a valid destination
+  int GetPointProblem(int i) const { return fPointProblem[i]; }
+  // False if no strategy can make the move from point i-1 (or start) to point i. Only checked when both
+  // points are valid; true otherwise.
+  bool GetMoveGood(int i) const { return fMoveGood[i]; }
+  // Point i with the values taken from the points before filled in
+  const double *GetResolvedPoint(int i) const { return &fResolved[i * SCAN_POINT_WIDTH]; }
+
+  static const char *GetProblemName(int problem);
+
+private:
+  // Not copyable (owns the calculators)
+  TScanValidator(const TScanValidator &);
+  TScanValidator &operator=(const TScanValidator &);
+
+  // What a thread needs for itself: the calculators keep scratch state between calls
+  typedef struct {
+    TScanValidator *Validator;
+    TPathCalculator *PathCalc;
+    TRotationCalculator *RotationCalc;
+    std::vector<XYPoint> Path;
+    XYPolygon Gantry[2], BoxLo[2], BoxUp[2];  // filled in place by PlaceCorners
+  } THREAD;
+
+  // Runs check(thread, i) for i = 0 .. numPoints-1 on all the threads
+  void RunChecks(void (TScanValidator::*check)(THREAD &, int), int numPoints);
+  static void *CheckThread(void *data);
+
+  void CheckPoint(THREAD &thread, int i);
+  void CheckMove(THREAD &thread, int i);
+
+  // Rotation & tilt checks of generate_path, named after the strategies using them
+  enum {
+    ROT_TILT_ROTFIRST_TILTFIRST,     // rotation & tilt together at the start position
+    TILT_ROTSECOND_TILTFIRST,        // tilt at the start position
+    ROTATION_ROTSECOND_TILTFIRST,    // rotation at the end position, after tilting
+    ROTATION_ROTFIRST_TILTSECOND,    // rotation at the start position
+    TILT_ROTFIRST_TILTSECOND,        // tilt at the end position, after rotating
+    ROT_TILT_ROTSECOND_TILTSECOND,   // rotation & tilt together at the end position
+    ROT_TILT_ENDCHECK,               // final rotation & tilt at the end position
+    NUM_ROT_TILT_CHECKS
+  };
+
+  // The move CheckMove is looking at
+  typedef struct {
+    int Index;                       // of the point moved to
+    const double *Pos, *Des;
+    std::pair<bool, bool> TankStart, TankEnd;
+    double Z[2];                     // heights at which the gantries move in X & Y
+    int RotTilt[NUM_ROT_TILT_CHECKS]; // results of the rotation & tilt checks, -1 until made
+  } MOVE;
+
+  // Rotation & tilt checks each strategy needs, ending with -1
+  static const int fStrategyRotTiltChecks[8][4];
+
+  // XY checks of strategy 0-7 (generate_path's 1-8)
+  bool CheckXY(THREAD &thread, const MOVE &move, int strategy);
+  bool CheckRotTilt(THREAD &thread, MOVE &move, int check);
+
+  // Start (the point before) and end of the move to point i
+  const double *GetMoveStart(int i) const { return i == 0 ? fStart : GetResolvedPoint(i - 1); }
+
+  // Works out the corners of the gantries and optical boxes in every pose the checks need, and the heights of
+  // the optical boxes, for all the points at once (see TGantryConfigCalculator), before the checks start.
+  void ComputePoses(bool checkMoves);
+  // Pose during the move to point i, with the rotation and the tilt each at the start or at the end of the move.
+  // Pose 0 is the start, pose i + 1 point i; the mixed ones only exist when the moves are checked.
+  int GetPose(int i, bool rotEnd, bool tiltEnd) const {
+    if (rotEnd == tiltEnd) return rotEnd ? i + 1 : i;
+    return rotEnd ? fNumPoints + 1 + i : 2 * fNumPoints + 1 + i;
+  }
+  // Corners first .. first + 3 of gantry g in pose (gantry 0-3, optical box lower surface 4-7, upper surface 8-11),
+  // with the gantry at (x, y)
+  void PlaceCorners(int g, int pose, int first, double x, double y, XYPolygon &corners) const;
+
+  COLLISION_SETTINGS fSettings;
+  float fLimits[10];
+  TGantryConfigCalculator fGantryConfigCalc; // only has the dimensions, so shared by the threads
+  std::vector<THREAD> fThreads;
+
+  double fStart[SCAN_POINT_WIDTH];
+  int fNumPoints;
+  std::vector<double> fResolved;
+  std::vector<double> fCornerX[2][12], fCornerY[2][12]; // [gantry][corner][pose], with the gantry at (0, 0)
+  // [gantry][i]: optical box heights during the move to point i, tilted as at the end of the move;
+  // [gantry][fNumPoints + i]: tilted as at the start
+  std::vector<double> fBoxZLower[2], fBoxZUpper[2];
+  std::vector<int> fPointProblem;
+  std::vector<char> fMoveGood;   // not vector<bool>: the threads write neighbouring elements at the same time
+
+  void (TScanValidator::*fCheck)(THREAD &, int);
+  int fNumChecks;
+  int fNext;                     // next check to be taken by a thread
+
+};
+
+#endif
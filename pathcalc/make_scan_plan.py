@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+
+"""Makes a scan plan file for feScan from a text table of points.
+
+Usage: make_scan_plan.py points.txt plan.dat
+
+The table has one point per line: the 10 values x, y, z, rotation, tilt of gantry 0, then of gantry 1,
+separated by spaces or commas. Everything after a '#' is a comment. Values of -999 or less leave that
+axis where it is.
+
+The plan file has the layout of ScanPlan.hxx (native byte order), with a settings hash of 0 so feScan
+uses it whatever the scan settings. Point /Equipment/Scan/Plan/Manual Path at it and run a manual scan;
+no rebuild of feScan is needed.
+"""
+
+import struct
+import sys
+
+# Keep in step with ScanPlan.hxx
+SCAN_PLAN_MAGIC = b'PTFPLAN'
+SCAN_PLAN_VERSION = 1
+SCAN_POINT_WIDTH = 10
+
+
+def scan_plan_hash(data, hash=2166136261):
+    """32 bit FNV-1a hash, as ScanPlanHash"""
+    for byte in bytearray(data):
+        hash = ((hash ^ byte) * 16777619) & 0xffffffff
+    return hash
+
+
+def read_points(path):
+    points = []
+    with open(path) as table:
+        for number, line in enumerate(table, 1):
+            line = line.split('#')[0].replace(',', ' ').split()
+            if not line:
+                continue
+            if len(line) != SCAN_POINT_WIDTH:
+                sys.exit('%s:%d: expected %d values, got %d' % (path, number, SCAN_POINT_WIDTH, len(line)))
+            try:
+                points.extend(float(value) for value in line)
+            except ValueError as e:
+                sys.exit('%s:%d: %s' % (path, number, e))
+    return points
+
+
+def write_plan(path, points):
+    data = struct.pack('=%dd' % len(points), *points)
+    header = struct.pack('=8sIIQII', SCAN_PLAN_MAGIC, SCAN_PLAN_VERSION, SCAN_POINT_WIDTH,
+                         len(points) // SCAN_POINT_WIDTH, 0, scan_plan_hash(data))
+    with open(path, 'wb') as plan:
+        plan.write(header)
+        plan.write(data)
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    points = read_points(sys.argv[1])
+    write_plan(sys.argv[2], points)
+    print('%s: %d points' % (sys.argv[2], len(points) // SCAN_POINT_WIDTH))
@@ -14,14 +14,21 @@ Then it calls the method move_next_position, which will make the first
 move.
 
 3) The methods frontend_loop and read_scan are then periodically called
-by the main front-end loop (frontend_loop is called more often).
+by the main front-end loop (frontend_loop is called more often). Neither
+of them waits: every point goes through the states of SCAN_STATE, and
+each call only looks whether the current state is over.
 
--> Once a move is finished (move_next_position is done), the next read_scan
-will execute a readout of DVM and create a bank with the current position
-and reading.
+-> IDLE: frontend_loop starts the move to the next point
+(move_next_position) and goes to MOVING.
 
--> Once a reading is finished, the next frontend_loop will initiate
-the next move_next_position.
+-> MOVING: frontend_loop looks whether feMove has finished the move
+(check_move). The motors are switched off and it goes to SETTLING, or
+back to IDLE after a waypoint or a bad destination.
+
+-> SETTLING: once the motors had time to switch off, MEASURING.
+
+-> MEASURING: read_scan writes the EOM bank, and once the measurement
+time is over a bank with the current position and reading. Back to IDLE.
 
 \********************************************************************/
 
@@ -30,10 +37,12 @@ the next move_next_position.
 #include <stdio.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 #include <sys/time.h>
 #include "midas.h"
 //#include "experim_new.h"
 #include "ScanSequence.hxx"
+#include "MoveCompletion.hxx"
 #include <vector>
 #include "mfe.h"
 
@@ -73,11 +82,28 @@ dddd indicates if running in cycle in frontend loop
 dd = scan info
 */
 
-// flag indicates that we are currently moving; this ensures that frontend_loop doesn't
-// start another move at the same time.
-BOOL gbl_making_move;
-// flag indicates that move is finished and we are waiting for next measurement.
-BOOL gbl_waiting_measurement = FALSE;
+// Where the scan of the current point is (see the top of the file). frontend_loop and scan_read move it on,
+// without waiting, so the frontend keeps answering transitions and the ODB during moves and measurements.
+typedef enum {
+  SCAN_IDLE,        // the next move starts once the BONM bank is written
+  SCAN_MOVING,      // feMove moving the gantries to the point
+  SCAN_SETTLING,    // motors being switched off before the measurement
+  SCAN_MEASURING,   // EOM bank written, PMT data being taken for the measurement time
+  NUM_SCAN_STATES
+} SCAN_STATE;
+const char *scan_state_names[NUM_SCAN_STATES] = {"Idle", "Moving", "Settling", "Measuring"};
+SCAN_STATE gbl_state = SCAN_IDLE;
+DWORD gbl_state_since;  // ss_millitime() when gbl_state was entered
+
+#define MOVE_TIMEOUT      (60000 * 20) // ms; 3 (5) minute timeout //JW 20191128 5->20
+#define MOVE_START_DELAY  500  // ms before the ODB is believed about a move just started (no notices from feMove)
+#define MOVE_POLL_PERIOD  50   // ms between looks at the ODB during a move (no notices from feMove)
+#define MOTORS_OFF_DELAY  50   // ms between switching the motors off and the measurement
+
+// Last look at the ODB during a move (no notices from feMove)
+DWORD gbl_last_move_poll;
+// Sequence of the move completion notices when the move was started
+uint32_t gbl_move_sequence = 0;
 
 //checks if initializing
 // BOOL    gbl_initing = FALSE;
@@ -91,8 +117,24 @@ INT gbl_total_number_points = 0;
 
 // List of points
 //float **points;
-std::vector <std::vector<double> > points;
+// Mapped from the plan file (see gen_scan_path) when it could be written
+ScanPoints points;
+
+// Scan plan file, from /Equipment/Scan/Plan/File
+char gbl_plan_file[256] = "scan_plan.dat";
+
+// Plan file with the path of manual scans, from /Equipment/Scan/Plan/Manual Path (see make_scan_plan.py)
+char gbl_manual_plan[256] = "demo_path.plan";
+
+// waypoints[i] is set if point i is only passed through, without a measurement (see validate_scan_path)
+std::vector<char> waypoints;
+
+// Checking the path before the run, from /Equipment/Scan/Validation
+SCAN_VALIDATION gbl_validation = {TRUE, FALSE, FALSE, FALSE};
+
 
+// Notices from feMove when a move is over (see MoveCompletion.hxx); NULL to poll the ODB instead
+MOVE_COMPLETION *gbl_move_completion = NULL;
 
 // allocated memory for list of points
 INT max_size = 0;
@@ -139,6 +181,7 @@ BOOL gbl_waiting_for_run_stop = FALSE; /* global flag to prevent restarting cycl
 BOOL gbl_bank_BONM_created = FALSE;
 BOOL gbl_bank_EOM_created = TRUE;
 BOOL bad_destination = FALSE;
+BOOL gbl_at_waypoint = FALSE;  /* last move was to a waypoint: nothing to measure */
 
 DWORD time_move_next_position;
 DWORD time_Start_motors;
@@ -146,6 +189,17 @@ DWORD time_Done_cycle;
 DWORD time_Start_read;
 DWORD time_Done_read;
 
+// Where the time of the scan went (ms), see write_scan_timing
+typedef struct {
+  DWORD Begin;          // ss_millitime() at begin of run
+  DWORD Planning;       // feMove planning the moves
+  DWORD Motion;         // motors moving, from feMove's move completion notices
+  DWORD Settle;         // feMove checking the positions, and the wait until the measurement started
+  DWORD Measurement;
+  DWORD States[NUM_SCAN_STATES]; // time spent in each state, see set_scan_state
+} SCAN_TIMING;
+SCAN_TIMING gbl_timing;
+
 SCAN_SETTINGS fs;
 ScanSequence scan_seq;
 
@@ -208,10 +262,16 @@ extern void interrupt_routine(void);
 INT scan_read(char *pevent, INT off);
 
 INT move_next_position();
+INT check_move();
+void finish_move(void);
+void set_scan_state(SCAN_STATE state);
 //INT set_scan_params(INT *ninc);
 
 // NEW:
 BOOL gen_scan_path();      // for preprogrammed cycli
+INT validate_scan_path(INT num_points);
+void write_scan_timing(void);
+void publish_upcoming_destinations(void);
 
 /*-- Equipment list ------------------------------------------------*/
 EQUIPMENT equipment[] = {
@@ -270,6 +330,15 @@ INT get_settings_parameters(){
     return DB_NO_ACCESS;    
   }
 
+  // Read every time, so a new manual path only needs the plan file and this key changed
+  size = sizeof(gbl_manual_plan);
+  status = db_get_value(hDB, 0, "/Equipment/Scan/Plan/Manual Path", gbl_manual_plan, &size, TID_STRING, TRUE);
+  if (status != DB_SUCCESS) {
+    cm_msg(MERROR, "get_settings_parameters", "cannot get /Equipment/Scan/Plan/Manual Path, using %s",
+           gbl_manual_plan);
+  }
+  scan_seq.SetManualPlan(gbl_manual_plan);
+
   printf("Successfully got scan settings; scan type: %i\n",fs.scan_type);
   return 1;
 }
@@ -285,7 +354,7 @@ INT frontend_init() {
   BOOL watchdog_flag;
   INT status, rstate, size;
 
-  gbl_making_move = FALSE;
+  gbl_state = SCAN_IDLE;
 
   /* get the experiment name */
   size = sizeof(expt_name);
@@ -325,6 +394,13 @@ INT frontend_init() {
   printf("Scan init()\n");
   scan_seq.Init(fs, gGantryLimits);
 
+  // Where the scan plan is kept between runs and restarts, see gen_scan_path
+  size = sizeof(gbl_plan_file);
+  status = db_get_value(hDB, 0, "/Equipment/Scan/Plan/File", gbl_plan_file, &size, TID_STRING, TRUE);
+  if (status != DB_SUCCESS) {
+    cm_msg(MERROR, "frontend_init", "cannot get /Equipment/Scan/Plan/File, using %s", gbl_plan_file);
+  }
+
 
   // Obtain the ODB keys for various variables
   // Note: when adding or removing variables to/from this list change the variable num_entires to change the size of the arrays used
@@ -430,11 +506,27 @@ INT frontend_loop() {
     /*       RUNNING
 	     check if cycle is finished AND histo update being done */
     //if(gbl_initing) return SUCCESS;  //**
-    if (!gbl_making_move) { /* not in cycle, wait until equipment has run */
-      if (gbl_waiting_measurement) {
-        return SUCCESS; /* processing has not yet finished i.e. all equipments have not run */
+    switch (gbl_state) {
+    case SCAN_MOVING:
+      status = check_move();
+      if (status != SUCCESS) {
+        sprintf(str, "Stopping run because of error in check_move");
+        status = cm_transition(TR_STOP, 0, str, sizeof(str), TR_SYNC, 0);
+      }
+      return status;
+
+    case SCAN_SETTLING:
+      if ((INT) (ss_millitime() - gbl_state_since) >= MOTORS_OFF_DELAY) {
+        time_Start_read = ss_millitime();
+        set_scan_state(SCAN_MEASURING);
       }
-      cm_msg(MDEBUG, "frontend_loop", "running: IN_CYCLE is false");
+      return SUCCESS;
+
+    case SCAN_MEASURING:
+      return SUCCESS; /* scan_read takes the measurement */
+
+    default: /* SCAN_IDLE */
+      cm_msg(MDEBUG, "frontend_loop", "running: idle");
 
       // Terminate the sequence once we have finished last move.
       if (gbl_current_point >= gbl_total_number_points) {
@@ -460,15 +552,14 @@ INT frontend_loop() {
       cm_msg(MDEBUG, "frontend_loop", "Starting next move");
 
       /* Start new move */
-      // We are starting to move; set flag to ensure that nothing else tries to start us moving.
+      // move_next_position goes to SCAN_MOVING, so nothing else tries to start us moving.
 
       //TF: this line FAILS into infinite loop (with scan_read where BONM_created will NEVER get set to TRUE so never will reach next move) IF it's a bad dest!! Hence, only do if not bad_dest
       // BONM is a bank that is the MIDAS file that is there for analysis purposes. BONM and EOM can be used to tell if data was taken while the gantries were moving or not. BONM is created in scan_read()
-      if (gbl_bank_BONM_created == FALSE && bad_destination == FALSE) {
+      if (gbl_bank_BONM_created == FALSE && bad_destination == FALSE && gbl_at_waypoint == FALSE) {
         return SUCCESS;
       }
 
-      gbl_making_move = TRUE;
       time_move_next_position = ss_millitime();
       status = move_next_position();
       gbl_bank_BONM_created = FALSE;
@@ -478,11 +569,6 @@ INT frontend_loop() {
         status = cm_transition(TR_STOP, 0, str, sizeof(str), TR_SYNC, 0);
         return status;
       }
-
-    } /* end of not in cycle */
-    else { //we are already moving; (i.e. gbl_making_move is TRUE) nothing to do
-      cm_msg(MDEBUG, "frontend_loop", "Running in cycle: nothing to do; exit");
-      return SUCCESS;
     }
   } //end of RUNNING 
   // else NOT running,  nothing to do 
@@ -514,11 +600,22 @@ INT begin_of_run(INT run_number, char *error)
   gbl_transition_requested = FALSE; /* used for deferred transition */
   gbl_waiting_for_run_stop = FALSE; /* unrecoverable error */
   gbl_run_number = run_number;
-  gbl_making_move = FALSE;
   gbl_first_call = TRUE; /* for prestop */
+  memset(&gbl_timing, 0, sizeof(gbl_timing));
+  gbl_timing.Begin = ss_millitime();
+  gbl_state_since = gbl_timing.Begin;
+  set_scan_state(SCAN_IDLE);
 
   cm_msg(MINFO, "begin_of_run", "Start begin of run");
 
+  // feMove may have been started after feScan, so try until its move completion notices are there
+  if (!gbl_move_completion) {
+    gbl_move_completion = open_move_completion(FALSE);
+    if (!gbl_move_completion)
+      cm_msg(MINFO, "begin_of_run", "No move completion notices from feMove (%s), polling the ODB instead",
+             MOVE_COMPLETION_SHM);
+  }
+
   // CHECK THE LOGGER IS ON if we want to write data
   /* Get Logger  settings */
   size = sizeof(loggerWrite);
@@ -643,9 +740,6 @@ INT begin_of_run(INT run_number, char *error)
     return DB_NO_ACCESS;
   }
 
-
-  ss_sleep(1000); /* sleep before starting loop*/
-
   /* Start cycle */
   first_time = TRUE;
   gbl_current_point = 0;
@@ -662,11 +756,29 @@ INT begin_of_run(INT run_number, char *error)
 }
 
 /*-- Generate path for scan-----------------------------------------*/
+// The plan is saved to gbl_plan_file and used from there (mapped), so large plans load without copying.
+// If the file already holds the plan for the same settings (e.g. after feScan was restarted) it is reused
+// instead of generating the path again.
 BOOL gen_scan_path(void) {
 
-  //Fills points (passed by ref) with the scan sequence specified in the ODB
-  // Insert path into global variable/array
-  gbl_total_number_points = scan_seq.GeneratePath(points);
+  const uint32_t settingsHash = scan_seq.SettingsHash();
+
+  if (points.Map(gbl_plan_file, settingsHash)) {
+    gbl_total_number_points = points.size();
+    cm_msg(MINFO, "gen_scan_path", "Reusing scan plan %s", gbl_plan_file);
+  } else {
+    //Fills points (passed by ref) with the scan sequence specified in the ODB
+    // Insert path into global variable/array
+    gbl_total_number_points = scan_seq.GeneratePath(points);
+
+    // Only the return to base: the path could not be generated, don't keep it
+    if (gbl_total_number_points > 1 && points.Write(gbl_plan_file, gbl_total_number_points, settingsHash)) {
+      points.Map(gbl_plan_file, settingsHash);
+    }
+  }
+
+  // The plan is kept as generated; only the copy scanned now is changed by the checks
+  gbl_total_number_points = validate_scan_path(gbl_total_number_points);
 
   // Check path size
   if (gbl_total_number_points > max_event_size) {
@@ -681,9 +793,61 @@ BOOL gen_scan_path(void) {
 }
 
 
+/*-- Check path before the run -------------------------------------*/
+// Checks the points (and optionally the moves between them) against the collision model of feMove, so that
+// points it would refuse are known before the run instead of one "Bad Destination" at a time.
+// The options are in /Equipment/Scan/Validation and the results in /Equipment/Scan/Validation/Summary.
+// Returns the number of points left in the path.
+INT validate_scan_path(INT num_points) {
+  INT size = sizeof(BOOL);
+  db_get_value(hDB, 0, "/Equipment/Scan/Validation/Check Points", &gbl_validation.CheckPoints, &size, TID_BOOL, TRUE);
+  db_get_value(hDB, 0, "/Equipment/Scan/Validation/Check Moves", &gbl_validation.CheckMoves, &size, TID_BOOL, TRUE);
+  db_get_value(hDB, 0, "/Equipment/Scan/Validation/Drop Invalid Points", &gbl_validation.DropInvalid, &size,
+               TID_BOOL, TRUE);
+  db_get_value(hDB, 0, "/Equipment/Scan/Validation/Reroute Moves", &gbl_validation.RerouteMoves, &size,
+               TID_BOOL, TRUE);
+
+  // The geometry of the tank and PMT is kept by feMove
+  HNDLE hCollision;
+  SCAN_VALIDATION options = gbl_validation;
+  if (options.CheckPoints && db_find_key(hDB, 0, COLLISION_SETTINGS_DIR, &hCollision) != DB_SUCCESS) {
+    cm_msg(MINFO, "validate_scan_path", "Not checking the path: %s not found, start feMove first",
+           COLLISION_SETTINGS_DIR);
+    options.CheckPoints = FALSE;
+  }
+  // Only read: feMove hotlinks these keys, and a key created here with 0 would end up in its collision model
+  COLLISION_SETTINGS collision;
+  memset(&collision, 0, sizeof(collision));
+  if (options.CheckPoints && !load_collision_settings(hDB, &collision)) {
+    cm_msg(MERROR, "validate_scan_path", "Not checking the path: the settings in %s are incomplete",
+           COLLISION_SETTINGS_DIR);
+    options.CheckPoints = FALSE;
+  }
+
+  SCAN_VALIDATION_SUMMARY summary;
+  num_points = scan_seq.ValidatePath(points, num_points, waypoints, gGantryPositions, collision, options, &summary);
+
+  db_set_value(hDB, 0, "/Equipment/Scan/Validation/Summary/Invalid Points", &summary.InvalidPoints, sizeof(INT), 1,
+               TID_INT);
+  db_set_value(hDB, 0, "/Equipment/Scan/Validation/Summary/Invalid Moves", &summary.InvalidMoves, sizeof(INT), 1,
+               TID_INT);
+  db_set_value(hDB, 0, "/Equipment/Scan/Validation/Summary/Dropped Points", &summary.DroppedPoints, sizeof(INT), 1,
+               TID_INT);
+  db_set_value(hDB, 0, "/Equipment/Scan/Validation/Summary/Rerouted Moves", &summary.ReroutedMoves, sizeof(INT), 1,
+               TID_INT);
+  db_set_value(hDB, 0, "/Equipment/Scan/Validation/Summary/Still Invalid", &summary.StillInvalid, sizeof(INT), 1,
+               TID_INT);
+  db_set_value(hDB, 0, "/Equipment/Scan/Validation/Summary/First Invalid Point", &summary.FirstInvalid, sizeof(INT),
+               1, TID_INT);
+
+  return num_points;
+}
+
+
 /*-- Start cycle sequence ------------------------------------------*/
+// Starts the move to gbl_current_point and goes to SCAN_MOVING, without waiting for it (see check_move).
 INT move_next_position(void) {
-  INT status, size;
+  INT status;
 
   cm_msg(MDEBUG, "move_next_position", "start of move_next_position");
   /* New cycle => start at bin 0 */
@@ -717,6 +881,12 @@ INT move_next_position(void) {
     return DB_NO_ACCESS;
   }
 
+  // So that feMove can plan the next moves while this one is made
+  publish_upcoming_destinations();
+
+  // Taken before the move is started, so its completion notice cannot be missed
+  gbl_move_sequence = gbl_move_completion ? move_completion_sequence(gbl_move_completion) : 0;
+
   // Start the move!
   BOOL start_move[1] = {TRUE};
   printf("Moving!\n");
@@ -728,98 +898,135 @@ INT move_next_position(void) {
     return DB_NO_ACCESS;
   }
 
-  // Check that we are moving (why for half second first)
-  ss_sleep(500); //Why is this? Should it be longer or shorter? We should change to an optimal value
-
-  printf("Check moving\n");
-  BOOL moving;
-  INT size_moving = sizeof(moving);
-  status = db_get_value(hDB, hMoveVariables, "Moving", &moving, &size_moving, TID_BOOL, FALSE);
-  //  BOOL moving;
-  //size = sizeof(moving);
-  //status = db_get_value(hDB,hMoveVariables,"Moving",&moving,sizeof(moving),TID_BOOL,FALSE);
-  if (status != DB_SUCCESS) {
-    cm_msg(MERROR, "begin_of_run", "cannot get value for Moving");
-    return DB_NO_ACCESS;
-  }
-  if (!moving)
-    printf("Yikes, not moving! Not good!\n");
-  printf("Check complete\n");
-  BOOL completed;
-  status = db_get_value(hDB, hMoveVariables, "Completed", &completed, &size_moving, TID_BOOL, FALSE);
-  if (status != DB_SUCCESS) {
-    cm_msg(MERROR, "begin_of_run", "cannot get value for Completed");
-    return DB_NO_ACCESS;
-  }
-
-  BOOL finished_moving = FALSE;
-  if (completed && !moving)
-    finished_moving = TRUE;
-  DWORD time_start_move = ss_millitime();
-
-  INT timeout = 60000 * 20; // 3 (5) minute timeout //JW 20191128 5->20
-
-  // Loop which checks ODB until move to next point is finished
-  while (!finished_moving) {
+  // check_move, called by frontend_loop, finds out when it is over
+  gbl_last_move_poll = time_Start_motors;
+  set_scan_state(SCAN_MOVING);
+  return CM_SUCCESS;
+}  /* end of move_next_position routine */
 
-    ss_sleep(50);
-    status = db_get_value(hDB, hMoveVariables, "Moving", &moving, &size_moving, TID_BOOL, FALSE);
-    status = db_get_value(hDB, hMoveVariables, "Completed", &completed, &size_moving, TID_BOOL, FALSE);
 
+/*-- Move in progress ----------------------------------------------*/
+// Looks once whether the move started by move_next_position is over, and if so calls finish_move.
+// Returns SUCCESS while the move goes on, an error if it cannot be followed or takes too long.
+INT check_move(void) {
+  INT status, size;
+  DWORD time_now = ss_millitime();
+
+  if (gbl_move_completion) {
+    // feMove posts a notice as soon as the move is over, with the final positions
+    MOVE_COMPLETION completion;
+    if (wait_move_completion(gbl_move_completion, gbl_move_sequence, 0, &completion)) {
+      bad_destination = completion.BadDestination;
+      memcpy(gGantryPositions, completion.Position, sizeof(gGantryPositions));
+      gbl_timing.Planning += completion.Times.Planning;
+      gbl_timing.Motion += completion.Times.Motion;
+      gbl_timing.Settle += completion.Times.Settle;
+      finish_move();
+      return SUCCESS;
+    }
+  } else if ((INT) (time_now - time_Start_motors) >= MOVE_START_DELAY &&
+             (INT) (time_now - gbl_last_move_poll) >= MOVE_POLL_PERIOD) {
+    // feMove may not have seen Start Move yet right after it was set: the ODB still shows the last move
+    gbl_last_move_poll = time_now;
+    BOOL moving, completed;
+    size = sizeof(moving);
+    status = db_get_value(hDB, hMoveVariables, "Moving", &moving, &size, TID_BOOL, FALSE);
+    if (status != DB_SUCCESS) {
+      cm_msg(MERROR, "check_move", "cannot get value for Moving");
+      return DB_NO_ACCESS;
+    }
+    size = sizeof(completed);
+    status = db_get_value(hDB, hMoveVariables, "Completed", &completed, &size, TID_BOOL, FALSE);
+    if (status != DB_SUCCESS) {
+      cm_msg(MERROR, "check_move", "cannot get value for Completed");
+      return DB_NO_ACCESS;
+    }
 
-    if (completed && !moving)
-      finished_moving = TRUE;
+    if (completed && !moving) {
+      size = sizeof(bad_destination);
+      status = db_get_value(hDB, hMoveVariables, "Bad Destination", &bad_destination, &size, TID_BOOL, FALSE);
+      if (status != DB_SUCCESS) {
+        cm_msg(MERROR, "check_move", "cannot get value for Bad Destination");
+        return DB_NO_ACCESS;
+      }
+      // Without the notices the move cannot be split up
+      gbl_timing.Motion += time_now - time_Start_motors;
+      finish_move();
+      return SUCCESS;
+    }
+  }
 
-    DWORD time_now = ss_millitime();
+  if ((INT) (time_now - time_Start_motors) > MOVE_TIMEOUT) {
+    cm_msg(MERROR, "check_move", "We have waited %i ms, which is too long: Cannot finish move!",
+           time_now - time_Start_motors);
+    return DB_NO_ACCESS; //AJ: should break and go to the next position... not return an error code and stop the whole run
+  }
+  return SUCCESS;
+}
 
-    //DEBUG
-    //if((INT)(time_now-time_start_move)%10000 < 100){
-    //    printf("yield %i ms\n",time_now-time_start_move);
-    //}
 
-    if ((INT)(time_now - time_start_move) > timeout) {
-      cm_msg(MERROR, "move_next_position", "We have waited %i ms, which is too long: Cannot finish move!",
-             time_now - time_start_move);
-      return DB_NO_ACCESS; //AJ: should break and go to the next position... not return an error code and stop the whole run
-    }
-  }
+/*-- Move finished -------------------------------------------------*/
+// Moves on to the next point, and switches the motors off for a measurement unless the move was to a waypoint
+// or could not be made.
+void finish_move(void) {
 
   // Finished moving to the current point.
   gbl_current_point++;
   db_set_data(hDB, hCurrentPoint, &gbl_current_point, sizeof(INT), 1, TID_INT);
+  time_Done_cycle = ss_millitime();
 
   /* Cycle process sequencer
      NEW: only if moved to valid new position */
-
-  size = sizeof(bad_destination);
-  status = db_get_value(hDB, hMoveVariables, "Bad Destination", &bad_destination, &size, TID_BOOL, FALSE);
-  if (status != DB_SUCCESS) {
-    cm_msg(MERROR, "move_next_position", "cannot get value for Bad Destination");
-    return DB_NO_ACCESS;
-  }
-  cm_msg(MDEBUG, "move_next_position", "Bad dest: %i", bad_destination);
-  if (!bad_destination) {
+  cm_msg(MDEBUG, "finish_move", "Bad dest: %i", bad_destination);
+  gbl_at_waypoint = gbl_current_point <= (INT) waypoints.size() && waypoints[gbl_current_point - 1];
+  if (!bad_destination && !gbl_at_waypoint) {
     //Switch off motors through hotlink with cd_galil to perform minimum noise measurement
     //Galil motors increase noise in PMT signals otherwise.
 
     BOOL turn_off = TRUE;
     db_set_data(hDB, hMotors00, &turn_off, sizeof(BOOL), 1, TID_BOOL);
     db_set_data(hDB, hMotors01, &turn_off, sizeof(BOOL), 1, TID_BOOL);
-
-    ss_sleep(50);
-    gbl_waiting_measurement = TRUE;
+    set_scan_state(SCAN_SETTLING);
+  } else {
+    set_scan_state(SCAN_IDLE);
   }
   first_time = FALSE;
 
-  /* Now we are ready to restart the hardware */
-  /* Cycle started */
-  gbl_making_move = FALSE;
+  cm_msg(MDEBUG, "finish_move", "%d  SCyc %d   go ", gbl_CYCLE_N, gbl_SCYCLE_N);
+}
 
-  cm_msg(MDEBUG, "move_next_position", "%d  SCyc %d   go ", gbl_CYCLE_N, gbl_SCYCLE_N);
 
-  time_Done_cycle = ss_millitime();
-  return CM_SUCCESS;
-}  /* end of move_next_position routine */
+/*-- Scan state ----------------------------------------------------*/
+// Adds the time spent in the state being left to gbl_timing.States, and shows the new one in
+// /Equipment/Scan/Variables/State.
+void set_scan_state(SCAN_STATE state) {
+  DWORD time_now = ss_millitime();
+  gbl_timing.States[gbl_state] += time_now - gbl_state_since;
+  gbl_state = state;
+  gbl_state_since = time_now;
+
+  char name[32];
+  snprintf(name, sizeof(name), "%s", scan_state_names[state]);
+  db_set_value(hDB, 0, "/Equipment/Scan/Variables/State", name, sizeof(name), 1, TID_STRING);
+}
+
+
+/*-- Upcoming destinations -----------------------------------------*/
+// Tells feMove the destination of the move being started and the ones after it (see UPCOMING_DESTINATIONS),
+// with the values of -999 or less taken from the destination before, as move_next_position will.
+void publish_upcoming_destinations(void) {
+  float upcoming[UPCOMING_DESTINATIONS][10];
+  int k, i;
+  memcpy(upcoming[0], gGantryDestinations, sizeof(upcoming[0]));
+  for (k = 1; k < UPCOMING_DESTINATIONS; k++) {
+    for (i = 0; i < 10; i++) {
+      if (gbl_current_point + k >= gbl_total_number_points) upcoming[k][i] = -999;
+      else if (points[gbl_current_point + k][i] > -999) upcoming[k][i] = points[gbl_current_point + k][i];
+      else upcoming[k][i] = upcoming[k - 1][i];
+    }
+  }
+  db_set_value(hDB, 0, UPCOMING_DESTINATIONS_KEY, upcoming, sizeof(upcoming), UPCOMING_DESTINATIONS * 10, TID_FLOAT);
+}
 
 
 /*-- End of Run ----------------------------------------------------*/
@@ -827,13 +1034,67 @@ INT move_next_position(void) {
 INT end_of_run(INT run_number, char *error) {
 
   cm_msg(MINFO, "end_of_run", "Ending the run");
+
+  // The run can now be stopped in the middle of a point
+  if (gbl_state == SCAN_MOVING) {
+    cm_msg(MINFO, "end_of_run", "Run stopped during the move to point %i, feMove still finishes it",
+           gbl_current_point);
+  } else if (gbl_state == SCAN_SETTLING || gbl_state == SCAN_MEASURING) {
+    BOOL turn_off = FALSE;
+    db_set_data(hDB, hMotors00, &turn_off, sizeof(BOOL), 1, TID_BOOL);
+    db_set_data(hDB, hMotors01, &turn_off, sizeof(BOOL), 1, TID_BOOL);
+  }
+  set_scan_state(SCAN_IDLE);
+
+  if (gbl_called_BOR) write_scan_timing();
   points.clear();
+  waypoints.clear();
 
   gbl_called_BOR = FALSE;
 
   return CM_SUCCESS;
 }
 
+/*-- Scan timing summary ------------------------------------------*/
+// Splits the time of the run into planning, motion, settle and measurement (and the rest), in
+// /Equipment/Scan/Timing (s) and the message log, and into the states of the scan in /Equipment/Scan/Timing/States. The timing of every waypoint is in feMove's MTIM bank.
+void write_scan_timing(void) {
+  const char *names[] = {"Planning", "Motion", "Settle", "Measurement", "Other", "Total"};
+  double seconds[6];
+  DWORD total = ss_millitime() - gbl_timing.Begin;
+  DWORD known = gbl_timing.Planning + gbl_timing.Motion + gbl_timing.Settle + gbl_timing.Measurement;
+  seconds[0] = gbl_timing.Planning / 1000.;
+  seconds[1] = gbl_timing.Motion / 1000.;
+  seconds[2] = gbl_timing.Settle / 1000.;
+  seconds[3] = gbl_timing.Measurement / 1000.;
+  seconds[4] = (total > known ? total - known : 0) / 1000.;
+  seconds[5] = total / 1000.;
+
+  char key[64];
+  int i;
+  for (i = 0; i < 6; i++) {
+    snprintf(key, sizeof(key), "/Equipment/Scan/Timing/%s", names[i]);
+    db_set_value(hDB, 0, key, &seconds[i], sizeof(double), 1, TID_DOUBLE);
+  }
+
+  double percent = seconds[5] > 0 ? 100. / seconds[5] : 0;
+  cm_msg(MINFO, "write_scan_timing",
+         "Scan took %.0f s: planning %.0f s (%.0f%%), motion %.0f s (%.0f%%), settle %.0f s (%.0f%%), "
+         "measurement %.0f s (%.0f%%), other %.0f s (%.0f%%)", seconds[5], seconds[0], seconds[0] * percent,
+         seconds[1], seconds[1] * percent, seconds[2], seconds[2] * percent, seconds[3], seconds[3] * percent,
+         seconds[4], seconds[4] * percent);
+
+  // The same time by state of frontend_loop and scan_read
+  double states[NUM_SCAN_STATES];
+  for (i = 0; i < NUM_SCAN_STATES; i++) {
+    states[i] = gbl_timing.States[i] / 1000.;
+    snprintf(key, sizeof(key), "/Equipment/Scan/Timing/States/%s", scan_state_names[i]);
+    db_set_value(hDB, 0, key, &states[i], sizeof(double), 1, TID_DOUBLE);
+  }
+  cm_msg(MINFO, "write_scan_timing", "By state: idle %.0f s, moving %.0f s, settling %.0f s, measuring %.0f s",
+         states[SCAN_IDLE], states[SCAN_MOVING], states[SCAN_SETTLING], states[SCAN_MEASURING]);
+}
+
 /*-- Pause Run -----------------------------------------------------*/
 INT pause_run(INT run_number, char *error) {
   cm_msg(MERROR, "pause_run", "This command DOES NOT WORK for this program");
@@ -866,7 +1127,7 @@ INT poll_event(INT source, INT count, BOOL test)
 /*-- Event readout -------------------------------------------------*/
 INT scan_read(char *pevent, INT off)
 /* - periodic equipment reading the scalers sum over a cycle
-   - generate event only when cycle has been completed  (through gbl_waiting_measurement)
+   - generate event only when cycle has been completed  (in SCAN_MEASURING)
    
 */
 {
@@ -874,9 +1135,9 @@ INT scan_read(char *pevent, INT off)
   //double current,time;
   INT read_status, size, status, m;
 
-  cm_msg(MDEBUG, "scan_read", "gbl_waiting_measurement %d", gbl_waiting_measurement);
+  cm_msg(MDEBUG, "scan_read", "gbl_state %s", scan_state_names[gbl_state]);
 
-  if (gbl_waiting_measurement) {
+  if (gbl_state == SCAN_MEASURING) {
     if (gbl_bank_EOM_created == FALSE) {
 
       //Do this once!
@@ -890,12 +1151,14 @@ INT scan_read(char *pevent, INT off)
       *unused_pointer2++ = (double) gbl_current_point;
       bk_close(pevent, unused_pointer2);
       gbl_bank_EOM_created = TRUE;
+      // The measurement starts with the EOM
+      time_Start_read = ss_millitime();
+      gbl_timing.Settle += time_Start_read - time_Done_cycle;
       return bk_size(pevent);
 
     } else {
-      time_Start_read = ss_millitime();
-      //Accumulate PMT data during this sleep after the EOM, and before a new BONM, through a separate stream of banks
-      ss_sleep(scan_seq.GetMeasTime());
+      //Accumulate PMT data for the measurement time after the EOM, and before a new BONM, through a separate stream of banks
+      if ((INT) (ss_millitime() - time_Start_read) < scan_seq.GetMeasTime()) return 0;
       cm_msg(MDEBUG, "scan_read", "make bank");
       //cm_msg(MDEBUG,"scan_read","current %e, time %g",current, time);
 
@@ -946,14 +1209,14 @@ INT scan_read(char *pevent, INT off)
         *pmagdata++ = (double) gCoilVoltage[m];
       bk_close(pevent, pmagdata);
 
-      gbl_waiting_measurement = FALSE;
-      gbl_making_move = FALSE;
+      set_scan_state(SCAN_IDLE);
 
       //switch the turn_off hotlink back to false
       BOOL turn_off = FALSE;
       db_set_data(hDB, hMotors00, &turn_off, sizeof(BOOL), 1, TID_BOOL);
       db_set_data(hDB, hMotors01, &turn_off, sizeof(BOOL), 1, TID_BOOL);
       time_Done_read = ss_millitime();
+      gbl_timing.Measurement += time_Done_read - time_Start_read;
 
       read_status = SUCCESS;
       if (read_status != SUCCESS) {
@@ -970,7 +1233,6 @@ INT scan_read(char *pevent, INT off)
       return bk_size(pevent);
     }
   }
-  //printf("gbl_making_move: %i", gbl_making_move);
 
   // check that an EOM has been created beofore you make the next BONM
   if (gbl_bank_BONM_created == FALSE && gbl_bank_EOM_created == TRUE) {